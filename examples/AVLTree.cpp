@@ -16,9 +16,11 @@
 #include "AVLTreeNode.hpp"
 #include "TreeNodeObject.hpp"
 
-bool comparator(const int& key1, const int& key2) {
-    return key1 < key2;
-}
+struct Comparator {
+    bool operator()(const int& key1, const int& key2) const {
+        return key1 < key2;
+    }
+};
 
 class Persona : public TreeNodeObject {
     private:
@@ -42,7 +44,7 @@ class Persona : public TreeNodeObject {
 int main() {
     std::cout << "Test della classe AVLTree" << std::endl;
 
-    AVLTree<comparator> tree = AVLTree<comparator>();
+    AVLTree<int, sptr_TreeNodeObject, Comparator> tree = AVLTree<int, sptr_TreeNodeObject, Comparator>();
 
     tree.insert(new Persona("Gabriele", 10));
     tree.insert(new Persona("Andrea", 11));
@@ -15,9 +15,11 @@
 #include "BinarySearchTree.hpp"
 #include "TreeNodeObject.hpp"
 
-bool comparator(const int& key1, const int& key2) {
-    return key1 < key2;
-}
+struct Comparator {
+    bool operator()(const int& key1, const int& key2) const {
+        return key1 < key2;
+    }
+};
 
 class Persona : public TreeNodeObject {
 
@@ -42,7 +44,7 @@ class Persona : public TreeNodeObject {
 int main() {
     std::cout << "Test della classe BinarySearchTree" << std::endl;
 
-    BinarySearchTree<comparator> tree = BinarySearchTree<comparator>();
+    BinarySearchTree<int, sptr_TreeNodeObject, Comparator> tree = BinarySearchTree<int, sptr_TreeNodeObject, Comparator>();
 
     tree.insert(new Persona("Gabriele", 10));
     tree.insert(new Persona("Andrea", 11));
@@ -0,0 +1,45 @@
+/**
+ * @file IntervalTree.cpp
+
+ * @brief Example file for the IntervalTree class
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include <iostream>
+#include <string>
+
+#include "IntervalTree.hpp"
+
+int main() {
+    std::cout << "Test della classe IntervalTree" << std::endl;
+
+    IntervalTree<int, std::string> tree = IntervalTree<int, std::string>();
+
+    tree.insert(9, 11, "Colazione");
+    tree.insert(10, 12, "Riunione");
+    tree.insert(13, 14, "Pranzo");
+    tree.insert(14, 18, "Lezione");
+    tree.insert(17, 19, "Palestra");
+    tree.insert(20, 23, "Cinema");
+
+    auto print = [](const int& low, const int& high, const std::string& name) {
+        std::cout << "[" << low << ", " << high << "] " << name << std::endl;
+    };
+
+    std::cout << "Intervalli che contengono le 10" << std::endl;
+    tree.stab(10, print);
+    std::cout << "Intervalli che si sovrappongono a [14, 17]" << std::endl;
+    tree.overlap(14, 17, print);
+
+    std::cout << std::endl << "ORA RIMUOVO" << std::endl;
+    tree.remove(14, 18);
+    std::cout << "Intervalli che si sovrappongono a [14, 17] - rimosso [14, 18]" << std::endl;
+    tree.overlap(14, 17, print);
+    std::cout << "Qualche intervallo in [15, 16]? " << (tree.overlaps(15, 16) ? "si" : "no") << std::endl;
+
+    return 0;
+}
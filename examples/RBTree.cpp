@@ -14,9 +14,11 @@
 
 #include "RBTree.hpp"
 
-bool comparator(const int& key1, const int& key2) {
-    return key1 < key2;
-}
+struct Comparator {
+    bool operator()(const int& key1, const int& key2) const {
+        return key1 < key2;
+    }
+};
 
 class Persona : public TreeNodeObject {
     private:
@@ -40,7 +42,7 @@ class Persona : public TreeNodeObject {
 int main() {
     std::cout << "Test della classe RBTree" << std::endl;
 
-    RBTree<comparator> tree = RBTree<comparator>();
+    RBTree<int, sptr_TreeNodeObject, Comparator> tree = RBTree<int, sptr_TreeNodeObject, Comparator>();
 
     tree.insert(new Persona("Gabriele", 10));
     tree.insert(new Persona("Andrea", 11));
@@ -10,16 +10,33 @@
  */
 
 #include <iostream>
+#include <string>
 
 #include "benchmark.hpp"
 #include "BinarySearchTree.hpp"
 #include "AVLTree.hpp"
 #include "RBTree.hpp"
+#include "WAVLTree.hpp"
+#include "SplayTree.hpp"
+#include "ScapegoatTree.hpp"
+#include "Treap.hpp"
+#include "CompactAVLTree.hpp"
+#include "CompactRBTree.hpp"
+#include "PathAVLTree.hpp"
+#include "PathRBTree.hpp"
+#include "FrozenTree.hpp"
+#include "BPlusTree.hpp"
+#include "AdaptiveRadixTree.hpp"
+#include "IntervalTree.hpp"
+#include "SlabAllocator.hpp"
+#include "ThreadPool.hpp"
 #include "TreeNodeObject.hpp"
 
-bool comparator(const int& key1, const int& key2) {
-    return key1 < key2;
-}
+struct Comparator {
+    bool operator()(const int& key1, const int& key2) const {
+        return key1 < key2;
+    }
+};
 
 class Intero : public TreeNodeObject {
     private:
@@ -36,22 +53,519 @@ class Intero : public TreeNodeObject {
 
 };
 
+// small record stored by value inside the nodes
+struct Record {
+    int id;
+    double amount;
+    Record() : Record(0) {} // required by the nil node of the RB tree
+    Record(const int id) : id{id}, amount{id * 0.5} {}
+};
+
+typedef BinarySearchTree<int, sptr_TreeNodeObject, Comparator> IntBinarySearchTree;
+typedef AVLTree<int, sptr_TreeNodeObject, Comparator> IntAVLTree;
+typedef RBTree<int, sptr_TreeNodeObject, Comparator> IntRBTree;
+typedef WAVLTree<int, sptr_TreeNodeObject, Comparator> IntWAVLTree;
+typedef ScapegoatTree<int, sptr_TreeNodeObject, Comparator> IntScapegoatTree;
+typedef Treap<int, sptr_TreeNodeObject, Comparator> IntTreap;
+typedef AVLTree<int, sptr_TreeNodeObject, Comparator, SlabAllocator<AVLTreeNode<int, sptr_TreeNodeObject>>> SlabIntAVLTree;
+typedef RBTree<int, sptr_TreeNodeObject, Comparator, SlabAllocator<RBTreeNode<int, sptr_TreeNodeObject>>> SlabIntRBTree;
+typedef AVLTree<int, Record, Comparator> RecordAVLTree;
+typedef RBTree<int, Record, Comparator> RecordRBTree;
+typedef AVLTree<int, Record, Comparator, SlabAllocator<AVLTreeNode<int, Record>>> SlabRecordAVLTree;
+typedef RBTree<int, Record, Comparator, SlabAllocator<RBTreeNode<int, Record>>> SlabRecordRBTree;
+typedef CompactAVLTree<int, sptr_TreeNodeObject, Comparator> CompactIntAVLTree;
+typedef CompactRBTree<int, sptr_TreeNodeObject, Comparator> CompactIntRBTree;
+typedef CompactAVLTree<int, Record, Comparator> CompactRecordAVLTree;
+typedef CompactRBTree<int, Record, Comparator> CompactRecordRBTree;
+typedef PathAVLTree<int, sptr_TreeNodeObject, Comparator> PathIntAVLTree;
+typedef PathRBTree<int, sptr_TreeNodeObject, Comparator> PathIntRBTree;
+typedef BPlusTree<int, sptr_TreeNodeObject> IntBPlusTree; // std::less on int enables the SIMD in-node search
+typedef BinarySearchTree<int, int, Comparator> IntKeyBinarySearchTree;
+typedef AVLTree<int, int, Comparator> IntKeyAVLTree;
+typedef RBTree<int, int, Comparator> IntKeyRBTree;
+typedef WAVLTree<int, int, Comparator> IntKeyWAVLTree;
+typedef SplayTree<int, int, Comparator> IntKeySplayTree;
+typedef ScapegoatTree<int, int, Comparator> IntKeyScapegoatTree;
+typedef Treap<int, int, Comparator> IntKeyTreap;
+typedef PathAVLTree<int, int, Comparator> IntKeyPathAVLTree;
+typedef PathRBTree<int, int, Comparator> IntKeyPathRBTree;
+typedef AVLTree<int, int, Comparator, std::allocator<AVLTreeNode<int, int>>, SubtreeSize> RankAVLTree;
+typedef RBTree<int, int, Comparator, std::allocator<RBTreeNode<int, int>>, SubtreeSize> RankRBTree;
+typedef AVLTree<int, int, Comparator, std::allocator<AVLTreeNode<int, int>>, MonoidAugmentation<SumOfValues<long long>>> SumAVLTree;
+typedef RBTree<int, int, Comparator, std::allocator<RBTreeNode<int, int>>, MonoidAugmentation<SumOfValues<long long>>> SumRBTree;
+typedef AdaptiveRadixTree<int, int> IntKeyAdaptiveRadixTree;
+typedef IntervalTree<int, int> IntIntervalTree;
+
+// descent reading the key through the stored object, as the nodes did before caching the key
+template <typename T_NODE>
+T_NODE searchThroughObject(T_NODE node, const T_NODE nil, const int key) {
+    while (node != nil && key != node->getValue()->getKey()) {
+        node = Comparator()(key, node->getValue()->getKey()) ? node->getLeft() : node->getRight();
+    }
+    return node;
+}
+
+template <typename T, typename T_NODE>
+void benchmarkSearchLatency(T& tree, const T_NODE nil, const uint numKeys) {
+    std::vector<int> keys = std::vector<int>(numKeys);
+    for(uint i{0}; i<numKeys; ++i) {
+        keys[i] = i;
+    }
+    std::mt19937 rng(42);
+    std::shuffle(std::begin(keys), std::end(keys), rng);
+    for(uint i{0}; i<numKeys; ++i) {
+        tree.insert(new Intero(keys[i]));
+    }
+    std::shuffle(std::begin(keys), std::end(keys), rng);
+
+    uint found{0};
+    auto start = std::chrono::steady_clock::now();
+    for(uint i{0}; i<numKeys; ++i) {
+        found += tree.search(keys[i]) != nil;
+    }
+    std::chrono::duration<double, std::micro> elapsedMicroseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "SEARCH (key in node): " << elapsedMicroseconds.count()/numKeys << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    for(uint i{0}; i<numKeys; ++i) {
+        found += searchThroughObject(tree.getRoot(), nil, keys[i]) != nil;
+    }
+    elapsedMicroseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "SEARCH (key in object): " << elapsedMicroseconds.count()/numKeys << std::endl;
+
+    if (found != 2*numKeys) {
+        std::cout << "ERROR: missing keys" << std::endl;
+    }
+}
+
+// insert, search and remove a given sequence of distinct keys
+template <typename T, typename T_NODE>
+void benchmarkDistribution(const std::vector<int>& keys) {
+    T tree = T();
+    std::vector<T_NODE> nodes = std::vector<T_NODE>(keys.size());
+
+    auto start = std::chrono::steady_clock::now();
+    for(uint i{0}; i<keys.size(); ++i) {
+        nodes[i] = tree.emplace(keys[i], keys[i]);
+    }
+    std::chrono::duration<double, std::micro> elapsedMicroseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "INSERT: " << elapsedMicroseconds.count()/keys.size() << std::endl;
+
+    uint found{0};
+    start = std::chrono::steady_clock::now();
+    for(uint i{0}; i<keys.size(); ++i) {
+        found += tree.search(keys[i]) == nodes[i];
+    }
+    elapsedMicroseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "SEARCH: " << elapsedMicroseconds.count()/keys.size() << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    for(uint i{0}; i<keys.size(); ++i) {
+        tree.remove(nodes[i]);
+    }
+    elapsedMicroseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "REMOVE: " << elapsedMicroseconds.count()/keys.size() << std::endl;
+
+    if (found != keys.size()) {
+        std::cout << "ERROR: missing keys" << std::endl;
+    }
+}
+
+void benchmarkDistributions(const std::string& name, const std::vector<int>& keys) {
+    std::cout << "--- Chiavi " << name << " ---" << std::endl;
+    std::cout << "1.\t--| Binary Search Tree |---" << std::endl;
+    benchmarkDistribution<IntKeyBinarySearchTree, ptr_TreeNode<int, int>>(keys);
+    std::cout << "2.\t--| AVL Tree |---" << std::endl;
+    benchmarkDistribution<IntKeyAVLTree, ptr_AVLTreeNode<int, int>>(keys);
+    std::cout << "3.\t--| Red Black Tree |---" << std::endl;
+    benchmarkDistribution<IntKeyRBTree, ptr_RBTreeNode<int, int>>(keys);
+    std::cout << "4.\t--| WAVL Tree |---" << std::endl;
+    benchmarkDistribution<IntKeyWAVLTree, ptr_WAVLTreeNode<int, int>>(keys);
+    std::cout << "5.\t--| Splay Tree |---" << std::endl;
+    benchmarkDistribution<IntKeySplayTree, ptr_TreeNode<int, int>>(keys);
+    std::cout << "6.\t--| Scapegoat Tree |---" << std::endl;
+    benchmarkDistribution<IntKeyScapegoatTree, ptr_TreeNode<int, int>>(keys);
+    std::cout << "7.\t--| Treap |---" << std::endl;
+    benchmarkDistribution<IntKeyTreap, ptr_TreapNode<int, int>>(keys);
+    std::cout << "8.\t--| AVL Tree (no parent links) |---" << std::endl;
+    benchmarkDistribution<IntKeyPathAVLTree, ptr_PathTreeNode<int, int>>(keys);
+    std::cout << "9.\t--| Red Black Tree (no parent links) |---" << std::endl;
+    benchmarkDistribution<IntKeyPathRBTree, ptr_PathTreeNode<int, int>>(keys);
+    std::cout << "10.\t--| Adaptive Radix Tree |---" << std::endl;
+    benchmarkDistribution<IntKeyAdaptiveRadixTree, ptr_ARTLeaf<int, int>>(keys);
+}
+
+// insert a stream of keys descending from the root, with the finger of insert and with the previous node as hint
+template <typename T, typename T_NODE>
+void benchmarkStream(const std::vector<int>& keys, const T_NODE nil) {
+    T rootTree = T();
+    auto start = std::chrono::steady_clock::now();
+    for(uint i{0}; i<keys.size(); ++i) {
+        rootTree.emplaceHint(nil, keys[i], keys[i]);
+    }
+    std::chrono::duration<double, std::micro> elapsedMicroseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "INSERT (from the root): " << elapsedMicroseconds.count()/keys.size() << std::endl;
+
+    T fingerTree = T();
+    start = std::chrono::steady_clock::now();
+    for(uint i{0}; i<keys.size(); ++i) {
+        fingerTree.insert(keys[i], keys[i]);
+    }
+    elapsedMicroseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "INSERT (finger): " << elapsedMicroseconds.count()/keys.size() << std::endl;
+
+    T hintTree = T();
+    T_NODE hint = nil;
+    start = std::chrono::steady_clock::now();
+    for(uint i{0}; i<keys.size(); ++i) {
+        hint = hintTree.emplaceHint(hint, keys[i], keys[i]);
+    }
+    elapsedMicroseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "INSERT (hint): " << elapsedMicroseconds.count()/keys.size() << std::endl;
+
+    if (rootTree.getNumOfNodes() != keys.size() || fingerTree.getNumOfNodes() != keys.size() || hintTree.getNumOfNodes() != keys.size()) {
+        std::cout << "ERROR: wrong number of nodes" << std::endl;
+    }
+}
+
+void benchmarkStreams(const std::string& name, const std::vector<int>& keys) {
+    std::cout << "--- Chiavi " << name << " ---" << std::endl;
+    std::cout << "1.\t--| AVL Tree |---" << std::endl;
+    benchmarkStream<IntKeyAVLTree, ptr_AVLTreeNode<int, int>>(keys, nullptr);
+    std::cout << "2.\t--| Red Black Tree |---" << std::endl;
+    benchmarkStream<IntKeyRBTree, ptr_RBTreeNode<int, int>>(keys, IntKeyRBTree().getNil());
+}
+
+// sliding window of live keys: every insertion past the window removes the oldest key, then the window is searched
+template <typename T, typename T_NODE>
+void benchmarkExpiration(const std::vector<int>& keys, const uint window) {
+    T tree = T();
+    std::vector<T_NODE> nodes = std::vector<T_NODE>(keys.size());
+
+    auto start = std::chrono::steady_clock::now();
+    for(uint i{0}; i<keys.size(); ++i) {
+        nodes[i] = tree.emplace(keys[i], keys[i]);
+        if (i >= window) {
+            tree.remove(nodes[i - window]);
+        }
+    }
+    std::chrono::duration<double, std::micro> elapsedMicroseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "INSERT + REMOVE: " << elapsedMicroseconds.count()/keys.size() << std::endl;
+
+    uint found{0};
+    start = std::chrono::steady_clock::now();
+    for(uint i = keys.size() - window; i<keys.size(); ++i) {
+        found += tree.search(keys[i]) == nodes[i];
+    }
+    elapsedMicroseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "SEARCH: " << elapsedMicroseconds.count()/window << std::endl;
+
+    if (found != window || tree.getNumOfNodes() != window) {
+        std::cout << "ERROR: missing keys" << std::endl;
+    }
+}
+
+// build a tree from sorted keys with one insertion per key, then in one pass with buildFromSorted
+template <typename T>
+void benchmarkBuild(const std::vector<std::pair<int, int>>& pairs) {
+    auto start = std::chrono::steady_clock::now();
+    T insertedTree = T();
+    for(uint i{0}; i<pairs.size(); ++i) {
+        insertedTree.insert(pairs[i].first, pairs[i].second);
+    }
+    std::chrono::duration<double, std::milli> elapsedMilliseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "INSERT (ms): " << elapsedMilliseconds.count() << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    T builtTree = T::buildFromSorted(pairs.begin(), pairs.end());
+    elapsedMilliseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "BUILD FROM SORTED (ms): " << elapsedMilliseconds.count() << std::endl;
+}
+
+// point lookups on a tree filled with the keys 0..numKeys-1 in random order
+template <typename T, typename T_NODE>
+void benchmarkKeySearch(T& tree, const T_NODE nil, const uint numKeys) {
+    std::vector<int> keys = std::vector<int>(numKeys);
+    for(uint i{0}; i<numKeys; ++i) {
+        keys[i] = i;
+    }
+    std::mt19937 rng(42);
+    std::shuffle(std::begin(keys), std::end(keys), rng);
+    for(uint i{0}; i<numKeys; ++i) {
+        tree.insert(new Intero(keys[i]));
+    }
+    std::shuffle(std::begin(keys), std::end(keys), rng);
+
+    uint found{0};
+    auto start = std::chrono::steady_clock::now();
+    for(uint i{0}; i<numKeys; ++i) {
+        found += tree.search(keys[i]) != nil;
+    }
+    std::chrono::duration<double, std::micro> elapsedMicroseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "SEARCH: " << elapsedMicroseconds.count()/numKeys << std::endl;
+
+    if (found != numKeys) {
+        std::cout << "ERROR: missing keys" << std::endl;
+    }
+}
+
+// point lookups on a frozen snapshot of a tree filled with the keys 0..numKeys-1
+template <typename T>
+void benchmarkFrozenSearch(const T& tree, const uint numKeys) {
+    auto start = std::chrono::steady_clock::now();
+    FrozenTree<int, sptr_TreeNodeObject, Comparator> frozenTree = FrozenTree<int, sptr_TreeNodeObject, Comparator>(tree);
+    std::chrono::duration<double, std::milli> elapsedMilliseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "FREEZE (ms): " << elapsedMilliseconds.count() << std::endl;
+
+    std::vector<int> keys = std::vector<int>(numKeys);
+    for(uint i{0}; i<numKeys; ++i) {
+        keys[i] = i;
+    }
+    std::mt19937 rng(42);
+    std::shuffle(std::begin(keys), std::end(keys), rng);
+
+    uint found{0};
+    start = std::chrono::steady_clock::now();
+    for(uint i{0}; i<numKeys; ++i) {
+        found += frozenTree.search(keys[i]) != frozenTree.getNil();
+    }
+    std::chrono::duration<double, std::micro> elapsedMicroseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "SEARCH (frozen): " << elapsedMicroseconds.count()/numKeys << std::endl;
+
+    if (found != numKeys) {
+        std::cout << "ERROR: missing keys" << std::endl;
+    }
+}
 
 int main(int argc, char** argv) {
     const uint iterations = 25000;
 
     std::cout << "Benchmark dei tre diversi alberi (BST, AVL, RB) con " << iterations << " iterazioni" << std::endl;
+    std::cout << "Dimensione dei nodi con chiave e valore int (byte): BST e scapegoat " << sizeof(TreeNode<int, int>) << ", AVL " << sizeof(AVLTreeNode<int, int>)
+              << ", RB " << sizeof(RBTreeNode<int, int>) << ", treap " << sizeof(TreapNode<int, int>) << ", compatto " << sizeof(CompactTreeNode<int, int>)
+              << ", senza padre " << sizeof(PathTreeNode<int, int>) << std::endl;
 
-    BinarySearchTree<comparator> binarySearchTree = BinarySearchTree<comparator>();
-    AVLTree<comparator> avlTree = AVLTree<comparator>();
-    RBTree<comparator> rbTree = RBTree<comparator>();
+    IntBinarySearchTree binarySearchTree = IntBinarySearchTree();
+    IntAVLTree avlTree = IntAVLTree();
+    IntRBTree rbTree = IntRBTree();
+    IntWAVLTree wavlTree = IntWAVLTree();
+    IntScapegoatTree scapegoatTree = IntScapegoatTree();
+    IntTreap treap = IntTreap();
 
     std::cout << "1.\t--| Binary Search Tree |---" << std::endl;
-    benchmark<BinarySearchTree<comparator>, sptr_TreeNode, Intero>(binarySearchTree, iterations);
+    benchmark<IntBinarySearchTree, ptr_TreeNode<int, sptr_TreeNodeObject>, Intero>(binarySearchTree, iterations);
     std::cout << "2.\t--| AVL Tree |---" << std::endl;
-    benchmark<AVLTree<comparator>, sptr_AVLTreeNode, Intero>(avlTree, iterations);
+    benchmark<IntAVLTree, ptr_AVLTreeNode<int, sptr_TreeNodeObject>, Intero>(avlTree, iterations);
     std::cout << "3.\t--| Red Black Tree |---" << std::endl;
-    benchmark<RBTree<comparator>, sptr_RBTreeNode, Intero>(rbTree, iterations);
+    benchmark<IntRBTree, ptr_RBTreeNode<int, sptr_TreeNodeObject>, Intero>(rbTree, iterations);
+    std::cout << "4.\t--| WAVL Tree |---" << std::endl;
+    benchmark<IntWAVLTree, ptr_WAVLTreeNode<int, sptr_TreeNodeObject>, Intero>(wavlTree, iterations);
+    std::cout << "5.\t--| Scapegoat Tree |---" << std::endl;
+    benchmark<IntScapegoatTree, ptr_TreeNode<int, sptr_TreeNodeObject>, Intero>(scapegoatTree, iterations);
+    std::cout << "6.\t--| Treap |---" << std::endl;
+    benchmark<IntTreap, ptr_TreapNode<int, sptr_TreeNodeObject>, Intero>(treap, iterations);
+
+    SlabIntAVLTree slabAvlTree = SlabIntAVLTree();
+    SlabIntRBTree slabRbTree = SlabIntRBTree();
+
+    std::cout << "7.\t--| AVL Tree (slab allocator) |---" << std::endl;
+    benchmark<SlabIntAVLTree, ptr_AVLTreeNode<int, sptr_TreeNodeObject>, Intero>(slabAvlTree, iterations);
+    std::cout << "8.\t--| Red Black Tree (slab allocator) |---" << std::endl;
+    benchmark<SlabIntRBTree, ptr_RBTreeNode<int, sptr_TreeNodeObject>, Intero>(slabRbTree, iterations);
+
+    CompactIntAVLTree compactAvlTree = CompactIntAVLTree();
+    CompactIntRBTree compactRbTree = CompactIntRBTree();
+
+    std::cout << "9.\t--| AVL Tree (compact, 32-bit indices) |---" << std::endl;
+    benchmark<CompactIntAVLTree, CompactIndex, Intero>(compactAvlTree, iterations);
+    std::cout << "10.\t--| Red Black Tree (compact, 32-bit indices) |---" << std::endl;
+    benchmark<CompactIntRBTree, CompactIndex, Intero>(compactRbTree, iterations);
+
+    PathIntAVLTree pathAvlTree = PathIntAVLTree();
+    PathIntRBTree pathRbTree = PathIntRBTree();
+
+    std::cout << "11.\t--| AVL Tree (no parent links) |---" << std::endl;
+    benchmark<PathIntAVLTree, ptr_PathTreeNode<int, sptr_TreeNodeObject>, Intero>(pathAvlTree, iterations);
+    std::cout << "12.\t--| Red Black Tree (no parent links) |---" << std::endl;
+    benchmark<PathIntRBTree, ptr_PathTreeNode<int, sptr_TreeNodeObject>, Intero>(pathRbTree, iterations);
+
+    IntBPlusTree bPlusTree = IntBPlusTree();
+
+    std::cout << "13.\t--| B+ Tree (fan-out 32) |---" << std::endl;
+    benchmarkByKey<IntBPlusTree, sptr_TreeNodeObject*, Intero>(bPlusTree, iterations);
+
+    std::cout << std::endl << "Inserimento con valori nei nodi (emplace) con " << iterations << " iterazioni" << std::endl;
+
+    RecordAVLTree recordAvlTree = RecordAVLTree();
+    RecordRBTree recordRbTree = RecordRBTree();
+    SlabRecordAVLTree slabRecordAvlTree = SlabRecordAVLTree();
+    SlabRecordRBTree slabRecordRbTree = SlabRecordRBTree();
+
+    std::cout << "1.\t--| AVL Tree |---" << std::endl;
+    benchmarkEmplace<RecordAVLTree>(recordAvlTree, iterations);
+    std::cout << "2.\t--| Red Black Tree |---" << std::endl;
+    benchmarkEmplace<RecordRBTree>(recordRbTree, iterations);
+    std::cout << "3.\t--| AVL Tree (slab allocator) |---" << std::endl;
+    benchmarkEmplace<SlabRecordAVLTree>(slabRecordAvlTree, iterations);
+    std::cout << "4.\t--| Red Black Tree (slab allocator) |---" << std::endl;
+    benchmarkEmplace<SlabRecordRBTree>(slabRecordRbTree, iterations);
+
+    CompactRecordAVLTree compactRecordAvlTree = CompactRecordAVLTree();
+    CompactRecordRBTree compactRecordRbTree = CompactRecordRBTree();
+
+    std::cout << "5.\t--| AVL Tree (compact) |---" << std::endl;
+    benchmarkEmplace<CompactRecordAVLTree>(compactRecordAvlTree, iterations);
+    std::cout << "6.\t--| Red Black Tree (compact) |---" << std::endl;
+    benchmarkEmplace<CompactRecordRBTree>(compactRecordRbTree, iterations);
+
+    const uint latencyKeys = 1000000;
+    std::cout << std::endl << "Latenza della ricerca con " << latencyKeys << " chiavi" << std::endl;
+
+    IntAVLTree latencyAvlTree = IntAVLTree();
+    IntRBTree latencyRbTree = IntRBTree();
+
+    std::cout << "1.\t--| AVL Tree |---" << std::endl;
+    benchmarkSearchLatency<IntAVLTree, ptr_AVLTreeNode<int, sptr_TreeNodeObject>>(latencyAvlTree, nullptr, latencyKeys);
+    std::cout << "2.\t--| Red Black Tree |---" << std::endl;
+    benchmarkSearchLatency<IntRBTree, ptr_RBTreeNode<int, sptr_TreeNodeObject>>(latencyRbTree, latencyRbTree.getNil(), latencyKeys);
+    std::cout << "3.\t--| AVL Tree (frozen, Eytzinger layout) |---" << std::endl;
+    benchmarkFrozenSearch<IntAVLTree>(latencyAvlTree, latencyKeys);
+
+    IntBPlusTree latencyBPlusTree = IntBPlusTree();
+
+    std::cout << "4.\t--| B+ Tree (fan-out 32) |---" << std::endl;
+    benchmarkKeySearch<IntBPlusTree, sptr_TreeNodeObject*>(latencyBPlusTree, nullptr, latencyKeys);
+
+    std::cout << std::endl << "Costruzione da chiavi ordinate con " << latencyKeys << " chiavi" << std::endl;
+
+    std::vector<std::pair<int, int>> sortedPairs = std::vector<std::pair<int, int>>(latencyKeys);
+    for(uint i{0}; i<latencyKeys; ++i) {
+        sortedPairs[i] = std::make_pair(static_cast<int>(i), static_cast<int>(i));
+    }
+    std::cout << "1.\t--| AVL Tree |---" << std::endl;
+    benchmarkBuild<IntKeyAVLTree>(sortedPairs);
+    std::cout << "2.\t--| Red Black Tree |---" << std::endl;
+    benchmarkBuild<IntKeyRBTree>(sortedPairs);
+
+    std::cout << std::endl << "Inserimento e rimozione a blocchi in alberi con " << latencyKeys << " chiavi" << std::endl;
+
+    const uint batchSizes[] = {1000, 50000, 500000};
+    for(uint batchSize : batchSizes) {
+        std::cout << "--- Blocchi di " << batchSize << " chiavi ---" << std::endl;
+        std::cout << "1.\t--| AVL Tree |---" << std::endl;
+        benchmarkBatch<IntKeyAVLTree>(latencyKeys, batchSize);
+        std::cout << "2.\t--| Red Black Tree |---" << std::endl;
+        benchmarkBatch<IntKeyRBTree>(latencyKeys, batchSize);
+    }
+
+    std::cout << std::endl << "Statistiche d'ordine con " << latencyKeys << " chiavi (nodi con dimensione del sottoalbero: AVL "
+              << sizeof(AVLTreeNode<int, int, SubtreeSize>) << " byte, RB " << sizeof(RBTreeNode<int, int, SubtreeSize>) << " byte)" << std::endl;
+    std::cout << "1.\t--| AVL Tree |---" << std::endl;
+    benchmarkOrderStatistics<RankAVLTree, ptr_TreeNode<int, int>>(latencyKeys, nullptr);
+    std::cout << "2.\t--| Red Black Tree |---" << std::endl;
+    benchmarkOrderStatistics<RankRBTree, ptr_TreeNode<int, int>>(latencyKeys, RankRBTree().getNil());
+
+    std::cout << std::endl << "Somme su intervalli di chiavi con " << latencyKeys << " chiavi (nodi con somma del sottoalbero: AVL "
+              << sizeof(AVLTreeNode<int, int, MonoidAugmentation<SumOfValues<long long>>>) << " byte, RB "
+              << sizeof(RBTreeNode<int, int, MonoidAugmentation<SumOfValues<long long>>>) << " byte)" << std::endl;
+    std::cout << "1.\t--| AVL Tree |---" << std::endl;
+    benchmarkRangeAggregate<SumAVLTree, ptr_TreeNode<int, int>>(latencyKeys, nullptr);
+    std::cout << "2.\t--| Red Black Tree |---" << std::endl;
+    benchmarkRangeAggregate<SumRBTree, ptr_TreeNode<int, int>>(latencyKeys, SumRBTree().getNil());
+
+    const uint rangeSize = 100;
+    std::cout << std::endl << "Scansioni di " << rangeSize << " chiavi consecutive con " << latencyKeys << " chiavi" << std::endl;
+    std::cout << "1.\t--| AVL Tree |---" << std::endl;
+    benchmarkRangeScan<IntKeyAVLTree>(latencyKeys, rangeSize);
+    std::cout << "2.\t--| Red Black Tree |---" << std::endl;
+    benchmarkRangeScan<IntKeyRBTree>(latencyKeys, rangeSize);
+
+    const uint sweepSize = 10000;
+    std::cout << std::endl << "Rimozione di " << latencyKeys << " chiavi a blocchi di " << sweepSize << " chiavi consecutive (ms)" << std::endl;
+    std::cout << "1.\t--| AVL Tree |---" << std::endl;
+    benchmarkEraseRange<IntKeyAVLTree>(latencyKeys, sweepSize);
+    std::cout << "2.\t--| Red Black Tree |---" << std::endl;
+    benchmarkEraseRange<IntKeyRBTree>(latencyKeys, sweepSize);
+    std::cout << "3.\t--| Treap |---" << std::endl;
+    benchmarkEraseRange<IntKeyTreap>(latencyKeys, sweepSize);
+
+    std::cout << std::endl << "Intervalli sovrapposti con " << latencyKeys << " intervalli (nodi di "
+              << sizeof(RBTreeNode<int, IntervalData<int, int>, MonoidAugmentation<MaxEndpoint<int, int>>>) << " byte)" << std::endl;
+    std::cout << "1.\t--| Interval Tree |---" << std::endl;
+    benchmarkIntervals<IntIntervalTree>(latencyKeys);
+
+    const uint setKeys = 4000000;
+    ThreadPool pool;
+    std::cout << std::endl << "Unione, intersezione e differenza di alberi con " << setKeys << " e " << 3*setKeys/2
+              << " chiavi (" << pool.getNumOfThreads() << " thread, ms)" << std::endl;
+    std::cout << "1.\t--| AVL Tree |---" << std::endl;
+    benchmarkSetOperations<IntKeyAVLTree, ptr_AVLTreeNode<int, int>>(setKeys, nullptr, pool);
+    std::cout << "2.\t--| Red Black Tree |---" << std::endl;
+    benchmarkSetOperations<IntKeyRBTree, ptr_RBTreeNode<int, int>>(setKeys, IntKeyRBTree().getNil(), pool);
+
+    std::cout << std::endl << "Inserimento di flussi di " << latencyKeys << " chiavi" << std::endl;
+    std::vector<int> stream = std::vector<int>(latencyKeys);
+    for(uint i{0}; i<latencyKeys; ++i) {
+        stream[i] = i;
+    }
+    benchmarkStreams("sequenziali", stream);
+    std::mt19937 streamRng(42);
+    for(uint i{0}; i+1<latencyKeys; ++i) {
+        if (streamRng() % 4 == 0) { // a quarter of the keys arrive a few positions late
+            std::swap(stream[i], stream[std::min<uint>(latencyKeys - 1, i + 1 + streamRng() % 16)]);
+        }
+    }
+    benchmarkStreams("quasi ordinate", stream);
+    std::shuffle(std::begin(stream), std::end(stream), streamRng);
+    benchmarkStreams("casuali", stream);
+
+    const uint window = 100000;
+    std::cout << std::endl << "Finestra scorrevole di " << window << " chiavi su " << latencyKeys << " inserimenti" << std::endl;
+    std::shuffle(std::begin(stream), std::end(stream), streamRng);
+    std::cout << "1.\t--| AVL Tree |---" << std::endl;
+    benchmarkExpiration<IntKeyAVLTree, ptr_AVLTreeNode<int, int>>(stream, window);
+    std::cout << "2.\t--| Red Black Tree |---" << std::endl;
+    benchmarkExpiration<IntKeyRBTree, ptr_RBTreeNode<int, int>>(stream, window);
+    std::cout << "3.\t--| WAVL Tree |---" << std::endl;
+    benchmarkExpiration<IntKeyWAVLTree, ptr_WAVLTreeNode<int, int>>(stream, window);
+
+    const uint zipfLookups = 1000000;
+    const double skews[] = {0.0, 0.8, 1.0, 1.2};
+    std::cout << std::endl << "Ricerche con distribuzione di Zipf di " << zipfLookups << " chiavi su " << latencyKeys << " chiavi" << std::endl;
+    for(double skew : skews) {
+        std::cout << "--- Esponente " << skew << " ---" << std::endl;
+        std::cout << "1.\t--| AVL Tree |---" << std::endl;
+        benchmarkZipfSearch<IntKeyAVLTree, ptr_AVLTreeNode<int, int>>(latencyKeys, zipfLookups, skew, nullptr);
+        std::cout << "2.\t--| Red Black Tree |---" << std::endl;
+        benchmarkZipfSearch<IntKeyRBTree, ptr_RBTreeNode<int, int>>(latencyKeys, zipfLookups, skew, IntKeyRBTree().getNil());
+        std::cout << "3.\t--| Splay Tree |---" << std::endl;
+        benchmarkZipfSearch<IntKeySplayTree, ptr_TreeNode<int, int>>(latencyKeys, zipfLookups, skew, nullptr);
+    }
+
+    std::cout << std::endl << "Distribuzioni delle chiavi con " << iterations << " chiavi" << std::endl;
+
+    std::mt19937 rng(42);
+    std::vector<int> keys = std::vector<int>(iterations);
+    for(uint i{0}; i<iterations; ++i) {
+        keys[i] = i;
+    }
+    benchmarkDistributions("sequenziali", keys);
+
+    for(uint i{0}; i<iterations; ++i) {
+        keys[i] = static_cast<int>(i * 2654435761u); // distinct keys spread over the whole range
+    }
+    std::shuffle(std::begin(keys), std::end(keys), rng);
+    benchmarkDistributions("casuali", keys);
+
+    const uint clusterSize = 256;
+    for(uint i{0}; i<iterations; i += clusterSize) {
+        int base = static_cast<int>((i / clusterSize) * (1u << 21) + (rng() & 0xffffu)); // runs of consecutive keys far from each other
+        for(uint j{i}; j<iterations && j<i+clusterSize; ++j) {
+            keys[j] = base + (j - i);
+        }
+    }
+    std::shuffle(std::begin(keys), std::end(keys), rng);
+    benchmarkDistributions("raggruppate", keys);
 
     return 0;
 }
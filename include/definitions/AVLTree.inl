@@ -10,118 +10,513 @@
  */
 
 #include <iostream>
+#include <iterator>
 #include "AVLTree.hpp"
 
 // constuctors and destructors
-template <bool CMP(const int& key1, const int& key2)>
-AVLTree<CMP>::AVLTree() {}
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+AVLTree<Key, Value, Compare, Alloc, Augment>::AVLTree(const Compare& comp, const Alloc& alloc)
+: SelfBalancingTree<Key, Value, Compare, Alloc, AVLTreeNode<Key, Value, Augment>>{comp, alloc} {}
 
-template <bool CMP(const int& key1, const int& key2)>
-AVLTree<CMP>::AVLTree(sptr_AVLTreeNode root)
-: SelfBalancingTree<CMP>{root} {}
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+AVLTree<Key, Value, Compare, Alloc, Augment>::AVLTree(ptr_AVLTreeNode<Key, Value, Augment> root, const Compare& comp, const Alloc& alloc)
+: SelfBalancingTree<Key, Value, Compare, Alloc, AVLTreeNode<Key, Value, Augment>>{root, comp, alloc} {}
 
-template <bool CMP(const int& key1, const int& key2)>
-AVLTree<CMP>::~AVLTree() = default;
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+AVLTree<Key, Value, Compare, Alloc, Augment>::~AVLTree() = default;
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+template <typename Iterator>
+AVLTree<Key, Value, Compare, Alloc, Augment> AVLTree<Key, Value, Compare, Alloc, Augment>::buildFromSorted(Iterator first, Iterator last, const Compare& comp, const Alloc& alloc) {
+    AVLTree tree(comp, alloc);
+    tree.buildBalanced(first, std::distance(first, last), annotateBalanced);
+    return tree;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void AVLTree<Key, Value, Compare, Alloc, Augment>::annotateBalanced(AVLTreeNode<Key, Value, Augment>* node, unsigned int, int balance, unsigned int, int) {
+    node->setBalance(balance);
+}
 
 // getters
-template <bool CMP(const int& key1, const int& key2)>
-sptr_AVLTreeNode AVLTree<CMP>::getRoot() const {
-    return std::static_pointer_cast<AVLTreeNode>(this->root);
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+ptr_AVLTreeNode<Key, Value, Augment> AVLTree<Key, Value, Compare, Alloc, Augment>::getRoot() const {
+    return static_cast<ptr_AVLTreeNode<Key, Value, Augment>>(this->root);
 }
 
 // core functions
-template <bool CMP(const int& key1, const int& key2)>
-void AVLTree<CMP>::insert(sptr_AVLTreeNode&& node) {
-    BinarySearchTree<CMP>::insert(node); 
-    while (node != this->nullValue) { // fix after insertion
-        updateHeight(node);
-        if (balance(node)) { // the tree requires rebalancing only once
-            break;
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void AVLTree<Key, Value, Compare, Alloc, Augment>::insert(ptr_AVLTreeNode<Key, Value, Augment> node) {
+    BinarySearchTree<Key, Value, Compare, Alloc, AVLTreeNode<Key, Value, Augment>>::insert(node);
+    fixAfterInsert(node);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+bool AVLTree<Key, Value, Compare, Alloc, Augment>::fixAfterInsert(ptr_AVLTreeNode<Key, Value, Augment> node) {
+    ptr_AVLTreeNode<Key, Value, Augment> parent = node->getParent();
+    while (parent != this->nullValue) { // fix after insertion, the subtree of node has grown by one
+        int parentBalance = parent->getBalance() + ((node == parent->getLeft()) ? 1 : -1);
+        if (parentBalance == 0) { // the height of parent did not change
+            parent->setBalance(0);
+            return false;
+        } else if (parentBalance == 2 || parentBalance == -2) { // the tree requires rebalancing only once
+            balance(parent, parentBalance);
+            return false;
         }
-        node = node->getParent();
+        parent->setBalance(parentBalance);
+        node = parent;
+        parent = parent->getParent();
     }
+    return true; // the whole tree has grown by one
 }
-template <bool CMP(const int& key1, const int& key2)>
-void AVLTree<CMP>::insert(sptr_TreeNodeObject&& obj) {
-    insert(std::make_shared<AVLTreeNode>(obj));
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void AVLTree<Key, Value, Compare, Alloc, Augment>::insert(const Key& key, const Value& value) {
+    emplace(key, value);
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-void AVLTree<CMP>::insert(TreeNodeObject* obj) {
-    insert(std::shared_ptr<TreeNodeObject>(obj));
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void AVLTree<Key, Value, Compare, Alloc, Augment>::insert(const Key& key, Value&& value) {
+    emplace(key, std::move(value));
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-sptr_AVLTreeNode AVLTree<CMP>::search(int key) {
-    sptr_TreeNode node = BinarySearchTree<CMP>::search(key);
-    return std::static_pointer_cast<AVLTreeNode>(node);
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+template <typename... Args>
+ptr_AVLTreeNode<Key, Value, Augment> AVLTree<Key, Value, Compare, Alloc, Augment>::emplace(const Key& key, Args&&... args) {
+    ptr_AVLTreeNode<Key, Value, Augment> node = this->createNode(key, std::forward<Args>(args)...);
+    insert(node);
+    return node;
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-void AVLTree<CMP>::remove(sptr_AVLTreeNode node) {
-    sptr_AVLTreeNode deletedNodeAncestor = std::static_pointer_cast<AVLTreeNode>(BinarySearchTree<CMP>::remove(node));
-    while (deletedNodeAncestor != this->nullValue) { // fix after deletion
-        updateHeight(deletedNodeAncestor);
-        balance(deletedNodeAncestor);
-        deletedNodeAncestor = deletedNodeAncestor->getParent();
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void AVLTree<Key, Value, Compare, Alloc, Augment>::insert(TreeNodeObject* obj) {
+    emplace(obj->getKey(), this->shareObject(obj));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+template <typename... Args>
+ptr_AVLTreeNode<Key, Value, Augment> AVLTree<Key, Value, Compare, Alloc, Augment>::emplaceHint(ptr_AVLTreeNode<Key, Value, Augment> hint, const Key& key, Args&&... args) {
+    ptr_AVLTreeNode<Key, Value, Augment> node = this->createNode(key, std::forward<Args>(args)...);
+    this->insertNear(hint, node);
+    fixAfterInsert(node);
+    return node;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+ptr_AVLTreeNode<Key, Value, Augment> AVLTree<Key, Value, Compare, Alloc, Augment>::insert(ptr_AVLTreeNode<Key, Value, Augment> hint, TreeNodeObject* obj) {
+    return emplaceHint(hint, obj->getKey(), this->shareObject(obj));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void AVLTree<Key, Value, Compare, Alloc, Augment>::insertBatch(std::vector<std::pair<Key, Value>> batch) {
+    if (this->mergeBatch(batch, annotateBalanced)) {
+        return;
+    }
+    ptr_AVLTreeNode<Key, Value, Augment> hint = nullptr;
+    for (typename std::vector<std::pair<Key, Value>>::iterator it = batch.begin(); it != batch.end(); ++it) {
+        ptr_AVLTreeNode<Key, Value, Augment> node = this->createNode(it->first, std::move(it->second));
+        this->insertNear(hint, node);
+        fixAfterInsert(node);
+        hint = node;
     }
 }
 
-// fixers 
-template <bool CMP(const int& key1, const int& key2)>
-void AVLTree<CMP>::updateHeight(sptr_AVLTreeNode& node) {
-    int leftHeight = (node->getLeft() == this->nullValue) ? -1 : node->getLeft()->getHeight();
-    int rightHeight = (node->getRight() == this->nullValue) ? -1 : node->getRight()->getHeight();
-    node->setHeight(std::max(leftHeight, rightHeight) + 1);
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void AVLTree<Key, Value, Compare, Alloc, Augment>::insertBatch(const std::vector<TreeNodeObject*>& objects) {
+    std::vector<std::pair<Key, Value>> batch;
+    batch.reserve(objects.size());
+    for (TreeNodeObject* obj : objects) {
+        batch.emplace_back(obj->getKey(), this->shareObject(obj));
+    }
+    insertBatch(std::move(batch));
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-int AVLTree<CMP>::balanceFactor(sptr_AVLTreeNode node) { 
-    if (node == this->nullValue)
-        return 0;
-    int leftHeight = (node->getLeft() == this->nullValue) ? -1 : node->getLeft()->getHeight();
-    int rightHeight = (node->getRight() == this->nullValue) ? -1 : node->getRight()->getHeight();
-    
-    return leftHeight - rightHeight;
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+ptr_AVLTreeNode<Key, Value, Augment> AVLTree<Key, Value, Compare, Alloc, Augment>::search(const Key& key) const {
+    return static_cast<ptr_AVLTreeNode<Key, Value, Augment>>(BinarySearchTree<Key, Value, Compare, Alloc, AVLTreeNode<Key, Value, Augment>>::search(key));
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-bool AVLTree<CMP>::balance(sptr_AVLTreeNode& node) { 
-    if (balanceFactor(node) == 2) {
-        if (balanceFactor(node->getLeft()) == -1) { 
-            rotateLeft(node->getLeft());
-            rotateRight(node);
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+ptr_AVLTreeNode<Key, Value, Augment> AVLTree<Key, Value, Compare, Alloc, Augment>::select(unsigned int index) const {
+    return static_cast<ptr_AVLTreeNode<Key, Value, Augment>>(BinarySearchTree<Key, Value, Compare, Alloc, AVLTreeNode<Key, Value, Augment>>::select(index));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void AVLTree<Key, Value, Compare, Alloc, Augment>::remove(ptr_AVLTreeNode<Key, Value, Augment> node) {
+    detach(node);
+    this->destroyNode(node);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+bool AVLTree<Key, Value, Compare, Alloc, Augment>::erase(const Key& key) {
+    ptr_AVLTreeNode<Key, Value, Augment> node = search(key);
+    if (node == nullptr) {
+        return false;
+    }
+    remove(node);
+    return true;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+unsigned int AVLTree<Key, Value, Compare, Alloc, Augment>::eraseRange(const Key& lo, const Key& hi) {
+    if (this->comp(hi, lo) || this->isEmpty()) {
+        return 0;
+    }
+    ptr_AVLTreeNode<Key, Value, Augment> left = nullptr;
+    ptr_AVLTreeNode<Key, Value, Augment> rest = nullptr;
+    int leftHeight{0};
+    int restHeight{0};
+    splitSubtree(getRoot(), height(getRoot()), lo, left, leftHeight, rest, restHeight);
+    // the first key past hi, the keys equal to it are all past the range
+    ptr_AVLTreeNode<Key, Value, Augment> bound = nullptr;
+    for (ptr_AVLTreeNode<Key, Value, Augment> node = rest; node != nullptr; ) {
+        if (this->comp(hi, node->getKey())) {
+            bound = node;
+            node = node->getLeft();
         } else {
-            rotateRight(node);
+            node = node->getRight();
+        }
+    }
+    ptr_AVLTreeNode<Key, Value, Augment> middle = rest;
+    ptr_AVLTreeNode<Key, Value, Augment> right = nullptr;
+    int middleHeight{restHeight};
+    int rightHeight{0};
+    if (bound != nullptr) {
+        splitSubtree(rest, restHeight, bound->getKey(), middle, middleHeight, right, rightHeight);
+    }
+    unsigned int count = this->destroySubtree(middle);
+    unsigned int numOfNodes = this->numOfNodes; // the pivot of the join is detached and relinked
+    int joinedHeight{0};
+    this->root = join2Subtrees(left, leftHeight, right, rightHeight, joinedHeight);
+    this->numOfNodes = this->countStale ? numOfNodes : numOfNodes - count;
+    return count;
+}
+
+// unlink the node from the tree and restore the balance, without freeing it
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void AVLTree<Key, Value, Compare, Alloc, Augment>::detach(ptr_AVLTreeNode<Key, Value, Augment> node) {
+    // find where the tree loses height: the parent of the node if it has at most one child,
+    // otherwise the old parent of the successor, which takes the place (and the balance) of the node
+    ptr_AVLTreeNode<Key, Value, Augment> parent = node->getParent();
+    bool fromLeft = parent != this->nullValue && node == parent->getLeft();
+    if (node->getLeft() != this->nullValue && node->getRight() != this->nullValue) {
+        ptr_AVLTreeNode<Key, Value, Augment> successor = static_cast<ptr_AVLTreeNode<Key, Value, Augment>>(this->minimum(node->getRight()));
+        fromLeft = successor->getParent() != node;
+        parent = fromLeft ? successor->getParent() : successor;
+        successor->setBalance(node->getBalance());
+    }
+    this->unlink(node);
+    fixAfterRemove(parent, fromLeft);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+AVLTree<Key, Value, Compare, Alloc, Augment> AVLTree<Key, Value, Compare, Alloc, Augment>::join(AVLTree&& left, const Key& key, Value value, AVLTree&& right) {
+    left.requireSameAllocator(right);
+    AVLTree tree(std::move(left));
+    tree.join(tree.createNode(key, std::move(value)), right);
+    return tree;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+AVLTree<Key, Value, Compare, Alloc, Augment> AVLTree<Key, Value, Compare, Alloc, Augment>::join(AVLTree&& left, AVLTree&& right) {
+    left.requireSameAllocator(right);
+    AVLTree tree(std::move(left));
+    if (!right.isEmpty()) {
+        ptr_AVLTreeNode<Key, Value, Augment> pivot = static_cast<ptr_AVLTreeNode<Key, Value, Augment>>(right.minimum());
+        right.detach(pivot);
+        tree.join(pivot, right);
+    }
+    return tree;
+}
+
+// join this tree, pivot and the nodes of right into this tree
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void AVLTree<Key, Value, Compare, Alloc, Augment>::join(ptr_AVLTreeNode<Key, Value, Augment> pivot, AVLTree& right) {
+    ptr_AVLTreeNode<Key, Value, Augment> leftRoot = getRoot();
+    ptr_AVLTreeNode<Key, Value, Augment> rightRoot = right.getRoot();
+    int joinedHeight{0};
+    this->takeNodes(right);
+    ++(this->numOfNodes);
+    joinSubtrees(leftRoot, height(leftRoot), pivot, rightRoot, height(rightRoot), joinedHeight);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+std::pair<AVLTree<Key, Value, Compare, Alloc, Augment>, AVLTree<Key, Value, Compare, Alloc, Augment>> AVLTree<Key, Value, Compare, Alloc, Augment>::split(const Key& key) {
+    ptr_AVLTreeNode<Key, Value, Augment> leftRoot = nullptr;
+    ptr_AVLTreeNode<Key, Value, Augment> rightRoot = nullptr;
+    int leftHeight{0};
+    int rightHeight{0};
+    splitSubtree(getRoot(), height(getRoot()), key, leftRoot, leftHeight, rightRoot, rightHeight);
+
+    std::pair<AVLTree, AVLTree> halves(AVLTree(this->comp, Alloc(this->nodeAllocator)), AVLTree(this->comp, Alloc(this->nodeAllocator)));
+    halves.first.root = leftRoot;
+    halves.second.root = rightRoot;
+    halves.first.countStale = halves.second.countStale = true;
+    halves.first.blocks = this->blocks;
+    halves.second.blocks = std::move(this->blocks);
+    this->blocks.clear();
+    this->resetFinger();
+    this->root = this->nullValue;
+    this->numOfNodes = 0;
+    this->countStale = false;
+    return halves;
+}
+
+// the height of a subtree, following the balance factors down the taller side
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+int AVLTree<Key, Value, Compare, Alloc, Augment>::height(ptr_AVLTreeNode<Key, Value, Augment> node) const {
+    int nodeHeight{0};
+    while (node != this->nullValue) {
+        ++nodeHeight;
+        node = (node->getBalance() < 0) ? node->getRight() : node->getLeft();
+    }
+    return nodeHeight;
+}
+
+// link left, pivot and right (keys in this order) into one subtree, which becomes the root of the tree; the pivot
+// replaces the first node on the inner spine of the taller subtree that is at most one level taller than the other
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+ptr_AVLTreeNode<Key, Value, Augment> AVLTree<Key, Value, Compare, Alloc, Augment>::joinSubtrees(ptr_AVLTreeNode<Key, Value, Augment> left, int leftHeight, ptr_AVLTreeNode<Key, Value, Augment> pivot, ptr_AVLTreeNode<Key, Value, Augment> right, int rightHeight, int& height) {
+    if (leftHeight - rightHeight <= 1 && rightHeight - leftHeight <= 1) {
+        pivot->setLeft(left);
+        pivot->setRight(right);
+        pivot->setParent(this->nullValue);
+        pivot->setBalance(leftHeight - rightHeight);
+        if (left != this->nullValue) {
+            left->setParent(pivot);
         }
-        return true;
-    } else if (balanceFactor(node) == -2) {
-        if (balanceFactor(node->getRight()) == 1) {
-            rotateRight(node->getRight());
-            rotateLeft(node);
+        if (right != this->nullValue) {
+            right->setParent(pivot);
+        }
+        this->updateNode(pivot);
+        this->root = pivot;
+        height = std::max(leftHeight, rightHeight) + 1;
+        return pivot;
+    }
+    bool leftTaller = leftHeight > rightHeight;
+    ptr_AVLTreeNode<Key, Value, Augment> taller = leftTaller ? left : right;
+    ptr_AVLTreeNode<Key, Value, Augment> shorter = leftTaller ? right : left;
+    int tallerHeight = leftTaller ? leftHeight : rightHeight;
+    int shorterHeight = leftTaller ? rightHeight : leftHeight;
+    ptr_AVLTreeNode<Key, Value, Augment> parent = nullptr;
+    ptr_AVLTreeNode<Key, Value, Augment> curr = taller;
+    int currHeight = tallerHeight;
+    while (currHeight > shorterHeight + 1) {
+        int currBalance = leftTaller ? curr->getBalance() : -curr->getBalance(); // positive if the outer side is taller
+        currHeight -= (currBalance > 0) ? 2 : 1;
+        parent = curr;
+        curr = leftTaller ? curr->getRight() : curr->getLeft();
+    }
+    taller->setParent(this->nullValue);
+    this->root = taller;
+    pivot->setParent(parent);
+    if (leftTaller) {
+        parent->setRight(pivot);
+        pivot->setLeft(curr);
+        pivot->setRight(shorter);
+        pivot->setBalance(currHeight - shorterHeight);
+    } else {
+        parent->setLeft(pivot);
+        pivot->setLeft(shorter);
+        pivot->setRight(curr);
+        pivot->setBalance(shorterHeight - currHeight);
+    }
+    if (curr != this->nullValue) {
+        curr->setParent(pivot);
+    }
+    if (shorter != this->nullValue) {
+        shorter->setParent(pivot);
+    }
+    this->updatePath(pivot);
+    height = tallerHeight + (fixAfterInsert(pivot) ? 1 : 0); // the pivot is one level taller than the node it replaced
+    return getRoot();
+}
+
+// split the subtree of node into the subtree of the keys less than key and the one of the others; if found is given,
+// a node with the key is left out of both and stored there
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void AVLTree<Key, Value, Compare, Alloc, Augment>::splitSubtree(ptr_AVLTreeNode<Key, Value, Augment> node, int nodeHeight, const Key& key, ptr_AVLTreeNode<Key, Value, Augment>& left, int& leftHeight, ptr_AVLTreeNode<Key, Value, Augment>& right, int& rightHeight, ptr_AVLTreeNode<Key, Value, Augment>* found) {
+    if (node == this->nullValue) {
+        left = right = node;
+        leftHeight = rightHeight = 0;
+        return;
+    }
+    ptr_AVLTreeNode<Key, Value, Augment> nodeLeft = node->getLeft();
+    ptr_AVLTreeNode<Key, Value, Augment> nodeRight = node->getRight();
+    int nodeLeftHeight = nodeHeight - ((node->getBalance() < 0) ? 2 : 1);
+    int nodeRightHeight = nodeHeight - ((node->getBalance() > 0) ? 2 : 1);
+    if (this->comp(node->getKey(), key)) { // node and its left subtree go left
+        ptr_AVLTreeNode<Key, Value, Augment> middle = nullptr;
+        int middleHeight{0};
+        splitSubtree(nodeRight, nodeRightHeight, key, middle, middleHeight, right, rightHeight, found);
+        left = joinSubtrees(nodeLeft, nodeLeftHeight, node, middle, middleHeight, leftHeight);
+    } else if (found != nullptr && !this->comp(key, node->getKey())) {
+        left = nodeLeft;
+        leftHeight = nodeLeftHeight;
+        right = nodeRight;
+        rightHeight = nodeRightHeight;
+        *found = node;
+    } else {
+        ptr_AVLTreeNode<Key, Value, Augment> middle = nullptr;
+        int middleHeight{0};
+        splitSubtree(nodeLeft, nodeLeftHeight, key, left, leftHeight, middle, middleHeight, found);
+        right = joinSubtrees(middle, middleHeight, node, nodeRight, nodeRightHeight, rightHeight);
+    }
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+int AVLTree<Key, Value, Compare, Alloc, Augment>::subtreeRank(ptr_AVLTreeNode<Key, Value, Augment> node) const {
+    return height(node);
+}
+
+// the children of node, the root of a subtree of the given height, with their heights
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void AVLTree<Key, Value, Compare, Alloc, Augment>::expose(ptr_AVLTreeNode<Key, Value, Augment> node, int nodeHeight, ptr_AVLTreeNode<Key, Value, Augment>& left, int& leftHeight, ptr_AVLTreeNode<Key, Value, Augment>& right, int& rightHeight) const {
+    left = node->getLeft();
+    right = node->getRight();
+    leftHeight = nodeHeight - ((node->getBalance() < 0) ? 2 : 1);
+    rightHeight = nodeHeight - ((node->getBalance() > 0) ? 2 : 1);
+}
+
+// link left and right (keys in this order) into one subtree, using the minimum of right as pivot
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+ptr_AVLTreeNode<Key, Value, Augment> AVLTree<Key, Value, Compare, Alloc, Augment>::join2Subtrees(ptr_AVLTreeNode<Key, Value, Augment> left, int leftHeight, ptr_AVLTreeNode<Key, Value, Augment> right, int rightHeight, int& height) {
+    if (right == this->nullValue) {
+        height = leftHeight;
+        return left;
+    }
+    right->setParent(this->nullValue);
+    this->root = right;
+    ptr_AVLTreeNode<Key, Value, Augment> pivot = static_cast<ptr_AVLTreeNode<Key, Value, Augment>>(this->minimum(right));
+    detach(pivot);
+    right = getRoot();
+    rightHeight = this->height(right);
+    return joinSubtrees(left, leftHeight, pivot, right, rightHeight, height);
+}
+
+// an empty tree sharing the comparator and the allocator, whose root is scratch space for the joins of a subtree
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+AVLTree<Key, Value, Compare, Alloc, Augment> AVLTree<Key, Value, Compare, Alloc, Augment>::workspace() const {
+    return AVLTree(this->comp, Alloc(this->nodeAllocator));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+AVLTree<Key, Value, Compare, Alloc, Augment> AVLTree<Key, Value, Compare, Alloc, Augment>::setUnion(AVLTree&& first, AVLTree&& second) {
+    return SetOperations<AVLTree, AVLTreeNode<Key, Value, Augment>, int>::unite(std::move(first), std::move(second), nullptr);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+AVLTree<Key, Value, Compare, Alloc, Augment> AVLTree<Key, Value, Compare, Alloc, Augment>::setUnion(AVLTree&& first, AVLTree&& second, ThreadPool& pool) {
+    return SetOperations<AVLTree, AVLTreeNode<Key, Value, Augment>, int>::unite(std::move(first), std::move(second), &pool);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+AVLTree<Key, Value, Compare, Alloc, Augment> AVLTree<Key, Value, Compare, Alloc, Augment>::setIntersection(AVLTree&& first, AVLTree&& second) {
+    return SetOperations<AVLTree, AVLTreeNode<Key, Value, Augment>, int>::intersect(std::move(first), std::move(second), nullptr);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+AVLTree<Key, Value, Compare, Alloc, Augment> AVLTree<Key, Value, Compare, Alloc, Augment>::setIntersection(AVLTree&& first, AVLTree&& second, ThreadPool& pool) {
+    return SetOperations<AVLTree, AVLTreeNode<Key, Value, Augment>, int>::intersect(std::move(first), std::move(second), &pool);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+AVLTree<Key, Value, Compare, Alloc, Augment> AVLTree<Key, Value, Compare, Alloc, Augment>::setDifference(AVLTree&& first, AVLTree&& second) {
+    return SetOperations<AVLTree, AVLTreeNode<Key, Value, Augment>, int>::subtract(std::move(first), std::move(second), nullptr);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+AVLTree<Key, Value, Compare, Alloc, Augment> AVLTree<Key, Value, Compare, Alloc, Augment>::setDifference(AVLTree&& first, AVLTree&& second, ThreadPool& pool) {
+    return SetOperations<AVLTree, AVLTreeNode<Key, Value, Augment>, int>::subtract(std::move(first), std::move(second), &pool);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void AVLTree<Key, Value, Compare, Alloc, Augment>::removeBatch(std::vector<Key> keys) {
+    if (this->mergeRemoveBatch(keys, annotateBalanced)) {
+        return;
+    }
+    for (typename std::vector<Key>::const_iterator key = keys.begin(); key != keys.end(); ++key) {
+        ptr_AVLTreeNode<Key, Value, Augment> node = search(*key);
+        if (node != this->nullValue) {
+            remove(node);
+        }
+    }
+}
+
+// fixers 
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void AVLTree<Key, Value, Compare, Alloc, Augment>::fixAfterRemove(ptr_AVLTreeNode<Key, Value, Augment> parent, bool fromLeft) {
+    while (parent != this->nullValue) { // the subtree on the fromLeft side of parent has shrunk by one
+        int parentBalance = parent->getBalance() + (fromLeft ? -1 : 1);
+        if (parentBalance == 1 || parentBalance == -1) { // the height of parent did not change
+            parent->setBalance(parentBalance);
+            return;
+        }
+        ptr_AVLTreeNode<Key, Value, Augment> subtree = parent;
+        if (parentBalance == 0) {
+            parent->setBalance(0);
         } else {
-            rotateLeft(node);
+            int siblingBalance = balanceFactor((parentBalance == 2) ? parent->getLeft() : parent->getRight());
+            subtree = balance(parent, parentBalance);
+            if (siblingBalance == 0) { // a single rotation over a balanced sibling keeps the height
+                return;
+            }
         }
-        return true;
+        parent = subtree->getParent();
+        fromLeft = parent != this->nullValue && subtree == parent->getLeft();
     }
-    return false;
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-void AVLTree<CMP>::updateOnRotation(sptr_AVLTreeNode& node) {
-    sptr_AVLTreeNode parent = node->getParent();
-    updateHeight(node);
-    updateHeight(parent);
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+int AVLTree<Key, Value, Compare, Alloc, Augment>::balanceFactor(ptr_AVLTreeNode<Key, Value, Augment> node) { 
+    if (node == this->nullValue)
+        return 0;
+    return node->getBalance();
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+ptr_AVLTreeNode<Key, Value, Augment> AVLTree<Key, Value, Compare, Alloc, Augment>::balance(ptr_AVLTreeNode<Key, Value, Augment> node, int nodeBalance) { 
+    if (nodeBalance == 2) {
+        ptr_AVLTreeNode<Key, Value, Augment> left = node->getLeft();
+        int leftBalance = left->getBalance();
+        if (leftBalance == -1) { 
+            ptr_AVLTreeNode<Key, Value, Augment> pivot = left->getRight();
+            int pivotBalance = pivot->getBalance();
+            rotateLeft(left);
+            rotateRight(node);
+            node->setBalance((pivotBalance == 1) ? -1 : 0);
+            left->setBalance((pivotBalance == -1) ? 1 : 0);
+            pivot->setBalance(0);
+            return pivot;
+        }
+        rotateRight(node);
+        node->setBalance((leftBalance == 0) ? 1 : 0);
+        left->setBalance((leftBalance == 0) ? -1 : 0);
+        return left;
+    }
+    ptr_AVLTreeNode<Key, Value, Augment> right = node->getRight();
+    int rightBalance = right->getBalance();
+    if (rightBalance == 1) {
+        ptr_AVLTreeNode<Key, Value, Augment> pivot = right->getLeft();
+        int pivotBalance = pivot->getBalance();
+        rotateRight(right);
+        rotateLeft(node);
+        node->setBalance((pivotBalance == -1) ? 1 : 0);
+        right->setBalance((pivotBalance == 1) ? -1 : 0);
+        pivot->setBalance(0);
+        return pivot;
+    }
+    rotateLeft(node);
+    node->setBalance((rightBalance == 0) ? -1 : 0);
+    right->setBalance((rightBalance == 0) ? 1 : 0);
+    return right;
 }
 
 // rotation methods
-template <bool CMP(const int& key1, const int& key2)>
-void AVLTree<CMP>::rotateLeft(sptr_AVLTreeNode node) {
-    SelfBalancingTree<CMP>::rotateLeft(node);
-    updateOnRotation(node);
-}
-template <bool CMP(const int& key1, const int& key2)>
-void AVLTree<CMP>::rotateRight(sptr_AVLTreeNode node) {
-    SelfBalancingTree<CMP>::rotateRight(node);
-    updateOnRotation(node);
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void AVLTree<Key, Value, Compare, Alloc, Augment>::rotateLeft(ptr_AVLTreeNode<Key, Value, Augment> node) {
+    SelfBalancingTree<Key, Value, Compare, Alloc, AVLTreeNode<Key, Value, Augment>>::rotateLeft(node);
+}
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void AVLTree<Key, Value, Compare, Alloc, Augment>::rotateRight(ptr_AVLTreeNode<Key, Value, Augment> node) {
+    SelfBalancingTree<Key, Value, Compare, Alloc, AVLTreeNode<Key, Value, Augment>>::rotateRight(node);
 }
\ No newline at end of file
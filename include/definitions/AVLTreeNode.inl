@@ -0,0 +1,48 @@
+/**
+ * @file AVLTreeNode.inl
+ * @brief This class implements AVLTreeNode
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include "AVLTreeNode.hpp"
+
+
+// constructors and destructor
+template <typename Key, typename Value, typename Augment>
+template <typename... Args>
+AVLTreeNode<Key, Value, Augment>::AVLTreeNode(const Key& key, Args&&... args) : TreeNode<Key, Value>(key, std::forward<Args>(args)...) {
+    setBalance(0);
+}
+template <typename Key, typename Value, typename Augment>
+AVLTreeNode<Key, Value, Augment>::~AVLTreeNode() = default;
+
+// getters
+template <typename Key, typename Value, typename Augment>
+AVLTreeNode<Key, Value, Augment>* AVLTreeNode<Key, Value, Augment>::getLeft() const {
+    return static_cast<AVLTreeNode*>(this->left);
+}
+
+template <typename Key, typename Value, typename Augment>
+AVLTreeNode<Key, Value, Augment>* AVLTreeNode<Key, Value, Augment>::getRight() const{
+    return static_cast<AVLTreeNode*>(this->right);
+}
+
+template <typename Key, typename Value, typename Augment>
+AVLTreeNode<Key, Value, Augment>* AVLTreeNode<Key, Value, Augment>::getParent() const {
+    return static_cast<AVLTreeNode*>(TreeNode<Key, Value>::getParent());
+}
+
+template <typename Key, typename Value, typename Augment>
+int AVLTreeNode<Key, Value, Augment>::getBalance() const {
+    return static_cast<int>(this->getTag()) - 1;
+}
+
+// setters
+template <typename Key, typename Value, typename Augment>
+void AVLTreeNode<Key, Value, Augment>::setBalance(int balance) {
+    this->setTag(static_cast<unsigned>(balance + 1));
+}
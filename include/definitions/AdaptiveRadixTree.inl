@@ -0,0 +1,657 @@
+/**
+ * @file AdaptiveRadixTree.inl
+ * @brief This file contains the implementation of the AdaptiveRadixTree class
+ * @version 1.0
+ * @date 2023-01-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#include <cstring>
+#include "AdaptiveRadixTree.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// constructors and destructors
+template <typename Key, typename Value, typename Alloc>
+AdaptiveRadixTree<Key, Value, Alloc>::AdaptiveRadixTree(const Alloc& alloc)
+    : leafAllocator(alloc), node4Allocator(alloc), node16Allocator(alloc), node48Allocator(alloc), node256Allocator(alloc) {}
+
+template <typename Key, typename Value, typename Alloc>
+AdaptiveRadixTree<Key, Value, Alloc>::AdaptiveRadixTree(AdaptiveRadixTree&& other)
+    : leafAllocator(other.leafAllocator), node4Allocator(other.node4Allocator), node16Allocator(other.node16Allocator),
+      node48Allocator(other.node48Allocator), node256Allocator(other.node256Allocator), root{other.root}, numOfNodes{other.numOfNodes} {
+    other.root = nullptr;
+    other.numOfNodes = 0;
+}
+
+template <typename Key, typename Value, typename Alloc>
+AdaptiveRadixTree<Key, Value, Alloc>::~AdaptiveRadixTree() {
+    clear();
+}
+
+template <typename Key, typename Value, typename Alloc>
+void AdaptiveRadixTree<Key, Value, Alloc>::clear() {
+    if (root != nullptr) {
+        clear(root);
+    }
+    root = nullptr;
+    numOfNodes = 0;
+}
+
+// at most sizeof(Key) levels, the recursion stays shallow
+template <typename Key, typename Value, typename Alloc>
+void AdaptiveRadixTree<Key, Value, Alloc>::clear(ARTNode* node) {
+    switch (node->type) {
+        case ARTNodeType::NODE4:
+            for (uint i{0}; i < static_cast<ARTNode4*>(node)->count; ++i) {
+                clear(static_cast<ARTNode4*>(node)->children[i]);
+            }
+            break;
+        case ARTNodeType::NODE16:
+            for (uint i{0}; i < static_cast<ARTNode16*>(node)->count; ++i) {
+                clear(static_cast<ARTNode16*>(node)->children[i]);
+            }
+            break;
+        case ARTNodeType::NODE48:
+            for (uint i{0}; i < 48; ++i) {
+                if (static_cast<ARTNode48*>(node)->children[i] != nullptr) {
+                    clear(static_cast<ARTNode48*>(node)->children[i]);
+                }
+            }
+            break;
+        case ARTNodeType::NODE256:
+            for (uint i{0}; i < 256; ++i) {
+                if (static_cast<ARTNode256*>(node)->children[i] != nullptr) {
+                    clear(static_cast<ARTNode256*>(node)->children[i]);
+                }
+            }
+            break;
+        case ARTNodeType::LEAF:
+            break;
+    }
+    destroyNode(node);
+}
+
+// getters
+template <typename Key, typename Value, typename Alloc>
+inline bool AdaptiveRadixTree<Key, Value, Alloc>::isEmpty() const {
+    return numOfNodes == 0;
+}
+
+template <typename Key, typename Value, typename Alloc>
+inline unsigned int AdaptiveRadixTree<Key, Value, Alloc>::getNumOfNodes() const {
+    return numOfNodes;
+}
+
+// node management
+template <typename Key, typename Value, typename Alloc>
+template <typename T, typename A, typename... Args>
+T* AdaptiveRadixTree<Key, Value, Alloc>::createNode(A& allocator, Args&&... args) {
+    T* node = std::allocator_traits<A>::allocate(allocator, 1);
+    std::allocator_traits<A>::construct(allocator, node, std::forward<Args>(args)...);
+    return node;
+}
+
+template <typename Key, typename Value, typename Alloc>
+template <typename T, typename A>
+void AdaptiveRadixTree<Key, Value, Alloc>::freeNode(A& allocator, T* node) {
+    std::allocator_traits<A>::destroy(allocator, node);
+    std::allocator_traits<A>::deallocate(allocator, node, 1);
+}
+
+// frees the node only, not its children
+template <typename Key, typename Value, typename Alloc>
+void AdaptiveRadixTree<Key, Value, Alloc>::destroyNode(ARTNode* node) {
+    switch (node->type) {
+        case ARTNodeType::LEAF:
+            freeNode(leafAllocator, static_cast<Leaf*>(node));
+            break;
+        case ARTNodeType::NODE4:
+            freeNode(node4Allocator, static_cast<ARTNode4*>(node));
+            break;
+        case ARTNodeType::NODE16:
+            freeNode(node16Allocator, static_cast<ARTNode16*>(node));
+            break;
+        case ARTNodeType::NODE48:
+            freeNode(node48Allocator, static_cast<ARTNode48*>(node));
+            break;
+        case ARTNodeType::NODE256:
+            freeNode(node256Allocator, static_cast<ARTNode256*>(node));
+            break;
+    }
+}
+
+// key bytes, most significant first, the sign bit flipped so that negative keys come first
+template <typename Key, typename Value, typename Alloc>
+void AdaptiveRadixTree<Key, Value, Alloc>::loadBytes(const Key& key, std::uint8_t* bytes) {
+    typedef typename std::make_unsigned<Key>::type Bits;
+    Bits bits = static_cast<Bits>(key);
+    if (std::is_signed<Key>::value) {
+        bits ^= static_cast<Bits>(Bits(1) << (8 * KEY_BYTES - 1));
+    }
+    for (uint i{0}; i < KEY_BYTES; ++i) {
+        bytes[i] = static_cast<std::uint8_t>(bits >> (8 * (KEY_BYTES - 1 - i)));
+    }
+}
+
+template <typename Key, typename Value, typename Alloc>
+unsigned int AdaptiveRadixTree<Key, Value, Alloc>::prefixMismatch(const ARTInner* node, const std::uint8_t* bytes, uint depth) {
+    uint i{0};
+    while (i < node->prefixLength && node->prefix[i] == bytes[depth + i]) {
+        ++i;
+    }
+    return i;
+}
+
+// children lookup
+template <typename Key, typename Value, typename Alloc>
+ARTNode** AdaptiveRadixTree<Key, Value, Alloc>::findChild(ARTInner* node, std::uint8_t byte) const {
+    switch (node->type) {
+        case ARTNodeType::NODE4: {
+            ARTNode4* node4 = static_cast<ARTNode4*>(node);
+            for (uint i{0}; i < node4->count; ++i) {
+                if (node4->keys[i] == byte) {
+                    return &node4->children[i];
+                }
+            }
+            return nullptr;
+        }
+        case ARTNodeType::NODE16: {
+            ARTNode16* node16 = static_cast<ARTNode16*>(node);
+#if defined(__SSE2__)
+            // compare the 16 key bytes at once, the mask drops the unused slots
+            __m128i equal = _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(byte)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(node16->keys)));
+            int mask = _mm_movemask_epi8(equal) & ((1 << node16->count) - 1);
+            return (mask != 0) ? &node16->children[__builtin_ctz(mask)] : nullptr;
+#else
+            for (uint i{0}; i < node16->count; ++i) {
+                if (node16->keys[i] == byte) {
+                    return &node16->children[i];
+                }
+            }
+            return nullptr;
+#endif
+        }
+        case ARTNodeType::NODE48: {
+            ARTNode48* node48 = static_cast<ARTNode48*>(node);
+            return (node48->childIndex[byte] != 0) ? &node48->children[node48->childIndex[byte] - 1] : nullptr;
+        }
+        case ARTNodeType::NODE256: {
+            ARTNode256* node256 = static_cast<ARTNode256*>(node);
+            return (node256->children[byte] != nullptr) ? &node256->children[byte] : nullptr;
+        }
+        case ARTNodeType::LEAF:
+            break;
+    }
+    return nullptr;
+}
+
+// the first child with a key byte greater than byte (-1 for the first child)
+template <typename Key, typename Value, typename Alloc>
+ARTNode* AdaptiveRadixTree<Key, Value, Alloc>::nextChild(ARTInner* node, int byte) const {
+    switch (node->type) {
+        case ARTNodeType::NODE4: {
+            ARTNode4* node4 = static_cast<ARTNode4*>(node);
+            for (uint i{0}; i < node4->count; ++i) {
+                if (node4->keys[i] > byte) {
+                    return node4->children[i];
+                }
+            }
+            break;
+        }
+        case ARTNodeType::NODE16: {
+            ARTNode16* node16 = static_cast<ARTNode16*>(node);
+            for (uint i{0}; i < node16->count; ++i) {
+                if (node16->keys[i] > byte) {
+                    return node16->children[i];
+                }
+            }
+            break;
+        }
+        case ARTNodeType::NODE48: {
+            ARTNode48* node48 = static_cast<ARTNode48*>(node);
+            for (int b = byte + 1; b < 256; ++b) {
+                if (node48->childIndex[b] != 0) {
+                    return node48->children[node48->childIndex[b] - 1];
+                }
+            }
+            break;
+        }
+        case ARTNodeType::NODE256: {
+            ARTNode256* node256 = static_cast<ARTNode256*>(node);
+            for (int b = byte + 1; b < 256; ++b) {
+                if (node256->children[b] != nullptr) {
+                    return node256->children[b];
+                }
+            }
+            break;
+        }
+        case ARTNodeType::LEAF:
+            break;
+    }
+    return nullptr;
+}
+
+template <typename Key, typename Value, typename Alloc>
+ARTNode* AdaptiveRadixTree<Key, Value, Alloc>::lastChild(ARTInner* node) const {
+    switch (node->type) {
+        case ARTNodeType::NODE4:
+            return static_cast<ARTNode4*>(node)->children[node->count - 1];
+        case ARTNodeType::NODE16:
+            return static_cast<ARTNode16*>(node)->children[node->count - 1];
+        case ARTNodeType::NODE48: {
+            ARTNode48* node48 = static_cast<ARTNode48*>(node);
+            for (int b = 255; b >= 0; --b) {
+                if (node48->childIndex[b] != 0) {
+                    return node48->children[node48->childIndex[b] - 1];
+                }
+            }
+            break;
+        }
+        case ARTNodeType::NODE256: {
+            ARTNode256* node256 = static_cast<ARTNode256*>(node);
+            for (int b = 255; b >= 0; --b) {
+                if (node256->children[b] != nullptr) {
+                    return node256->children[b];
+                }
+            }
+            break;
+        }
+        case ARTNodeType::LEAF:
+            break;
+    }
+    return nullptr;
+}
+
+// add a child to node, growing it (and updating the link in ref) when it is full
+template <typename Key, typename Value, typename Alloc>
+void AdaptiveRadixTree<Key, Value, Alloc>::addChild(ARTNode** ref, ARTInner* node, std::uint8_t byte, ARTNode* child) {
+    switch (node->type) {
+        case ARTNodeType::NODE4: {
+            ARTNode4* node4 = static_cast<ARTNode4*>(node);
+            if (node4->count < 4) {
+                uint position = node4->count;
+                for (; position > 0 && node4->keys[position - 1] > byte; --position) {
+                    node4->keys[position] = node4->keys[position - 1];
+                    node4->children[position] = node4->children[position - 1];
+                }
+                node4->keys[position] = byte;
+                node4->children[position] = child;
+                ++node4->count;
+                return;
+            }
+            ARTNode16* node16 = createNode<ARTNode16>(node16Allocator);
+            node16->prefixLength = node4->prefixLength;
+            node16->count = node4->count;
+            std::memcpy(node16->prefix, node4->prefix, ARTInner::MAX_PREFIX);
+            std::memcpy(node16->keys, node4->keys, 4);
+            std::memcpy(node16->children, node4->children, 4 * sizeof(ARTNode*));
+            freeNode(node4Allocator, node4);
+            *ref = node16;
+            addChild(ref, node16, byte, child);
+            return;
+        }
+        case ARTNodeType::NODE16: {
+            ARTNode16* node16 = static_cast<ARTNode16*>(node);
+            if (node16->count < 16) {
+                uint position = node16->count;
+                for (; position > 0 && node16->keys[position - 1] > byte; --position) {
+                    node16->keys[position] = node16->keys[position - 1];
+                    node16->children[position] = node16->children[position - 1];
+                }
+                node16->keys[position] = byte;
+                node16->children[position] = child;
+                ++node16->count;
+                return;
+            }
+            ARTNode48* node48 = createNode<ARTNode48>(node48Allocator);
+            node48->prefixLength = node16->prefixLength;
+            node48->count = node16->count;
+            std::memcpy(node48->prefix, node16->prefix, ARTInner::MAX_PREFIX);
+            for (uint i{0}; i < 16; ++i) {
+                node48->childIndex[node16->keys[i]] = static_cast<std::uint8_t>(i + 1);
+                node48->children[i] = node16->children[i];
+            }
+            freeNode(node16Allocator, node16);
+            *ref = node48;
+            addChild(ref, node48, byte, child);
+            return;
+        }
+        case ARTNodeType::NODE48: {
+            ARTNode48* node48 = static_cast<ARTNode48*>(node);
+            if (node48->count < 48) {
+                uint slot{0};
+                while (node48->children[slot] != nullptr) { // removals leave holes anywhere
+                    ++slot;
+                }
+                node48->children[slot] = child;
+                node48->childIndex[byte] = static_cast<std::uint8_t>(slot + 1);
+                ++node48->count;
+                return;
+            }
+            ARTNode256* node256 = createNode<ARTNode256>(node256Allocator);
+            node256->prefixLength = node48->prefixLength;
+            node256->count = node48->count;
+            std::memcpy(node256->prefix, node48->prefix, ARTInner::MAX_PREFIX);
+            for (uint b{0}; b < 256; ++b) {
+                if (node48->childIndex[b] != 0) {
+                    node256->children[b] = node48->children[node48->childIndex[b] - 1];
+                }
+            }
+            freeNode(node48Allocator, node48);
+            *ref = node256;
+            addChild(ref, node256, byte, child);
+            return;
+        }
+        case ARTNodeType::NODE256: {
+            ARTNode256* node256 = static_cast<ARTNode256*>(node);
+            node256->children[byte] = child;
+            ++node256->count;
+            return;
+        }
+        case ARTNodeType::LEAF:
+            return;
+    }
+}
+
+// remove a child from node, shrinking it (and updating the link in ref) when it gets sparse
+template <typename Key, typename Value, typename Alloc>
+void AdaptiveRadixTree<Key, Value, Alloc>::removeChild(ARTNode** ref, ARTInner* node, std::uint8_t byte) {
+    switch (node->type) {
+        case ARTNodeType::NODE4: {
+            ARTNode4* node4 = static_cast<ARTNode4*>(node);
+            uint position{0};
+            while (node4->keys[position] != byte) {
+                ++position;
+            }
+            for (++position; position < node4->count; ++position) {
+                node4->keys[position - 1] = node4->keys[position];
+                node4->children[position - 1] = node4->children[position];
+            }
+            if (--node4->count > 1) {
+                return;
+            }
+            // a single child is left: it takes the place of the node, its path becomes part of the child prefix
+            ARTNode* child = node4->children[0];
+            if (child->type != ARTNodeType::LEAF) {
+                ARTInner* inner = static_cast<ARTInner*>(child);
+                std::uint8_t prefix[ARTInner::MAX_PREFIX];
+                uint length = node4->prefixLength;
+                std::memcpy(prefix, node4->prefix, length);
+                prefix[length++] = node4->keys[0];
+                std::memcpy(prefix + length, inner->prefix, inner->prefixLength);
+                inner->prefixLength = static_cast<std::uint8_t>(length + inner->prefixLength);
+                std::memcpy(inner->prefix, prefix, inner->prefixLength);
+            }
+            freeNode(node4Allocator, node4);
+            *ref = child;
+            return;
+        }
+        case ARTNodeType::NODE16: {
+            ARTNode16* node16 = static_cast<ARTNode16*>(node);
+            uint position{0};
+            while (node16->keys[position] != byte) {
+                ++position;
+            }
+            for (++position; position < node16->count; ++position) {
+                node16->keys[position - 1] = node16->keys[position];
+                node16->children[position - 1] = node16->children[position];
+            }
+            if (--node16->count > 3) {
+                return;
+            }
+            ARTNode4* node4 = createNode<ARTNode4>(node4Allocator);
+            node4->prefixLength = node16->prefixLength;
+            node4->count = node16->count;
+            std::memcpy(node4->prefix, node16->prefix, ARTInner::MAX_PREFIX);
+            std::memcpy(node4->keys, node16->keys, node16->count);
+            std::memcpy(node4->children, node16->children, node16->count * sizeof(ARTNode*));
+            freeNode(node16Allocator, node16);
+            *ref = node4;
+            return;
+        }
+        case ARTNodeType::NODE48: {
+            ARTNode48* node48 = static_cast<ARTNode48*>(node);
+            node48->children[node48->childIndex[byte] - 1] = nullptr;
+            node48->childIndex[byte] = 0;
+            if (--node48->count > 12) {
+                return;
+            }
+            ARTNode16* node16 = createNode<ARTNode16>(node16Allocator);
+            node16->prefixLength = node48->prefixLength;
+            node16->count = node48->count;
+            std::memcpy(node16->prefix, node48->prefix, ARTInner::MAX_PREFIX);
+            uint position{0};
+            for (uint b{0}; b < 256; ++b) {
+                if (node48->childIndex[b] != 0) {
+                    node16->keys[position] = static_cast<std::uint8_t>(b);
+                    node16->children[position++] = node48->children[node48->childIndex[b] - 1];
+                }
+            }
+            freeNode(node48Allocator, node48);
+            *ref = node16;
+            return;
+        }
+        case ARTNodeType::NODE256: {
+            ARTNode256* node256 = static_cast<ARTNode256*>(node);
+            node256->children[byte] = nullptr;
+            if (--node256->count > 37) {
+                return;
+            }
+            ARTNode48* node48 = createNode<ARTNode48>(node48Allocator);
+            node48->prefixLength = node256->prefixLength;
+            node48->count = node256->count;
+            std::memcpy(node48->prefix, node256->prefix, ARTInner::MAX_PREFIX);
+            uint slot{0};
+            for (uint b{0}; b < 256; ++b) {
+                if (node256->children[b] != nullptr) {
+                    node48->children[slot] = node256->children[b];
+                    node48->childIndex[b] = static_cast<std::uint8_t>(++slot);
+                }
+            }
+            freeNode(node256Allocator, node256);
+            *ref = node48;
+            return;
+        }
+        case ARTNodeType::LEAF:
+            return;
+    }
+}
+
+// core functionalities
+template <typename Key, typename Value, typename Alloc>
+void AdaptiveRadixTree<Key, Value, Alloc>::insert(const Key& key, const Value& value) {
+    emplace(key, value);
+}
+
+template <typename Key, typename Value, typename Alloc>
+void AdaptiveRadixTree<Key, Value, Alloc>::insert(const Key& key, Value&& value) {
+    emplace(key, std::move(value));
+}
+
+template <typename Key, typename Value, typename Alloc>
+void AdaptiveRadixTree<Key, Value, Alloc>::insert(TreeNodeObject* obj) {
+    // the control block of the shared_ptr is drawn from the node allocator as well
+    emplace(obj->getKey(), sptr_TreeNodeObject(obj, std::default_delete<TreeNodeObject>(), leafAllocator));
+}
+
+template <typename Key, typename Value, typename Alloc>
+template <typename... Args>
+ptr_ARTLeaf<Key, Value> AdaptiveRadixTree<Key, Value, Alloc>::emplace(const Key& key, Args&&... args) {
+    std::uint8_t bytes[KEY_BYTES];
+    loadBytes(key, bytes);
+    ARTNode** ref = &root;
+    uint depth{0};
+    while (*ref != nullptr) {
+        ARTNode* node = *ref;
+        if (node->type == ARTNodeType::LEAF) {
+            Leaf* existing = static_cast<Leaf*>(node);
+            if (existing->key == key) {
+                existing->value = Value(std::forward<Args>(args)...);
+                return existing;
+            }
+            // two leaves: a Node4 on the first byte where they differ, the bytes before it are its prefix
+            std::uint8_t existingBytes[KEY_BYTES];
+            loadBytes(existing->key, existingBytes);
+            uint end = depth;
+            while (bytes[end] == existingBytes[end]) {
+                ++end;
+            }
+            Leaf* leaf = createNode<Leaf>(leafAllocator, key, std::forward<Args>(args)...);
+            ARTNode4* split = createNode<ARTNode4>(node4Allocator);
+            split->prefixLength = static_cast<std::uint8_t>(end - depth);
+            std::memcpy(split->prefix, bytes + depth, end - depth);
+            addChild(ref, split, existingBytes[end], existing);
+            addChild(ref, split, bytes[end], leaf);
+            *ref = split;
+            ++numOfNodes;
+            return leaf;
+        }
+
+        ARTInner* inner = static_cast<ARTInner*>(node);
+        uint mismatch = prefixMismatch(inner, bytes, depth);
+        if (mismatch < inner->prefixLength) {
+            // the key leaves the compressed path: a Node4 takes the common part, the node keeps the rest
+            Leaf* leaf = createNode<Leaf>(leafAllocator, key, std::forward<Args>(args)...);
+            ARTNode4* split = createNode<ARTNode4>(node4Allocator);
+            split->prefixLength = static_cast<std::uint8_t>(mismatch);
+            std::memcpy(split->prefix, inner->prefix, mismatch);
+            std::uint8_t innerByte = inner->prefix[mismatch];
+            inner->prefixLength = static_cast<std::uint8_t>(inner->prefixLength - mismatch - 1);
+            std::memmove(inner->prefix, inner->prefix + mismatch + 1, inner->prefixLength);
+            addChild(ref, split, innerByte, inner);
+            addChild(ref, split, bytes[depth + mismatch], leaf);
+            *ref = split;
+            ++numOfNodes;
+            return leaf;
+        }
+
+        depth += inner->prefixLength;
+        ARTNode** child = findChild(inner, bytes[depth]);
+        if (child == nullptr) {
+            Leaf* leaf = createNode<Leaf>(leafAllocator, key, std::forward<Args>(args)...);
+            addChild(ref, inner, bytes[depth], leaf);
+            ++numOfNodes;
+            return leaf;
+        }
+        ref = child;
+        ++depth;
+    }
+    Leaf* leaf = createNode<Leaf>(leafAllocator, key, std::forward<Args>(args)...);
+    root = leaf;
+    ++numOfNodes;
+    return leaf;
+}
+
+template <typename Key, typename Value, typename Alloc>
+ptr_ARTLeaf<Key, Value> AdaptiveRadixTree<Key, Value, Alloc>::search(const Key& key) const {
+    std::uint8_t bytes[KEY_BYTES];
+    loadBytes(key, bytes);
+    ARTNode* node = root;
+    uint depth{0};
+    while (node != nullptr) {
+        if (node->type == ARTNodeType::LEAF) {
+            Leaf* leaf = static_cast<Leaf*>(node);
+            return (leaf->key == key) ? leaf : nullptr;
+        }
+        ARTInner* inner = static_cast<ARTInner*>(node);
+        if (prefixMismatch(inner, bytes, depth) != inner->prefixLength) {
+            return nullptr;
+        }
+        depth += inner->prefixLength;
+        ARTNode** child = findChild(inner, bytes[depth]);
+        if (child == nullptr) {
+            return nullptr;
+        }
+        node = *child;
+        ++depth;
+    }
+    return nullptr;
+}
+
+template <typename Key, typename Value, typename Alloc>
+void AdaptiveRadixTree<Key, Value, Alloc>::remove(ptr_ARTLeaf<Key, Value> leaf) {
+    if (root == leaf) {
+        root = nullptr;
+    } else {
+        std::uint8_t bytes[KEY_BYTES];
+        loadBytes(leaf->key, bytes);
+        ARTNode** ref = &root;
+        uint depth{0};
+        while (true) {
+            ARTInner* inner = static_cast<ARTInner*>(*ref);
+            depth += inner->prefixLength;
+            ARTNode** child = findChild(inner, bytes[depth]);
+            if (*child == leaf) {
+                removeChild(ref, inner, bytes[depth]);
+                break;
+            }
+            ref = child;
+            ++depth;
+        }
+    }
+    destroyNode(leaf);
+    --numOfNodes;
+}
+
+// ordered navigation
+template <typename Key, typename Value, typename Alloc>
+ptr_ARTLeaf<Key, Value> AdaptiveRadixTree<Key, Value, Alloc>::minimum(ARTNode* node) const {
+    while (node != nullptr && node->type != ARTNodeType::LEAF) {
+        node = nextChild(static_cast<ARTInner*>(node), -1);
+    }
+    return static_cast<Leaf*>(node);
+}
+
+template <typename Key, typename Value, typename Alloc>
+inline ptr_ARTLeaf<Key, Value> AdaptiveRadixTree<Key, Value, Alloc>::minimum() const {
+    return minimum(root);
+}
+
+template <typename Key, typename Value, typename Alloc>
+ptr_ARTLeaf<Key, Value> AdaptiveRadixTree<Key, Value, Alloc>::maximum(ARTNode* node) const {
+    while (node != nullptr && node->type != ARTNodeType::LEAF) {
+        node = lastChild(static_cast<ARTInner*>(node));
+    }
+    return static_cast<Leaf*>(node);
+}
+
+template <typename Key, typename Value, typename Alloc>
+inline ptr_ARTLeaf<Key, Value> AdaptiveRadixTree<Key, Value, Alloc>::maximum() const {
+    return maximum(root);
+}
+
+// the smallest leaf of the subtree of node with a key greater than key
+template <typename Key, typename Value, typename Alloc>
+ptr_ARTLeaf<Key, Value> AdaptiveRadixTree<Key, Value, Alloc>::greater(ARTNode* node, const std::uint8_t* bytes, uint depth, const Key& key) const {
+    if (node->type == ARTNodeType::LEAF) {
+        Leaf* leaf = static_cast<Leaf*>(node);
+        return (key < leaf->key) ? leaf : nullptr;
+    }
+    ARTInner* inner = static_cast<ARTInner*>(node);
+    uint mismatch = prefixMismatch(inner, bytes, depth);
+    if (mismatch < inner->prefixLength) { // the whole subtree is on one side of the key
+        return (inner->prefix[mismatch] > bytes[depth + mismatch]) ? minimum(node) : nullptr;
+    }
+    depth += inner->prefixLength;
+    ARTNode** child = findChild(inner, bytes[depth]);
+    if (child != nullptr) {
+        Leaf* leaf = greater(*child, bytes, depth + 1, key);
+        if (leaf != nullptr) {
+            return leaf;
+        }
+    }
+    ARTNode* next = nextChild(inner, bytes[depth]);
+    return (next != nullptr) ? minimum(next) : nullptr;
+}
+
+template <typename Key, typename Value, typename Alloc>
+ptr_ARTLeaf<Key, Value> AdaptiveRadixTree<Key, Value, Alloc>::successor(ptr_ARTLeaf<Key, Value> leaf) const {
+    std::uint8_t bytes[KEY_BYTES];
+    loadBytes(leaf->key, bytes);
+    return greater(root, bytes, 0, leaf->key);
+}
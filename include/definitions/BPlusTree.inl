@@ -0,0 +1,432 @@
+/**
+ * @file BPlusTree.inl
+ * @brief This file contains the implementation of the BPlusTree class
+ * @version 1.0
+ * @date 2023-01-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#include "BPlusTree.hpp"
+
+// constructors and destructors
+template <typename Key, typename Value, typename Compare, unsigned int Fanout, typename Alloc>
+BPlusTree<Key, Value, Compare, Fanout, Alloc>::BPlusTree(const Compare& comp, const Alloc& alloc)
+    : comp(comp), leafAllocator(alloc), internalAllocator(alloc) {}
+
+template <typename Key, typename Value, typename Compare, unsigned int Fanout, typename Alloc>
+BPlusTree<Key, Value, Compare, Fanout, Alloc>::BPlusTree(BPlusTree&& other)
+    : comp(other.comp), leafAllocator(other.leafAllocator), internalAllocator(other.internalAllocator), root{other.root}, numOfKeys{other.numOfKeys} {
+    other.root = nullptr;
+    other.numOfKeys = 0;
+}
+
+template <typename Key, typename Value, typename Compare, unsigned int Fanout, typename Alloc>
+BPlusTree<Key, Value, Compare, Fanout, Alloc>::~BPlusTree() {
+    clear();
+}
+
+template <typename Key, typename Value, typename Compare, unsigned int Fanout, typename Alloc>
+void BPlusTree<Key, Value, Compare, Fanout, Alloc>::clear() {
+    if (root != nullptr) {
+        clear(root);
+    }
+    root = nullptr;
+    numOfKeys = 0;
+}
+
+// the height is logarithmic in the fan-out, the recursion stays shallow
+template <typename Key, typename Value, typename Compare, unsigned int Fanout, typename Alloc>
+void BPlusTree<Key, Value, Compare, Fanout, Alloc>::clear(Node* node) {
+    if (!node->leaf) {
+        Internal* internal = static_cast<Internal*>(node);
+        for (uint i{0}; i <= internal->count; ++i) {
+            clear(internal->children[i]);
+        }
+    }
+    destroyNode(node);
+}
+
+// getters
+template <typename Key, typename Value, typename Compare, unsigned int Fanout, typename Alloc>
+inline bool BPlusTree<Key, Value, Compare, Fanout, Alloc>::isEmpty() const {
+    return numOfKeys == 0;
+}
+
+template <typename Key, typename Value, typename Compare, unsigned int Fanout, typename Alloc>
+inline unsigned int BPlusTree<Key, Value, Compare, Fanout, Alloc>::getNumOfKeys() const {
+    return numOfKeys;
+}
+
+template <typename Key, typename Value, typename Compare, unsigned int Fanout, typename Alloc>
+unsigned int BPlusTree<Key, Value, Compare, Fanout, Alloc>::getHeight() const {
+    uint height{0};
+    for (Node* node = root; node != nullptr; node = node->leaf ? nullptr : static_cast<Internal*>(node)->children[0]) {
+        ++height;
+    }
+    return height;
+}
+
+// node management
+template <typename Key, typename Value, typename Compare, unsigned int Fanout, typename Alloc>
+typename BPlusTree<Key, Value, Compare, Fanout, Alloc>::Leaf* BPlusTree<Key, Value, Compare, Fanout, Alloc>::createLeaf() {
+    Leaf* leaf = std::allocator_traits<LeafAllocator>::allocate(leafAllocator, 1);
+    std::allocator_traits<LeafAllocator>::construct(leafAllocator, leaf);
+    Keys::pad(leaf->keys, 0, Node::Capacity);
+    return leaf;
+}
+
+template <typename Key, typename Value, typename Compare, unsigned int Fanout, typename Alloc>
+typename BPlusTree<Key, Value, Compare, Fanout, Alloc>::Internal* BPlusTree<Key, Value, Compare, Fanout, Alloc>::createInternal() {
+    Internal* internal = std::allocator_traits<InternalAllocator>::allocate(internalAllocator, 1);
+    std::allocator_traits<InternalAllocator>::construct(internalAllocator, internal);
+    Keys::pad(internal->keys, 0, Node::Capacity);
+    return internal;
+}
+
+// frees the node only, not its children
+template <typename Key, typename Value, typename Compare, unsigned int Fanout, typename Alloc>
+void BPlusTree<Key, Value, Compare, Fanout, Alloc>::destroyNode(Node* node) {
+    if (node->leaf) {
+        Leaf* leaf = static_cast<Leaf*>(node);
+        std::allocator_traits<LeafAllocator>::destroy(leafAllocator, leaf);
+        std::allocator_traits<LeafAllocator>::deallocate(leafAllocator, leaf, 1);
+    } else {
+        Internal* internal = static_cast<Internal*>(node);
+        std::allocator_traits<InternalAllocator>::destroy(internalAllocator, internal);
+        std::allocator_traits<InternalAllocator>::deallocate(internalAllocator, internal, 1);
+    }
+}
+
+// core functionalities
+template <typename Key, typename Value, typename Compare, unsigned int Fanout, typename Alloc>
+typename BPlusTree<Key, Value, Compare, Fanout, Alloc>::Leaf* BPlusTree<Key, Value, Compare, Fanout, Alloc>::findLeaf(const Key& key) const {
+    // children[i] holds the keys in (keys[i - 1], keys[i]]: the leaf reached is the leftmost one that may hold key
+    Node* node = root;
+    while (!node->leaf) {
+        Internal* internal = static_cast<Internal*>(node);
+        node = internal->children[Keys::lowerBound(internal->keys, internal->count, key, comp)];
+    }
+    return static_cast<Leaf*>(node);
+}
+
+template <typename Key, typename Value, typename Compare, unsigned int Fanout, typename Alloc>
+void BPlusTree<Key, Value, Compare, Fanout, Alloc>::insert(const Key& key, const Value& value) {
+    insertValue(key, Value(value));
+}
+
+template <typename Key, typename Value, typename Compare, unsigned int Fanout, typename Alloc>
+void BPlusTree<Key, Value, Compare, Fanout, Alloc>::insert(const Key& key, Value&& value) {
+    insertValue(key, std::move(value));
+}
+
+template <typename Key, typename Value, typename Compare, unsigned int Fanout, typename Alloc>
+void BPlusTree<Key, Value, Compare, Fanout, Alloc>::insert(TreeNodeObject* obj) {
+    // the control block of the shared_ptr is drawn from the node allocator as well
+    insertValue(obj->getKey(), sptr_TreeNodeObject(obj, std::default_delete<TreeNodeObject>(), leafAllocator));
+}
+
+template <typename Key, typename Value, typename Compare, unsigned int Fanout, typename Alloc>
+void BPlusTree<Key, Value, Compare, Fanout, Alloc>::insertValue(const Key& key, Value&& value) {
+    if (root == nullptr) {
+        root = createLeaf();
+    }
+    Key splitKey;
+    Node* right = insert(root, key, std::move(value), splitKey);
+    if (right != nullptr) { // the root has been split, the tree grows by one level
+        Internal* newRoot = createInternal();
+        newRoot->keys[0] = splitKey;
+        newRoot->children[0] = root;
+        newRoot->children[1] = right;
+        newRoot->count = 1;
+        root = newRoot;
+    }
+    ++numOfKeys;
+}
+
+// insert in the subtree of node, returning the new right sibling (and its separator in splitKey) if node has been split
+template <typename Key, typename Value, typename Compare, unsigned int Fanout, typename Alloc>
+typename BPlusTree<Key, Value, Compare, Fanout, Alloc>::Node* BPlusTree<Key, Value, Compare, Fanout, Alloc>::insert(Node* node, const Key& key, Value&& value, Key& splitKey) {
+    if (node->leaf) {
+        Leaf* leaf = static_cast<Leaf*>(node);
+        uint position = Keys::lowerBound(leaf->keys, leaf->count, key, comp);
+        for (uint i = leaf->count; i > position; --i) {
+            leaf->keys[i] = leaf->keys[i - 1];
+            leaf->values[i] = std::move(leaf->values[i - 1]);
+        }
+        leaf->keys[position] = key;
+        leaf->values[position] = std::move(value);
+        if (++leaf->count < Fanout) {
+            return nullptr;
+        }
+
+        Leaf* right = createLeaf();
+        uint mid = leaf->count / 2;
+        for (uint i = mid; i < leaf->count; ++i) {
+            right->keys[i - mid] = leaf->keys[i];
+            right->values[i - mid] = std::move(leaf->values[i]);
+            leaf->values[i] = Value();
+        }
+        right->count = leaf->count - mid;
+        leaf->count = mid;
+        Keys::pad(leaf->keys, mid, Node::Capacity);
+
+        right->next = leaf->next;
+        if (right->next != nullptr) {
+            right->next->prev = right;
+        }
+        right->prev = leaf;
+        leaf->next = right;
+        splitKey = leaf->keys[mid - 1]; // the largest key on the left
+        return right;
+    }
+
+    Internal* internal = static_cast<Internal*>(node);
+    uint index = Keys::lowerBound(internal->keys, internal->count, key, comp);
+    Key childSplitKey;
+    Node* child = insert(internal->children[index], key, std::move(value), childSplitKey);
+    if (child == nullptr) {
+        return nullptr;
+    }
+    for (uint i = internal->count; i > index; --i) {
+        internal->keys[i] = internal->keys[i - 1];
+        internal->children[i + 1] = internal->children[i];
+    }
+    internal->keys[index] = childSplitKey;
+    internal->children[index + 1] = child;
+    if (++internal->count < Fanout) {
+        return nullptr;
+    }
+
+    Internal* right = createInternal();
+    uint mid = internal->count / 2;
+    splitKey = internal->keys[mid]; // the middle key moves up
+    for (uint i = mid + 1; i < internal->count; ++i) {
+        right->keys[i - mid - 1] = internal->keys[i];
+    }
+    for (uint i = mid + 1; i <= internal->count; ++i) {
+        right->children[i - mid - 1] = internal->children[i];
+    }
+    right->count = internal->count - mid - 1;
+    internal->count = mid;
+    Keys::pad(internal->keys, mid, Node::Capacity);
+    return right;
+}
+
+template <typename Key, typename Value, typename Compare, unsigned int Fanout, typename Alloc>
+Value* BPlusTree<Key, Value, Compare, Fanout, Alloc>::search(const Key& key) {
+    return const_cast<Value*>(static_cast<const BPlusTree*>(this)->search(key));
+}
+
+template <typename Key, typename Value, typename Compare, unsigned int Fanout, typename Alloc>
+const Value* BPlusTree<Key, Value, Compare, Fanout, Alloc>::search(const Key& key) const {
+    if (root == nullptr) {
+        return nullptr;
+    }
+    Leaf* leaf = findLeaf(key);
+    uint position = Keys::lowerBound(leaf->keys, leaf->count, key, comp);
+    if (position == leaf->count) { // every key of the leaf is smaller, the next one starts with the first key not less than key
+        leaf = leaf->next;
+        position = 0;
+        if (leaf == nullptr) {
+            return nullptr;
+        }
+    }
+    return comp(key, leaf->keys[position]) ? nullptr : &leaf->values[position];
+}
+
+template <typename Key, typename Value, typename Compare, unsigned int Fanout, typename Alloc>
+bool BPlusTree<Key, Value, Compare, Fanout, Alloc>::remove(const Key& key) {
+    if (root == nullptr || !remove(root, key)) {
+        return false;
+    }
+    --numOfKeys;
+    if (root->count == 0) { // the root is empty: drop a level, or the whole tree
+        Node* oldRoot = root;
+        root = root->leaf ? nullptr : static_cast<Internal*>(root)->children[0];
+        destroyNode(oldRoot);
+    }
+    return true;
+}
+
+// remove from the subtree of node, the caller fixes node if it is left with too few keys
+template <typename Key, typename Value, typename Compare, unsigned int Fanout, typename Alloc>
+bool BPlusTree<Key, Value, Compare, Fanout, Alloc>::remove(Node* node, const Key& key) {
+    if (node->leaf) {
+        Leaf* leaf = static_cast<Leaf*>(node);
+        uint position = Keys::lowerBound(leaf->keys, leaf->count, key, comp);
+        if (position == leaf->count || comp(key, leaf->keys[position])) {
+            return false;
+        }
+        for (uint i = position + 1; i < leaf->count; ++i) {
+            leaf->keys[i - 1] = leaf->keys[i];
+            leaf->values[i - 1] = std::move(leaf->values[i]);
+        }
+        --leaf->count;
+        leaf->values[leaf->count] = Value();
+        Keys::pad(leaf->keys, leaf->count, leaf->count + 1);
+        return true;
+    }
+
+    Internal* internal = static_cast<Internal*>(node);
+    uint index = Keys::lowerBound(internal->keys, internal->count, key, comp);
+    while (!remove(internal->children[index], key)) {
+        // copies of a separator can continue in the next child
+        if (index == internal->count || comp(key, internal->keys[index])) {
+            return false;
+        }
+        ++index;
+    }
+    fixUnderflow(internal, index);
+    return true;
+}
+
+// fixers
+template <typename Key, typename Value, typename Compare, unsigned int Fanout, typename Alloc>
+void BPlusTree<Key, Value, Compare, Fanout, Alloc>::fixUnderflow(Internal* parent, uint index) {
+    if (parent->children[index]->count >= MIN_KEYS) {
+        return;
+    }
+    if (index > 0 && parent->children[index - 1]->count > MIN_KEYS) {
+        borrowFromLeft(parent, index);
+    } else if (index < parent->count && parent->children[index + 1]->count > MIN_KEYS) {
+        borrowFromRight(parent, index);
+    } else if (index > 0) {
+        merge(parent, index - 1);
+    } else {
+        merge(parent, index);
+    }
+}
+
+template <typename Key, typename Value, typename Compare, unsigned int Fanout, typename Alloc>
+void BPlusTree<Key, Value, Compare, Fanout, Alloc>::borrowFromLeft(Internal* parent, uint index) {
+    if (parent->children[index]->leaf) {
+        Leaf* child = static_cast<Leaf*>(parent->children[index]);
+        Leaf* left = static_cast<Leaf*>(parent->children[index - 1]);
+        for (uint i = child->count; i > 0; --i) {
+            child->keys[i] = child->keys[i - 1];
+            child->values[i] = std::move(child->values[i - 1]);
+        }
+        --left->count;
+        child->keys[0] = left->keys[left->count];
+        child->values[0] = std::move(left->values[left->count]);
+        left->values[left->count] = Value();
+        Keys::pad(left->keys, left->count, left->count + 1);
+        ++child->count;
+        parent->keys[index - 1] = left->keys[left->count - 1];
+        return;
+    }
+
+    Internal* child = static_cast<Internal*>(parent->children[index]);
+    Internal* left = static_cast<Internal*>(parent->children[index - 1]);
+    child->children[child->count + 1] = child->children[child->count];
+    for (uint i = child->count; i > 0; --i) {
+        child->keys[i] = child->keys[i - 1];
+        child->children[i] = child->children[i - 1];
+    }
+    child->keys[0] = parent->keys[index - 1]; // the separator moves down, the last key of left moves up
+    child->children[0] = left->children[left->count];
+    ++child->count;
+    --left->count;
+    parent->keys[index - 1] = left->keys[left->count];
+    Keys::pad(left->keys, left->count, left->count + 1);
+}
+
+template <typename Key, typename Value, typename Compare, unsigned int Fanout, typename Alloc>
+void BPlusTree<Key, Value, Compare, Fanout, Alloc>::borrowFromRight(Internal* parent, uint index) {
+    if (parent->children[index]->leaf) {
+        Leaf* child = static_cast<Leaf*>(parent->children[index]);
+        Leaf* right = static_cast<Leaf*>(parent->children[index + 1]);
+        child->keys[child->count] = right->keys[0];
+        child->values[child->count] = std::move(right->values[0]);
+        ++child->count;
+        for (uint i = 1; i < right->count; ++i) {
+            right->keys[i - 1] = right->keys[i];
+            right->values[i - 1] = std::move(right->values[i]);
+        }
+        --right->count;
+        right->values[right->count] = Value();
+        Keys::pad(right->keys, right->count, right->count + 1);
+        parent->keys[index] = child->keys[child->count - 1];
+        return;
+    }
+
+    Internal* child = static_cast<Internal*>(parent->children[index]);
+    Internal* right = static_cast<Internal*>(parent->children[index + 1]);
+    child->keys[child->count] = parent->keys[index]; // the separator moves down, the first key of right moves up
+    child->children[child->count + 1] = right->children[0];
+    ++child->count;
+    parent->keys[index] = right->keys[0];
+    for (uint i = 1; i < right->count; ++i) {
+        right->keys[i - 1] = right->keys[i];
+    }
+    for (uint i = 1; i <= right->count; ++i) {
+        right->children[i - 1] = right->children[i];
+    }
+    --right->count;
+    Keys::pad(right->keys, right->count, right->count + 1);
+}
+
+// merge children[index + 1] into children[index]
+template <typename Key, typename Value, typename Compare, unsigned int Fanout, typename Alloc>
+void BPlusTree<Key, Value, Compare, Fanout, Alloc>::merge(Internal* parent, uint index) {
+    if (parent->children[index]->leaf) {
+        Leaf* left = static_cast<Leaf*>(parent->children[index]);
+        Leaf* right = static_cast<Leaf*>(parent->children[index + 1]);
+        for (uint i{0}; i < right->count; ++i) {
+            left->keys[left->count + i] = right->keys[i];
+            left->values[left->count + i] = std::move(right->values[i]);
+        }
+        left->count += right->count;
+        left->next = right->next;
+        if (left->next != nullptr) {
+            left->next->prev = left;
+        }
+    } else {
+        Internal* left = static_cast<Internal*>(parent->children[index]);
+        Internal* right = static_cast<Internal*>(parent->children[index + 1]);
+        left->keys[left->count] = parent->keys[index];
+        for (uint i{0}; i < right->count; ++i) {
+            left->keys[left->count + 1 + i] = right->keys[i];
+        }
+        for (uint i{0}; i <= right->count; ++i) {
+            left->children[left->count + 1 + i] = right->children[i];
+        }
+        left->count += 1 + right->count;
+    }
+    destroyNode(parent->children[index + 1]);
+    removeChild(parent, index);
+}
+
+// drop keys[index] and children[index + 1] from parent
+template <typename Key, typename Value, typename Compare, unsigned int Fanout, typename Alloc>
+void BPlusTree<Key, Value, Compare, Fanout, Alloc>::removeChild(Internal* parent, uint index) {
+    for (uint i = index + 1; i < parent->count; ++i) {
+        parent->keys[i - 1] = parent->keys[i];
+        parent->children[i] = parent->children[i + 1];
+    }
+    --parent->count;
+    Keys::pad(parent->keys, parent->count, parent->count + 1);
+}
+
+// range scan
+template <typename Key, typename Value, typename Compare, unsigned int Fanout, typename Alloc>
+template <typename F>
+void BPlusTree<Key, Value, Compare, Fanout, Alloc>::rangeScan(const Key& lo, const Key& hi, F visit) const {
+    if (root == nullptr) {
+        return;
+    }
+    Leaf* leaf = findLeaf(lo);
+    uint position = Keys::lowerBound(leaf->keys, leaf->count, lo, comp);
+    while (leaf != nullptr) {
+        for (; position < leaf->count; ++position) {
+            if (comp(hi, leaf->keys[position])) {
+                return;
+            }
+            visit(leaf->keys[position], leaf->values[position]);
+        }
+        leaf = leaf->next;
+        position = 0;
+    }
+}
@@ -8,78 +8,375 @@
  * 
  */
 
+#include <algorithm>
 #include "BinarySearchTree.hpp"
 #include "TreeNodeObject.hpp"
 #include "TreeNode.hpp"
 
 // constructors and destructor
-template <bool CMP(const int& key1, const int& key2)>
-BinarySearchTree<CMP>::BinarySearchTree() {}
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+BinarySearchTree<Key, Value, Compare, Alloc, Node>::BinarySearchTree(const Compare& comp, const Alloc& alloc)
+    : comp(comp), nodeAllocator{alloc} {}
 
-template <bool CMP(const int& key1, const int& key2)>
-BinarySearchTree<CMP>::BinarySearchTree(sptr_TreeNode root)
-    : root{root} {
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+BinarySearchTree<Key, Value, Compare, Alloc, Node>::BinarySearchTree(ptr_TreeNode<Key, Value> root, const Compare& comp, const Alloc& alloc)
+    : comp(comp), nodeAllocator{alloc}, root{root} {
     ++numOfNodes;
+    if (root != nullValue) {
+        updateNode(root);
+    }
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+BinarySearchTree<Key, Value, Compare, Alloc, Node>::BinarySearchTree(BinarySearchTree&& other)
+    : comp(other.comp), nodeAllocator{other.nodeAllocator}, root{other.root}, nullValue{other.nullValue}, numOfNodes{other.numOfNodes}, countStale{other.countStale},
+      finger{other.finger}, fingerPrev{other.fingerPrev}, fingerNext{other.fingerNext}, fingerValid{other.fingerValid}, blocks(std::move(other.blocks)) {
+    other.resetFinger();
+    other.root = nullptr;
+    other.nullValue = nullptr;
+    other.numOfNodes = 0;
+    other.countStale = false;
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-BinarySearchTree<CMP>::~BinarySearchTree() {} // no need to delete nodes because they are shared_ptr
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+BinarySearchTree<Key, Value, Compare, Alloc, Node>::~BinarySearchTree() {
+    clear();
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+void BinarySearchTree<Key, Value, Compare, Alloc, Node>::clear() {
+    destroySubtree(root);
+    root = nullValue;
+    numOfNodes = 0;
+    countStale = false;
+}
  
-template <bool CMP(const int& key1, const int& key2)>
-inline bool BinarySearchTree<CMP>::isEmpty() const {
-    return numOfNodes == 0;
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+inline bool BinarySearchTree<Key, Value, Compare, Alloc, Node>::isEmpty() const {
+    return root == nullValue;
 }
 
 // getters
-template <bool CMP(const int& key1, const int& key2)>
-inline uint BinarySearchTree<CMP>::getNumOfNodes() const {
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+inline uint BinarySearchTree<Key, Value, Compare, Alloc, Node>::getNumOfNodes() const {
+    if (countStale && Augmentation::ENABLED) { // the root knows the size of the tree
+        numOfNodes = Augmentation::size(static_cast<const Node*>(root));
+        countStale = false;
+    } else if (countStale) { // counted once after a split, then kept up to date again
+        numOfNodes = 0;
+        for (ptr_TreeNode<Key, Value> node = root == nullValue ? nullValue : minimum(root); node != nullValue; node = successor(node)) {
+            ++numOfNodes;
+        }
+        countStale = false;
+    }
     return numOfNodes;
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-inline sptr_TreeNode BinarySearchTree<CMP>::getRoot() const {
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+inline ptr_TreeNode<Key, Value> BinarySearchTree<Key, Value, Compare, Alloc, Node>::getRoot() const {
     return root;
 }
 
 // core functionalities
-template <bool CMP(const int& key1, const int& key2)>
-void BinarySearchTree<CMP>::insert(sptr_TreeNode&& node) {
-    sptr_TreeNode prev = nullValue;
-    sptr_TreeNode curr = root;
-    
+// a key between the neighbours of the finger (sorted or nearly sorted input) is linked next to it without searching,
+// any other key is searched from the finger, climbing only as far as needed
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+void BinarySearchTree<Key, Value, Compare, Alloc, Node>::insert(ptr_TreeNode<Key, Value> node) {
+    if (!fingerValid) {
+        insertNear(nullValue, node);
+    } else if ((fingerPrev == nullValue || !comp(node->getKey(), fingerPrev->getKey())) && (fingerNext == nullValue || !comp(fingerNext->getKey(), node->getKey()))) {
+        linkAtFinger(node);
+    } else {
+        insertNear(finger, node, FINGER_CLIMB);
+    }
+}
+
+// insert node descending from hint instead of the root (the node inserted just before, for sorted batches): climb
+// while the key is past the bound of the subtree of hint on its side, the bound on the other side is hint itself;
+// after maxClimb levels the key is far from hint and is searched from the root
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+void BinarySearchTree<Key, Value, Compare, Alloc, Node>::insertNear(ptr_TreeNode<Key, Value> hint, ptr_TreeNode<Key, Value> node, uint maxClimb) {
+    ptr_TreeNode<Key, Value> curr = root;
+    ptr_TreeNode<Key, Value> lower = nullValue; // the in-order neighbours of node, narrowed while descending
+    ptr_TreeNode<Key, Value> upper = nullValue;
+    if (hint != nullValue) {
+        curr = hint;
+        bool after = !comp(node->getKey(), hint->getKey());
+        for (uint climbed{0}; curr != root; ++climbed) {
+            ptr_TreeNode<Key, Value> parent = curr->getParent();
+            if (after && curr == parent->getLeft() && comp(node->getKey(), parent->getKey())) {
+                upper = parent; // the key falls inside the subtree of curr
+                break;
+            } else if (!after && curr == parent->getRight() && !comp(node->getKey(), parent->getKey())) {
+                lower = parent;
+                break;
+            } else if (climbed == maxClimb) {
+                curr = root;
+                break;
+            }
+            curr = parent;
+        }
+    }
+    ptr_TreeNode<Key, Value> prev = nullValue;
+
     while (curr != nullValue) {
         prev = curr;
-        curr = CMP(node->getObjKey(), curr->getObjKey()) ? curr->getLeft() : curr->getRight(); // choose left or right child
+        if (comp(node->getKey(), curr->getKey())) { // choose left or right child
+            upper = curr;
+            curr = curr->getLeft();
+        } else {
+            lower = curr;
+            curr = curr->getRight();
+        }
     }
 
     node->setParent(prev);
     if (prev == nullValue) {
         root = node;
-    } else if (CMP(node->getObjKey(), prev->getObjKey())) {
+    } else if (comp(node->getKey(), prev->getKey())) {
         prev->setLeft(node);
     } else {
         prev->setRight(node);
     }
+    updatePath(node);
 
     ++numOfNodes;
+    finger = node;
+    fingerPrev = lower;
+    fingerNext = upper;
+    fingerValid = true;
+}
+
+// link node between the finger and one of its neighbours: the finger has no child on that side, or the neighbour,
+// the extreme of that subtree, has none on the other
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+void BinarySearchTree<Key, Value, Compare, Alloc, Node>::linkAtFinger(ptr_TreeNode<Key, Value> node) {
+    if (comp(node->getKey(), finger->getKey())) {
+        if (finger->getLeft() == nullValue) {
+            finger->setLeft(node);
+            node->setParent(finger);
+        } else {
+            fingerPrev->setRight(node);
+            node->setParent(fingerPrev);
+        }
+        fingerNext = finger;
+    } else {
+        if (finger->getRight() == nullValue) {
+            finger->setRight(node);
+            node->setParent(finger);
+        } else {
+            fingerNext->setLeft(node);
+            node->setParent(fingerNext);
+        }
+        fingerPrev = finger;
+    }
+    finger = node;
+    updatePath(node);
+    ++numOfNodes;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+inline void BinarySearchTree<Key, Value, Compare, Alloc, Node>::resetFinger() {
+    fingerValid = false;
+}
+
+// the neighbours of the finger change only if one of the three nodes leaves the tree
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+inline void BinarySearchTree<Key, Value, Compare, Alloc, Node>::forgetNode(ptr_TreeNode<Key, Value> node) {
+    if (node == finger || node == fingerPrev || node == fingerNext) {
+        fingerValid = false;
+    }
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+void BinarySearchTree<Key, Value, Compare, Alloc, Node>::insert(const Key& key, const Value& value) {
+    emplace(key, value);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+void BinarySearchTree<Key, Value, Compare, Alloc, Node>::insert(const Key& key, Value&& value) {
+    emplace(key, std::move(value));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+template <typename... Args>
+ptr_TreeNode<Key, Value> BinarySearchTree<Key, Value, Compare, Alloc, Node>::emplace(const Key& key, Args&&... args) {
+    ptr_TreeNode<Key, Value> node = createNode(key, std::forward<Args>(args)...);
+    insert(node);
+    return node;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+void BinarySearchTree<Key, Value, Compare, Alloc, Node>::insert(TreeNodeObject* obj) {
+    emplace(obj->getKey(), shareObject(obj));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+template <typename... Args>
+ptr_TreeNode<Key, Value> BinarySearchTree<Key, Value, Compare, Alloc, Node>::emplaceHint(ptr_TreeNode<Key, Value> hint, const Key& key, Args&&... args) {
+    ptr_TreeNode<Key, Value> node = createNode(key, std::forward<Args>(args)...);
+    insertNear(hint, node);
+    return node;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+ptr_TreeNode<Key, Value> BinarySearchTree<Key, Value, Compare, Alloc, Node>::insert(ptr_TreeNode<Key, Value> hint, TreeNodeObject* obj) {
+    return emplaceHint(hint, obj->getKey(), shareObject(obj));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+void BinarySearchTree<Key, Value, Compare, Alloc, Node>::insertBatch(std::vector<std::pair<Key, Value>> batch) {
+    if (mergeBatch(batch, keepShape)) {
+        return;
+    }
+    ptr_TreeNode<Key, Value> hint = nullValue;
+    for (typename std::vector<std::pair<Key, Value>>::iterator it = batch.begin(); it != batch.end(); ++it) {
+        ptr_TreeNode<Key, Value> node = createNode(it->first, std::move(it->second));
+        insertNear(hint, node);
+        hint = node;
+    }
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+void BinarySearchTree<Key, Value, Compare, Alloc, Node>::insertBatch(const std::vector<TreeNodeObject*>& objects) {
+    std::vector<std::pair<Key, Value>> batch;
+    batch.reserve(objects.size());
+    for (TreeNodeObject* obj : objects) {
+        batch.emplace_back(obj->getKey(), shareObject(obj));
+    }
+    insertBatch(std::move(batch));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+void BinarySearchTree<Key, Value, Compare, Alloc, Node>::remove(ptr_TreeNode<Key, Value> node) {
+    unlink(node);
+    destroyNode(node);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+bool BinarySearchTree<Key, Value, Compare, Alloc, Node>::erase(const Key& key) {
+    ptr_TreeNode<Key, Value> node = search(root, key);
+    if (node == nullValue) {
+        return false;
+    }
+    remove(node);
+    return true;
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-void BinarySearchTree<CMP>::insert(sptr_TreeNodeObject&& object) {
-    insert(std::make_shared<TreeNode>(object)); // passing a rvalue, using make_shared (calling TreeNode constructor)
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+uint BinarySearchTree<Key, Value, Compare, Alloc, Node>::eraseRange(const Key& lo, const Key& hi) {
+    if (comp(hi, lo)) {
+        return 0;
+    }
+    // the first node in the range met descending from the root, none of its ancestors is in the range
+    ptr_TreeNode<Key, Value> parent = nullValue;
+    ptr_TreeNode<Key, Value> node = root;
+    while (node != nullValue && (comp(node->getKey(), lo) || comp(hi, node->getKey()))) {
+        parent = node;
+        node = comp(node->getKey(), lo) ? node->getRight() : node->getLeft();
+    }
+    if (node == nullValue) {
+        return 0;
+    }
+    resetFinger();
+    uint count{1};
+    // the keys on the left of node are not greater than hi: the ones less than lo form a chain of right children,
+    // the others are dropped with their right subtrees, which are inside the range
+    ptr_TreeNode<Key, Value> left = nullValue;
+    ptr_TreeNode<Key, Value> leftLast = nullValue;
+    for (ptr_TreeNode<Key, Value> ptr = node->getLeft(); ptr != nullValue; ) {
+        if (comp(ptr->getKey(), lo)) {
+            if (leftLast == nullValue) {
+                left = ptr;
+            } else {
+                leftLast->setRight(ptr);
+                ptr->setParent(leftLast);
+            }
+            leftLast = ptr;
+            ptr = ptr->getRight();
+        } else {
+            ptr_TreeNode<Key, Value> next = ptr->getLeft();
+            count += destroySubtree(ptr->getRight()) + 1;
+            destroyNode(ptr);
+            ptr = next;
+        }
+    }
+    if (leftLast != nullValue) {
+        leftLast->setRight(nullValue);
+    }
+    // and symmetrically on the right, where the keys are not less than lo
+    ptr_TreeNode<Key, Value> right = nullValue;
+    ptr_TreeNode<Key, Value> rightLast = nullValue;
+    for (ptr_TreeNode<Key, Value> ptr = node->getRight(); ptr != nullValue; ) {
+        if (comp(hi, ptr->getKey())) {
+            if (rightLast == nullValue) {
+                right = ptr;
+            } else {
+                rightLast->setLeft(ptr);
+                ptr->setParent(rightLast);
+            }
+            rightLast = ptr;
+            ptr = ptr->getLeft();
+        } else {
+            ptr_TreeNode<Key, Value> next = ptr->getRight();
+            count += destroySubtree(ptr->getLeft()) + 1;
+            destroyNode(ptr);
+            ptr = next;
+        }
+    }
+    if (rightLast != nullValue) {
+        rightLast->setLeft(nullValue);
+    }
+
+    ptr_TreeNode<Key, Value> merged = left;
+    if (left == nullValue) {
+        merged = right;
+    } else if (right != nullValue) { // every key of right follows the maximum of left
+        ptr_TreeNode<Key, Value> leftMax = maximum(left);
+        leftMax->setRight(right);
+        right->setParent(leftMax);
+    }
+    if (parent == nullValue) {
+        root = merged;
+    } else if (parent->getLeft() == node) {
+        parent->setLeft(merged);
+    } else {
+        parent->setRight(merged);
+    }
+    if (merged != nullValue) {
+        merged->setParent(parent);
+    }
+    destroyNode(node);
+    // the deepest changed node is the end of the right chain, hung below the left one, or the end of the left chain
+    updatePath(rightLast != nullValue ? rightLast : (leftLast != nullValue ? leftLast : parent));
+    if (!countStale) {
+        numOfNodes -= count;
+    }
+    return count;
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-void BinarySearchTree<CMP>::insert(TreeNodeObject* obj) {
-    insert(std::shared_ptr<TreeNodeObject>(obj)); // passing a rvalue, using shared_ptr constructor
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+void BinarySearchTree<Key, Value, Compare, Alloc, Node>::removeBatch(std::vector<Key> keys) {
+    if (mergeRemoveBatch(keys, keepShape)) {
+        return;
+    }
+    for (typename std::vector<Key>::const_iterator key = keys.begin(); key != keys.end(); ++key) {
+        ptr_TreeNode<Key, Value> node = search(*key);
+        if (node != nullValue) {
+            remove(node);
+        }
+    }
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-sptr_TreeNode BinarySearchTree<CMP>::remove(sptr_TreeNode node) {
-    sptr_TreeNode retValue = nullValue;
+// detach the node from the tree without freeing it, returning the node where the rebalancing should start
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+ptr_TreeNode<Key, Value> BinarySearchTree<Key, Value, Compare, Alloc, Node>::unlink(ptr_TreeNode<Key, Value> node) {
+    ptr_TreeNode<Key, Value> retValue = nullValue;
+    ptr_TreeNode<Key, Value> changed = node->getParent(); // the lowest node whose subtree changes
+    forgetNode(node);
     if (node->getLeft() == nullValue && node->getRight() == nullValue) {
         // If the node has no children, we can simply remove it and return the parent
-        transplant(node, std::move(nullValue));
+        transplant(node, nullValue);
         retValue = node->getParent();
     } else if (node->getLeft() == nullValue) {
         // If the node has only one child, we can replace it with its child and return the child
@@ -90,7 +387,7 @@ sptr_TreeNode BinarySearchTree<CMP>::remove(sptr_TreeNode node) {
         transplant(node, node->getLeft());
         retValue = node->getLeft();
     } else {
-        sptr_TreeNode ptr = minimum(node->getRight());
+        ptr_TreeNode<Key, Value> ptr = minimum(node->getRight());
         retValue = ptr->getRight(); // we return the right child of the successor only if the successor itself isn't the right child of the node (see next if statement)
         if (ptr->getParent() == node) {
             retValue = ptr;
@@ -98,38 +395,46 @@ sptr_TreeNode BinarySearchTree<CMP>::remove(sptr_TreeNode node) {
         if (retValue == nullValue) { // if the successor has no right child, we return the parent of the successor
             retValue = ptr->getParent();
         }
+        changed = (ptr->getParent() == node) ? ptr : ptr->getParent();
         if (ptr->getParent() != node) {
             transplant(ptr, ptr->getRight());
             ptr->setRight(node->getRight());
             ptr->getRight()->setParent(ptr);
         }
-        transplant(node, std::move(ptr));
+        transplant(node, ptr);
         ptr->setLeft(node->getLeft());
         ptr->getLeft()->setParent(ptr);
     }
+    updatePath(changed);
     
     --numOfNodes;
     return retValue;
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-sptr_TreeNode BinarySearchTree<CMP>::search(sptr_TreeNode root, int key) const {
-    while (root != nullValue && key != root->getObjKey()) {
-        root = (CMP(key, root->getObjKey())) ? root->getLeft() : root->getRight();
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+ptr_TreeNode<Key, Value> BinarySearchTree<Key, Value, Compare, Alloc, Node>::search(ptr_TreeNode<Key, Value> root, const Key& key) const {
+    while (root != nullValue) {
+        if (comp(key, root->getKey())) {
+            root = root->getLeft();
+        } else if (comp(root->getKey(), key)) {
+            root = root->getRight();
+        } else {
+            break;
+        }
     }
     return root;
 }
-template <bool CMP(const int& key1, const int& key2)>
-inline sptr_TreeNode BinarySearchTree<CMP>::search(int key) const {
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+inline ptr_TreeNode<Key, Value> BinarySearchTree<Key, Value, Compare, Alloc, Node>::search(const Key& key) const {
     return search(root, key);
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-inline sptr_TreeNode BinarySearchTree<CMP>::successor(sptr_TreeNode node) const { 
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+inline ptr_TreeNode<Key, Value> BinarySearchTree<Key, Value, Compare, Alloc, Node>::successor(ptr_TreeNode<Key, Value> node) const { 
     if (node->getRight() != nullValue) {
         return minimum(node->getRight());
     }
-    sptr_TreeNode ptr = node->getParent();
+    ptr_TreeNode<Key, Value> ptr = node->getParent();
     while (ptr != nullValue && node == ptr->getRight()) {
         node = ptr;
         ptr = ptr->getParent();
@@ -137,8 +442,77 @@ inline sptr_TreeNode BinarySearchTree<CMP>::successor(sptr_TreeNode node) const
     return ptr;
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-uint BinarySearchTree<CMP>::findNumLeaves(const sptr_TreeNode& root) const {
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+ptr_TreeNode<Key, Value> BinarySearchTree<Key, Value, Compare, Alloc, Node>::predecessor(ptr_TreeNode<Key, Value> node) const {
+    if (node->getLeft() != nullValue) {
+        return maximum(node->getLeft());
+    }
+    ptr_TreeNode<Key, Value> ptr = node->getParent();
+    while (ptr != nullValue && node == ptr->getLeft()) {
+        node = ptr;
+        ptr = ptr->getParent();
+    }
+    return ptr;
+}
+
+// iterators and range scans
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+typename BinarySearchTree<Key, Value, Compare, Alloc, Node>::iterator BinarySearchTree<Key, Value, Compare, Alloc, Node>::begin() const {
+    return iterator(this, (root == nullValue) ? nullValue : minimum(root));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+inline typename BinarySearchTree<Key, Value, Compare, Alloc, Node>::iterator BinarySearchTree<Key, Value, Compare, Alloc, Node>::end() const {
+    return iterator(this, nullValue);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+typename BinarySearchTree<Key, Value, Compare, Alloc, Node>::iterator BinarySearchTree<Key, Value, Compare, Alloc, Node>::lower_bound(const Key& key) const {
+    ptr_TreeNode<Key, Value> bound = nullValue;
+    ptr_TreeNode<Key, Value> node = root;
+    while (node != nullValue) {
+        if (comp(node->getKey(), key)) {
+            node = node->getRight();
+        } else { // a candidate, a smaller one can only be on the left
+            bound = node;
+            node = node->getLeft();
+        }
+    }
+    return iterator(this, bound);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+typename BinarySearchTree<Key, Value, Compare, Alloc, Node>::iterator BinarySearchTree<Key, Value, Compare, Alloc, Node>::upper_bound(const Key& key) const {
+    ptr_TreeNode<Key, Value> bound = nullValue;
+    ptr_TreeNode<Key, Value> node = root;
+    while (node != nullValue) {
+        if (comp(key, node->getKey())) {
+            bound = node;
+            node = node->getLeft();
+        } else {
+            node = node->getRight();
+        }
+    }
+    return iterator(this, bound);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+std::pair<typename BinarySearchTree<Key, Value, Compare, Alloc, Node>::iterator, typename BinarySearchTree<Key, Value, Compare, Alloc, Node>::iterator> BinarySearchTree<Key, Value, Compare, Alloc, Node>::equal_range(const Key& key) const {
+    return std::make_pair(lower_bound(key), upper_bound(key));
+}
+
+// one descent to the first node of the range, then successor steps: the parent links are climbed at most once
+// each, so the scan costs O(log n + k)
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+template <typename F>
+void BinarySearchTree<Key, Value, Compare, Alloc, Node>::forEachInRange(const Key& lo, const Key& hi, F visit) const {
+    for (ptr_TreeNode<Key, Value> node = lower_bound(lo).node; node != nullValue && !comp(hi, node->getKey()); node = successor(node)) {
+        visit(node->getKey(), node->getValue());
+    }
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+uint BinarySearchTree<Key, Value, Compare, Alloc, Node>::findNumLeaves(ptr_TreeNode<Key, Value> root) const {
     if (root == nullValue) {
         return 0;
     } else if (root->getLeft() == nullValue && root->getRight() == nullValue) {
@@ -148,27 +522,113 @@ uint BinarySearchTree<CMP>::findNumLeaves(const sptr_TreeNode& root) const {
     }
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-inline uint BinarySearchTree<CMP>::findNumLeaves() const {
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+inline uint BinarySearchTree<Key, Value, Compare, Alloc, Node>::findNumLeaves() const {
     return findNumLeaves(root);
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-sptr_TreeNode BinarySearchTree<CMP>::minimum(const sptr_TreeNode& root) const {
-    sptr_TreeNode ptr = root;
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+uint BinarySearchTree<Key, Value, Compare, Alloc, Node>::countLess(const Key& key, bool orEqual) const {
+    static_assert(Augmentation::ENABLED, "the order statistics need the subtree sizes in the nodes (SubtreeSize)");
+    uint count{0};
+    ptr_TreeNode<Key, Value> node = root;
+    while (node != nullValue) {
+        if (orEqual ? !comp(key, node->getKey()) : comp(node->getKey(), key)) { // node and its left subtree are counted
+            count += Augmentation::size(static_cast<const Node*>(node->getLeft())) + 1;
+            node = node->getRight();
+        } else {
+            node = node->getLeft();
+        }
+    }
+    return count;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+uint BinarySearchTree<Key, Value, Compare, Alloc, Node>::rank(const Key& key) const {
+    return countLess(key, false);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+ptr_TreeNode<Key, Value> BinarySearchTree<Key, Value, Compare, Alloc, Node>::select(uint index) const {
+    static_assert(Augmentation::ENABLED, "the order statistics need the subtree sizes in the nodes (SubtreeSize)");
+    ptr_TreeNode<Key, Value> node = root;
+    while (node != nullValue) {
+        uint leftSize = Augmentation::size(static_cast<const Node*>(node->getLeft()));
+        if (index < leftSize) {
+            node = node->getLeft();
+        } else if (index == leftSize) {
+            break;
+        } else {
+            index -= leftSize + 1;
+            node = node->getRight();
+        }
+    }
+    return node;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+uint BinarySearchTree<Key, Value, Compare, Alloc, Node>::countInRange(const Key& lo, const Key& hi) const {
+    if (comp(hi, lo)) {
+        return 0;
+    }
+    return countLess(hi, true) - countLess(lo, false);
+}
+
+// the range splits at the first node inside it: the nodes of its left subtree not less than lo and the ones of its
+// right subtree not greater than hi are combined along the two paths to the bounds, one subtree aggregate per step
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+template <typename A>
+typename A::Type BinarySearchTree<Key, Value, Compare, Alloc, Node>::aggregate(const Key& lo, const Key& hi) const {
+    ptr_TreeNode<Key, Value> split = root;
+    while (split != nullValue && (comp(split->getKey(), lo) || comp(hi, split->getKey()))) {
+        split = comp(split->getKey(), lo) ? split->getRight() : split->getLeft();
+    }
+    if (split == nullValue) {
+        return A::identity();
+    }
+    typename A::Type leftPart = A::identity();
+    for (ptr_TreeNode<Key, Value> node = split->getLeft(); node != nullValue; ) {
+        if (comp(node->getKey(), lo)) {
+            node = node->getRight();
+        } else {
+            leftPart = A::combine(A::combine(A::lift(static_cast<const Node*>(node)), A::aggregate(static_cast<const Node*>(node->getRight()))), leftPart);
+            node = node->getLeft();
+        }
+    }
+    typename A::Type rightPart = A::identity();
+    for (ptr_TreeNode<Key, Value> node = split->getRight(); node != nullValue; ) {
+        if (comp(hi, node->getKey())) {
+            node = node->getLeft();
+        } else {
+            rightPart = A::combine(rightPart, A::combine(A::aggregate(static_cast<const Node*>(node->getLeft())), A::lift(static_cast<const Node*>(node))));
+            node = node->getRight();
+        }
+    }
+    return A::combine(A::combine(leftPart, A::lift(static_cast<const Node*>(split))), rightPart);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+void BinarySearchTree<Key, Value, Compare, Alloc, Node>::updateValue(ptr_TreeNode<Key, Value> node, const Value& value) {
+    node->setValue(value);
+    updatePath(node);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+ptr_TreeNode<Key, Value> BinarySearchTree<Key, Value, Compare, Alloc, Node>::minimum(ptr_TreeNode<Key, Value> root) const {
+    ptr_TreeNode<Key, Value> ptr = root;
     while (ptr->getLeft() != nullValue) {
         ptr = ptr->getLeft();
     }
     return ptr;
 }
-template <bool CMP(const int& key1, const int& key2)>
-inline sptr_TreeNode BinarySearchTree<CMP>::minimum() const {
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+inline ptr_TreeNode<Key, Value> BinarySearchTree<Key, Value, Compare, Alloc, Node>::minimum() const {
     return minimum(root);
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-sptr_TreeNode BinarySearchTree<CMP>::maximum(const sptr_TreeNode& root) const {
-    sptr_TreeNode ptr = root;
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+ptr_TreeNode<Key, Value> BinarySearchTree<Key, Value, Compare, Alloc, Node>::maximum(ptr_TreeNode<Key, Value> root) const {
+    ptr_TreeNode<Key, Value> ptr = root;
     while (ptr->getRight() != nullValue) {
         ptr = ptr->getRight();
     }
@@ -176,13 +636,13 @@ sptr_TreeNode BinarySearchTree<CMP>::maximum(const sptr_TreeNode& root) const {
     return ptr;
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-inline sptr_TreeNode BinarySearchTree<CMP>::maximum() const {
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+inline ptr_TreeNode<Key, Value> BinarySearchTree<Key, Value, Compare, Alloc, Node>::maximum() const {
     return maximum(root);
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-void BinarySearchTree<CMP>::transplant(const sptr_TreeNode& curr_node, sptr_TreeNode&& new_node) {
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+void BinarySearchTree<Key, Value, Compare, Alloc, Node>::transplant(ptr_TreeNode<Key, Value> curr_node, ptr_TreeNode<Key, Value> new_node) {
     if (curr_node->getParent() == nullValue) {
         root = new_node;
     } else if (curr_node == curr_node->getParent()->getLeft()) {
@@ -195,25 +655,292 @@ void BinarySearchTree<CMP>::transplant(const sptr_TreeNode& curr_node, sptr_Tree
     }
 }
 
+// node management
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+template <typename... Args>
+Node* BinarySearchTree<Key, Value, Compare, Alloc, Node>::createNode(Args&&... args) {
+    Node* node = NodeAllocatorTraits::allocate(nodeAllocator, 1);
+    NodeAllocatorTraits::construct(nodeAllocator, node, std::forward<Args>(args)...);
+    return node;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+void BinarySearchTree<Key, Value, Compare, Alloc, Node>::destroyNode(ptr_TreeNode<Key, Value> node) {
+    Node* typedNode = static_cast<Node*>(node);
+    NodeAllocatorTraits::destroy(nodeAllocator, typedNode);
+    // the owner can only be the last block starting at or before the node: the live blocks do not overlap, a
+    // block freed by a tree split from this one (which may overlap newer memory) is purged when met
+    typename std::vector<std::shared_ptr<NodeBlock>>::iterator owner = std::upper_bound(blocks.begin(), blocks.end(), typedNode, beforeBlock);
+    while (owner != blocks.begin() && (*(owner - 1))->live == 0) {
+        owner = blocks.erase(owner - 1);
+    }
+    if (owner != blocks.begin()) {
+        NodeBlock& block = **(owner - 1);
+        if (std::less<Node*>()(typedNode, block.nodes + block.size)) {
+            if (--block.live == 0) {
+                NodeAllocatorTraits::deallocate(nodeAllocator, block.nodes, block.size);
+                blocks.erase(owner - 1);
+            }
+            return;
+        }
+    }
+    NodeAllocatorTraits::deallocate(nodeAllocator, typedNode, 1);
+}
+
+// the order of blocks, by start address
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+bool BinarySearchTree<Key, Value, Compare, Alloc, Node>::beforeBlock(Node* node, const std::shared_ptr<NodeBlock>& block) {
+    return std::less<Node*>()(node, block->nodes);
+}
+
+// free the nodes of a subtree with a postorder visit using the parent links, freeing the leaves, so that it does
+// not recurse; the parent of node is left untouched
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+uint BinarySearchTree<Key, Value, Compare, Alloc, Node>::destroySubtree(ptr_TreeNode<Key, Value> node) {
+    if (node == nullValue) {
+        return 0;
+    }
+    resetFinger();
+    ptr_TreeNode<Key, Value> top = node->getParent();
+    uint count{0};
+    while (node != top) {
+        if (node->getLeft() != nullValue) {
+            node = node->getLeft();
+        } else if (node->getRight() != nullValue) {
+            node = node->getRight();
+        } else {
+            ptr_TreeNode<Key, Value> parent = node->getParent();
+            if (parent != top) {
+                if (parent->getLeft() == node) {
+                    parent->setLeft(nullValue);
+                } else {
+                    parent->setRight(nullValue);
+                }
+            }
+            destroyNode(node);
+            ++count;
+            node = parent;
+        }
+    }
+    return count;
+}
+
+// move the nodes of other (its blocks, the root is handed over by the caller) into this tree, leaving other empty
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+void BinarySearchTree<Key, Value, Compare, Alloc, Node>::takeNodes(BinarySearchTree& other) {
+    // merge the two sorted lists, dropping the freed blocks: the live ones have distinct addresses, so a block
+    // shared by the two trees (split from one another) ends up next to its copy
+    std::vector<std::shared_ptr<NodeBlock>> merged;
+    merged.reserve(blocks.size() + other.blocks.size());
+    typename std::vector<std::shared_ptr<NodeBlock>>::const_iterator mine = blocks.begin();
+    typename std::vector<std::shared_ptr<NodeBlock>>::const_iterator theirs = other.blocks.begin();
+    while (mine != blocks.end() || theirs != other.blocks.end()) {
+        const std::shared_ptr<NodeBlock>& block = (theirs == other.blocks.end() || (mine != blocks.end() && !beforeBlock((*theirs)->nodes, *mine))) ? *mine++ : *theirs++;
+        if (block->live != 0 && (merged.empty() || merged.back() != block)) {
+            merged.push_back(block);
+        }
+    }
+    blocks.swap(merged);
+    numOfNodes += other.numOfNodes;
+    countStale = countStale || other.countStale;
+    resetFinger();
+    other.resetFinger();
+    other.blocks.clear();
+    other.root = other.nullValue;
+    other.numOfNodes = 0;
+    other.countStale = false;
+}
+
+// the nodes taken from other are freed by the allocator of this tree: allocators owning their memory (a default
+// SlabAllocator has an arena of its own) must be the same, checked before anything is moved
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+void BinarySearchTree<Key, Value, Compare, Alloc, Node>::requireSameAllocator(const BinarySearchTree& other) const {
+    if (!(nodeAllocator == other.nodeAllocator)) {
+        throw std::invalid_argument("the trees must share their allocator (build them from copies of one allocator)");
+    }
+}
+
+// recompute the summary of a node from the ones of its children
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+inline void BinarySearchTree<Key, Value, Compare, Alloc, Node>::updateNode(ptr_TreeNode<Key, Value> node) {
+    Augmentation::update(static_cast<Node*>(node));
+}
+
+// recompute the summaries from node up to the root, after the children of node changed
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+void BinarySearchTree<Key, Value, Compare, Alloc, Node>::updatePath(ptr_TreeNode<Key, Value> node) {
+    if (!Augmentation::ENABLED) {
+        return;
+    }
+    for (; node != nullValue; node = node->getParent()) {
+        Augmentation::update(static_cast<Node*>(node));
+    }
+}
+
+// build a perfectly balanced tree from n (key, value) pairs sorted by key, the nodes are allocated in one block;
+// annotate(node, depth, balance, lastLevel, height) lets the subclasses set their balance information
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+template <typename Iterator, typename Annotate>
+void BinarySearchTree<Key, Value, Compare, Alloc, Node>::buildBalanced(Iterator first, std::size_t n, Annotate annotate) {
+    if (n == 0) {
+        return;
+    }
+    Node* block = NodeAllocatorTraits::allocate(nodeAllocator, n);
+    std::vector<Node*> nodes(n);
+    for (std::size_t i{0}; i < n; ++i, ++first) {
+        NodeAllocatorTraits::construct(nodeAllocator, block + i, first->first, first->second);
+        nodes[i] = block + i;
+    }
+    blocks.insert(std::upper_bound(blocks.begin(), blocks.end(), block, beforeBlock), std::make_shared<NodeBlock>(NodeBlock{block, n, n}));
+    relinkBalanced(nodes, annotate);
+}
+
+// make the nodes, sorted by key, the whole tree: every node is relinked, none is allocated or freed
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+template <typename Annotate>
+void BinarySearchTree<Key, Value, Compare, Alloc, Node>::relinkBalanced(const std::vector<Node*>& nodes, Annotate annotate) {
+    uint lastLevel{0}; // floor(log2(n)), the depth of the deepest nodes
+    while ((nodes.size() >> (lastLevel + 1)) != 0) {
+        ++lastLevel;
+    }
+    int height{0};
+    resetFinger();
+    root = linkBalanced(nodes, 0, nodes.size(), 0, lastLevel, height, annotate);
+    if (root != nullValue) {
+        root->setParent(nullValue);
+    }
+    numOfNodes = static_cast<uint>(nodes.size());
+    countStale = false;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+template <typename Annotate>
+ptr_TreeNode<Key, Value> BinarySearchTree<Key, Value, Compare, Alloc, Node>::linkBalanced(const std::vector<Node*>& nodes, std::size_t lo, std::size_t hi, uint depth, uint lastLevel, int& height, Annotate& annotate) {
+    if (lo == hi) {
+        height = 0;
+        return nullValue;
+    }
+    std::size_t mid = lo + (hi - lo) / 2; // the right half is never smaller than the left one
+    Node* node = nodes[mid];
+    int leftHeight{0};
+    int rightHeight{0};
+    ptr_TreeNode<Key, Value> left = linkBalanced(nodes, lo, mid, depth + 1, lastLevel, leftHeight, annotate);
+    ptr_TreeNode<Key, Value> right = linkBalanced(nodes, mid + 1, hi, depth + 1, lastLevel, rightHeight, annotate);
+    node->setLeft(left);
+    node->setRight(right);
+    if (left != nullValue) {
+        left->setParent(node);
+    }
+    if (right != nullValue) {
+        right->setParent(node);
+    }
+    updateNode(node);
+    height = std::max(leftHeight, rightHeight) + 1;
+    annotate(node, depth, leftHeight - rightHeight, lastLevel, height);
+    return node;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+std::vector<Node*> BinarySearchTree<Key, Value, Compare, Alloc, Node>::collectNodes() const {
+    std::vector<Node*> nodes;
+    nodes.reserve(getNumOfNodes());
+    if (root != nullValue) {
+        for (ptr_TreeNode<Key, Value> node = minimum(root); node != nullValue; node = successor(node)) {
+            nodes.push_back(static_cast<Node*>(node));
+        }
+    }
+    return nodes;
+}
+
+// stable, so equal keys keep the order of the batch, as if inserted one at a time
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+void BinarySearchTree<Key, Value, Compare, Alloc, Node>::sortBatch(std::vector<std::pair<Key, Value>>& batch) const {
+    const Compare& less = comp;
+    std::stable_sort(batch.begin(), batch.end(), [&less](const std::pair<Key, Value>& a, const std::pair<Key, Value>& b) {
+        return less(a.first, b.first);
+    });
+}
+
+// sort the batch and, if it is large compared to the tree, merge it with the nodes of the tree in one pass and
+// relink everything into a balanced tree; returns false if the subclass should insert the sorted batch itself
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+template <typename Annotate>
+bool BinarySearchTree<Key, Value, Compare, Alloc, Node>::mergeBatch(std::vector<std::pair<Key, Value>>& batch, Annotate annotate) {
+    sortBatch(batch);
+    if (batch.empty() || batch.size() * REBUILD_RATIO < getNumOfNodes()) {
+        return batch.empty();
+    }
+    std::vector<Node*> existing = collectNodes();
+    std::vector<Node*> nodes;
+    nodes.reserve(existing.size() + batch.size());
+    typename std::vector<Node*>::const_iterator old = existing.begin();
+    for (typename std::vector<std::pair<Key, Value>>::iterator it = batch.begin(); it != batch.end(); ++it) {
+        while (old != existing.end() && !comp(it->first, (*old)->getKey())) { // equal keys already in the tree come first
+            nodes.push_back(*old++);
+        }
+        nodes.push_back(createNode(it->first, std::move(it->second)));
+    }
+    nodes.insert(nodes.end(), old, existing.cend());
+    relinkBalanced(nodes, annotate);
+    return true;
+}
+
+// sort the keys and, if they are many compared to the tree, drop the matching nodes during one in-order walk and
+// relink the others into a balanced tree; returns false if the subclass should remove the sorted keys itself
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+template <typename Annotate>
+bool BinarySearchTree<Key, Value, Compare, Alloc, Node>::mergeRemoveBatch(std::vector<Key>& keys, Annotate annotate) {
+    std::sort(keys.begin(), keys.end(), comp);
+    if (keys.empty() || keys.size() * REBUILD_RATIO < getNumOfNodes()) {
+        return keys.empty();
+    }
+    std::vector<Node*> kept;
+    std::vector<Node*> removed;
+    kept.reserve(getNumOfNodes());
+    typename std::vector<Key>::const_iterator key = keys.begin();
+    for (ptr_TreeNode<Key, Value> node = root == nullValue ? nullValue : minimum(root); node != nullValue; node = successor(node)) {
+        while (key != keys.end() && comp(*key, node->getKey())) {
+            ++key; // not in the tree
+        }
+        if (key != keys.end() && !comp(node->getKey(), *key)) {
+            removed.push_back(static_cast<Node*>(node));
+            ++key;
+        } else {
+            kept.push_back(static_cast<Node*>(node));
+        }
+    }
+    relinkBalanced(kept, annotate);
+    for (typename std::vector<Node*>::const_iterator node = removed.begin(); node != removed.end(); ++node) {
+        destroyNode(*node);
+    }
+    return true;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+sptr_TreeNodeObject BinarySearchTree<Key, Value, Compare, Alloc, Node>::shareObject(TreeNodeObject* obj) {
+    // the control block of the shared_ptr is drawn from the node allocator as well
+    return sptr_TreeNodeObject(obj, std::default_delete<TreeNodeObject>(), nodeAllocator);
+}
+
 // walk methods
-template <bool CMP(const int& key1, const int& key2)>
-void BinarySearchTree<CMP>::preorder_walk(const sptr_TreeNode& node) const {
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+void BinarySearchTree<Key, Value, Compare, Alloc, Node>::preorder_walk(ptr_TreeNode<Key, Value> node) const {
     if (node != nullValue) {
         std::cout << *node << "\t" << std::endl;
         inorder_walk(node->getLeft());
         inorder_walk(node->getRight());
     }
 }
-template <bool CMP(const int& key1, const int& key2)>
-void BinarySearchTree<CMP>::inorder_walk(const sptr_TreeNode& node) const {
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+void BinarySearchTree<Key, Value, Compare, Alloc, Node>::inorder_walk(ptr_TreeNode<Key, Value> node) const {
     if (node != nullValue) {
         inorder_walk(node->getLeft());
         std::cout << *node << "\t" << std::endl;
         inorder_walk(node->getRight());
     }
 }
-template <bool CMP(const int& key1, const int& key2)>
-void BinarySearchTree<CMP>::postorder_walk(const sptr_TreeNode& node) const {
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+void BinarySearchTree<Key, Value, Compare, Alloc, Node>::postorder_walk(ptr_TreeNode<Key, Value> node) const {
     if (node != nullValue) {
         inorder_walk(node->getLeft());
         inorder_walk(node->getRight());
@@ -222,19 +949,19 @@ void BinarySearchTree<CMP>::postorder_walk(const sptr_TreeNode& node) const {
 }
 
 // print tree structure
-template <bool CMP(const int& key1, const int& key2)>
-void BinarySearchTree<CMP>::prettyPrint(const std::string& prefix, sptr_TreeNode node, bool isLeft) const {
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+void BinarySearchTree<Key, Value, Compare, Alloc, Node>::prettyPrint(const std::string& prefix, ptr_TreeNode<Key, Value> node, bool isLeft) const {
     if (node != nullValue) {
         std::cout << prefix;
         std::cout << (isLeft ? "├──" : "└──");
-        std::cout << node->getObjKey() << std::endl;
+        std::cout << node->getKey() << std::endl;
         // enter the next tree level - left and right branch
         prettyPrint( prefix + (isLeft ? "│   " : "    "), node->getRight(), true);
         prettyPrint( prefix + (isLeft ? "│   " : "    "), node->getLeft(), false);
     }
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-void BinarySearchTree<CMP>::prettyPrint() const {
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+void BinarySearchTree<Key, Value, Compare, Alloc, Node>::prettyPrint() const {
     prettyPrint("", root, false);
 }
\ No newline at end of file
@@ -0,0 +1,150 @@
+/**
+ * @file CompactAVLTree.inl
+ * @brief This file contains the implementation of the CompactAVLTree class
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include "CompactAVLTree.hpp"
+
+// constructor
+template <typename Key, typename Value, typename Compare, typename Alloc>
+CompactAVLTree<Key, Value, Compare, Alloc>::CompactAVLTree(const Compare& comp, const Alloc& alloc)
+    : CompactTree<Key, Value, Compare, Alloc>(comp, alloc) {}
+
+// core functions
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void CompactAVLTree<Key, Value, Compare, Alloc>::insert(CompactIndex node) {
+    CompactTree<Key, Value, Compare, Alloc>::insert(node);
+    setBalance(node, 0);
+    CompactIndex parent = this->pool[node].parent;
+    while (parent != 0) { // fix after insertion, the subtree of node has grown by one
+        int parentBalance = balanceFactor(parent) + ((node == this->pool[parent].left) ? 1 : -1);
+        if (parentBalance == 0) { // the height of parent did not change
+            setBalance(parent, 0);
+            break;
+        } else if (parentBalance == 2 || parentBalance == -2) { // the tree requires rebalancing only once
+            balance(parent, parentBalance);
+            break;
+        }
+        setBalance(parent, parentBalance);
+        node = parent;
+        parent = this->pool[parent].parent;
+    }
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void CompactAVLTree<Key, Value, Compare, Alloc>::insert(const Key& key, const Value& value) {
+    emplace(key, value);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void CompactAVLTree<Key, Value, Compare, Alloc>::insert(const Key& key, Value&& value) {
+    emplace(key, std::move(value));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+template <typename... Args>
+CompactIndex CompactAVLTree<Key, Value, Compare, Alloc>::emplace(const Key& key, Args&&... args) {
+    CompactIndex node = this->createNode(key, std::forward<Args>(args)...);
+    insert(node);
+    return node;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void CompactAVLTree<Key, Value, Compare, Alloc>::insert(TreeNodeObject* obj) {
+    emplace(obj->getKey(), sptr_TreeNodeObject(obj));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void CompactAVLTree<Key, Value, Compare, Alloc>::remove(CompactIndex node) {
+    // same bookkeeping of AVLTree::remove: the successor takes the place and the balance of the node
+    CompactIndex parent = this->pool[node].parent;
+    bool fromLeft = parent != 0 && node == this->pool[parent].left;
+    if (this->pool[node].left != 0 && this->pool[node].right != 0) {
+        CompactIndex successor = this->minimum(this->pool[node].right);
+        fromLeft = this->pool[successor].parent != node;
+        parent = fromLeft ? this->pool[successor].parent : successor;
+        setBalance(successor, balanceFactor(node));
+    }
+    this->unlink(node);
+    this->destroyNode(node);
+    fixAfterRemove(parent, fromLeft);
+}
+
+// fixers
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void CompactAVLTree<Key, Value, Compare, Alloc>::fixAfterRemove(CompactIndex parent, bool fromLeft) {
+    while (parent != 0) { // the subtree on the fromLeft side of parent has shrunk by one
+        int parentBalance = balanceFactor(parent) + (fromLeft ? -1 : 1);
+        if (parentBalance == 1 || parentBalance == -1) { // the height of parent did not change
+            setBalance(parent, parentBalance);
+            return;
+        }
+        CompactIndex subtree = parent;
+        if (parentBalance == 0) {
+            setBalance(parent, 0);
+        } else {
+            int siblingBalance = balanceFactor((parentBalance == 2) ? this->pool[parent].left : this->pool[parent].right);
+            subtree = balance(parent, parentBalance);
+            if (siblingBalance == 0) { // a single rotation over a balanced sibling keeps the height
+                return;
+            }
+        }
+        parent = this->pool[subtree].parent;
+        fromLeft = parent != 0 && subtree == this->pool[parent].left;
+    }
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+inline int CompactAVLTree<Key, Value, Compare, Alloc>::balanceFactor(CompactIndex node) const {
+    if (node == 0)
+        return 0;
+    return static_cast<int>(this->pool[node].tag) - 1;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+inline void CompactAVLTree<Key, Value, Compare, Alloc>::setBalance(CompactIndex node, int balance) {
+    this->pool[node].tag = static_cast<std::uint8_t>(balance + 1);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+CompactIndex CompactAVLTree<Key, Value, Compare, Alloc>::balance(CompactIndex node, int nodeBalance) {
+    if (nodeBalance == 2) {
+        CompactIndex left = this->pool[node].left;
+        int leftBalance = balanceFactor(left);
+        if (leftBalance == -1) {
+            CompactIndex pivot = this->pool[left].right;
+            int pivotBalance = balanceFactor(pivot);
+            this->rotateLeft(left);
+            this->rotateRight(node);
+            setBalance(node, (pivotBalance == 1) ? -1 : 0);
+            setBalance(left, (pivotBalance == -1) ? 1 : 0);
+            setBalance(pivot, 0);
+            return pivot;
+        }
+        this->rotateRight(node);
+        setBalance(node, (leftBalance == 0) ? 1 : 0);
+        setBalance(left, (leftBalance == 0) ? -1 : 0);
+        return left;
+    }
+    CompactIndex right = this->pool[node].right;
+    int rightBalance = balanceFactor(right);
+    if (rightBalance == 1) {
+        CompactIndex pivot = this->pool[right].left;
+        int pivotBalance = balanceFactor(pivot);
+        this->rotateRight(right);
+        this->rotateLeft(node);
+        setBalance(node, (pivotBalance == -1) ? 1 : 0);
+        setBalance(right, (pivotBalance == 1) ? -1 : 0);
+        setBalance(pivot, 0);
+        return pivot;
+    }
+    this->rotateLeft(node);
+    setBalance(node, (rightBalance == 0) ? -1 : 0);
+    setBalance(right, (rightBalance == 0) ? 1 : 0);
+    return right;
+}
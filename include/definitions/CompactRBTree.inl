@@ -0,0 +1,186 @@
+/**
+ * @file CompactRBTree.inl
+ * @brief This file contains the implementation of the CompactRBTree class
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include "CompactRBTree.hpp"
+
+// constructor
+template <typename Key, typename Value, typename Compare, typename Alloc>
+CompactRBTree<Key, Value, Compare, Alloc>::CompactRBTree(const Compare& comp, const Alloc& alloc)
+    : CompactTree<Key, Value, Compare, Alloc>(comp, alloc) {
+    setColor(0, RBColor::BLACK);
+}
+
+// colors
+template <typename Key, typename Value, typename Compare, typename Alloc>
+inline RBColor CompactRBTree<Key, Value, Compare, Alloc>::getColor(CompactIndex node) const {
+    return (this->pool[node].tag & 1) ? RBColor::BLACK : RBColor::RED;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+inline void CompactRBTree<Key, Value, Compare, Alloc>::setColor(CompactIndex node, RBColor color) {
+    this->pool[node].tag = (color == RBColor::BLACK) ? 1 : 0;
+}
+
+// core functionalities
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void CompactRBTree<Key, Value, Compare, Alloc>::insert(CompactIndex node) {
+    CompactTree<Key, Value, Compare, Alloc>::insert(node);
+    setColor(node, RBColor::RED);
+    insFixUp(node);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void CompactRBTree<Key, Value, Compare, Alloc>::insert(const Key& key, const Value& value) {
+    emplace(key, value);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void CompactRBTree<Key, Value, Compare, Alloc>::insert(const Key& key, Value&& value) {
+    emplace(key, std::move(value));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+template <typename... Args>
+CompactIndex CompactRBTree<Key, Value, Compare, Alloc>::emplace(const Key& key, Args&&... args) {
+    CompactIndex node = this->createNode(key, std::forward<Args>(args)...);
+    insert(node);
+    return node;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void CompactRBTree<Key, Value, Compare, Alloc>::insert(TreeNodeObject* obj) {
+    emplace(obj->getKey(), sptr_TreeNodeObject(obj));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void CompactRBTree<Key, Value, Compare, Alloc>::remove(CompactIndex node) {
+    RBColor originalColor = getColor(node);
+    CompactIndex child;
+    if (this->pool[node].left == 0) {
+        child = this->pool[node].right;
+        this->transplant(node, child);
+    } else if (this->pool[node].right == 0) {
+        child = this->pool[node].left;
+        this->transplant(node, child);
+    } else {
+        CompactIndex successor = this->minimum(this->pool[node].right);
+        originalColor = getColor(successor);
+        child = this->pool[successor].right;
+        if (this->pool[successor].parent == node) {
+            this->pool[child].parent = successor;
+        } else {
+            this->transplant(successor, child);
+            this->pool[successor].right = this->pool[node].right;
+            this->pool[this->pool[successor].right].parent = successor;
+        }
+        this->transplant(node, successor);
+        this->pool[successor].left = this->pool[node].left;
+        this->pool[this->pool[successor].left].parent = successor;
+        setColor(successor, getColor(node));
+    }
+    if (originalColor == RBColor::BLACK) {
+        delFixUp(child);
+    }
+    this->destroyNode(node);
+    --(this->numOfNodes);
+}
+
+// fixers
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void CompactRBTree<Key, Value, Compare, Alloc>::insFixUp(CompactIndex node) {
+    auto& pool = this->pool;
+    while (getColor(pool[node].parent) == RBColor::RED) {
+        CompactIndex parent = pool[node].parent;
+        CompactIndex grandparent = pool[parent].parent;
+        bool parentIsLeft = parent == pool[grandparent].left;
+        CompactIndex uncle = parentIsLeft ? pool[grandparent].right : pool[grandparent].left;
+        if (getColor(uncle) == RBColor::RED) {
+            setColor(parent, RBColor::BLACK);
+            setColor(uncle, RBColor::BLACK);
+            setColor(grandparent, RBColor::RED);
+            node = grandparent;
+        } else if (parentIsLeft) {
+            if (node == pool[parent].right) {
+                node = parent;
+                this->rotateLeft(node);
+            }
+            setColor(pool[node].parent, RBColor::BLACK);
+            setColor(grandparent, RBColor::RED);
+            this->rotateRight(grandparent);
+        } else {
+            if (node == pool[parent].left) {
+                node = parent;
+                this->rotateRight(node);
+            }
+            setColor(pool[node].parent, RBColor::BLACK);
+            setColor(grandparent, RBColor::RED);
+            this->rotateLeft(grandparent);
+        }
+    }
+    setColor(this->root, RBColor::BLACK);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void CompactRBTree<Key, Value, Compare, Alloc>::delFixUp(CompactIndex node) {
+    auto& pool = this->pool;
+    while (node != this->root && getColor(node) == RBColor::BLACK) {
+        CompactIndex parent = pool[node].parent;
+        if (node == pool[parent].left) {
+            CompactIndex sibling = pool[parent].right;
+            if (getColor(sibling) == RBColor::RED) {
+                setColor(sibling, RBColor::BLACK);
+                setColor(parent, RBColor::RED);
+                this->rotateLeft(parent);
+                sibling = pool[parent].right;
+            }
+            if (getColor(pool[sibling].left) == RBColor::BLACK && getColor(pool[sibling].right) == RBColor::BLACK) {
+                setColor(sibling, RBColor::RED);
+                node = parent;
+            } else {
+                if (getColor(pool[sibling].right) == RBColor::BLACK) {
+                    setColor(pool[sibling].left, RBColor::BLACK);
+                    setColor(sibling, RBColor::RED);
+                    this->rotateRight(sibling);
+                    sibling = pool[parent].right;
+                }
+                setColor(sibling, getColor(parent));
+                setColor(parent, RBColor::BLACK);
+                setColor(pool[sibling].right, RBColor::BLACK);
+                this->rotateLeft(parent);
+                node = this->root;
+            }
+        } else {
+            CompactIndex sibling = pool[parent].left;
+            if (getColor(sibling) == RBColor::RED) {
+                setColor(sibling, RBColor::BLACK);
+                setColor(parent, RBColor::RED);
+                this->rotateRight(parent);
+                sibling = pool[parent].left;
+            }
+            if (getColor(pool[sibling].right) == RBColor::BLACK && getColor(pool[sibling].left) == RBColor::BLACK) {
+                setColor(sibling, RBColor::RED);
+                node = parent;
+            } else {
+                if (getColor(pool[sibling].left) == RBColor::BLACK) {
+                    setColor(pool[sibling].right, RBColor::BLACK);
+                    setColor(sibling, RBColor::RED);
+                    this->rotateLeft(sibling);
+                    sibling = pool[parent].left;
+                }
+                setColor(sibling, getColor(parent));
+                setColor(parent, RBColor::BLACK);
+                setColor(pool[sibling].left, RBColor::BLACK);
+                this->rotateRight(parent);
+                node = this->root;
+            }
+        }
+    }
+    setColor(node, RBColor::BLACK);
+}
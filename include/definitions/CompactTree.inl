@@ -0,0 +1,249 @@
+/**
+ * @file CompactTree.inl
+ * @brief This file contains the implementation of the CompactTree class
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include "CompactTree.hpp"
+
+// constructor
+template <typename Key, typename Value, typename Compare, typename Alloc>
+CompactTree<Key, Value, Compare, Alloc>::CompactTree(const Compare& comp, const Alloc& alloc)
+    : comp(comp), pool(NodeAllocator(alloc)) {
+    pool.emplace_back(Key(), Value()); // nil node
+}
+
+// getters
+template <typename Key, typename Value, typename Compare, typename Alloc>
+inline bool CompactTree<Key, Value, Compare, Alloc>::isEmpty() const {
+    return numOfNodes == 0;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+inline uint CompactTree<Key, Value, Compare, Alloc>::getNumOfNodes() const {
+    return numOfNodes;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+inline CompactIndex CompactTree<Key, Value, Compare, Alloc>::getRoot() const {
+    return root;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+inline CompactIndex CompactTree<Key, Value, Compare, Alloc>::getNil() const {
+    return 0;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+inline const Key& CompactTree<Key, Value, Compare, Alloc>::getKey(CompactIndex node) const {
+    return pool[node].key;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+inline Value& CompactTree<Key, Value, Compare, Alloc>::getValue(CompactIndex node) {
+    return pool[node].value;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+inline const Value& CompactTree<Key, Value, Compare, Alloc>::getValue(CompactIndex node) const {
+    return pool[node].value;
+}
+
+// node management
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void CompactTree<Key, Value, Compare, Alloc>::reserve(uint numOfNodes) {
+    pool.reserve(numOfNodes + 1);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void CompactTree<Key, Value, Compare, Alloc>::clear() {
+    pool.erase(pool.begin() + 1, pool.end());
+    pool[0].parent = 0;
+    root = 0;
+    freeList = 0;
+    numOfNodes = 0;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+template <typename... Args>
+CompactIndex CompactTree<Key, Value, Compare, Alloc>::createNode(const Key& key, Args&&... args) {
+    if (freeList == 0) {
+        pool.emplace_back(key, std::forward<Args>(args)...);
+        return static_cast<CompactIndex>(pool.size() - 1);
+    }
+    CompactIndex node = freeList; // recycle a removed node
+    freeList = pool[node].right;
+    pool[node] = Node(key, std::forward<Args>(args)...);
+    return node;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void CompactTree<Key, Value, Compare, Alloc>::destroyNode(CompactIndex node) {
+    pool[node].value = Value(); // release what the value holds now, not when the slot is reused
+    pool[node].right = freeList;
+    freeList = node;
+}
+
+// core functionalities
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void CompactTree<Key, Value, Compare, Alloc>::insert(CompactIndex node) {
+    CompactIndex prev = 0;
+    CompactIndex curr = root;
+    const Key& key = pool[node].key;
+
+    while (curr != 0) {
+        prev = curr;
+        curr = comp(key, pool[curr].key) ? pool[curr].left : pool[curr].right; // choose left or right child
+    }
+
+    pool[node].parent = prev;
+    if (prev == 0) {
+        root = node;
+    } else if (comp(key, pool[prev].key)) {
+        pool[prev].left = node;
+    } else {
+        pool[prev].right = node;
+    }
+
+    ++numOfNodes;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+CompactIndex CompactTree<Key, Value, Compare, Alloc>::search(CompactIndex root, const Key& key) const {
+    while (root != 0) {
+        if (comp(key, pool[root].key)) {
+            root = pool[root].left;
+        } else if (comp(pool[root].key, key)) {
+            root = pool[root].right;
+        } else {
+            break;
+        }
+    }
+    return root;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+inline CompactIndex CompactTree<Key, Value, Compare, Alloc>::search(const Key& key) const {
+    return search(root, key);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+CompactIndex CompactTree<Key, Value, Compare, Alloc>::successor(CompactIndex node) const {
+    if (pool[node].right != 0) {
+        return minimum(pool[node].right);
+    }
+    CompactIndex ptr = pool[node].parent;
+    while (ptr != 0 && node == pool[ptr].right) {
+        node = ptr;
+        ptr = pool[ptr].parent;
+    }
+    return ptr;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+CompactIndex CompactTree<Key, Value, Compare, Alloc>::minimum(CompactIndex root) const {
+    while (pool[root].left != 0) {
+        root = pool[root].left;
+    }
+    return root;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+inline CompactIndex CompactTree<Key, Value, Compare, Alloc>::minimum() const {
+    return minimum(root);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+CompactIndex CompactTree<Key, Value, Compare, Alloc>::maximum(CompactIndex root) const {
+    while (pool[root].right != 0) {
+        root = pool[root].right;
+    }
+    return root;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+inline CompactIndex CompactTree<Key, Value, Compare, Alloc>::maximum() const {
+    return maximum(root);
+}
+
+// the parent of new_node is set even when it is nil, as the red-black removal expects
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void CompactTree<Key, Value, Compare, Alloc>::transplant(CompactIndex curr_node, CompactIndex new_node) {
+    CompactIndex parent = pool[curr_node].parent;
+    if (parent == 0) {
+        root = new_node;
+    } else if (curr_node == pool[parent].left) {
+        pool[parent].left = new_node;
+    } else {
+        pool[parent].right = new_node;
+    }
+    pool[new_node].parent = parent;
+}
+
+// detach the node from the tree without freeing it
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void CompactTree<Key, Value, Compare, Alloc>::unlink(CompactIndex node) {
+    if (pool[node].left == 0) {
+        transplant(node, pool[node].right);
+    } else if (pool[node].right == 0) {
+        transplant(node, pool[node].left);
+    } else {
+        CompactIndex ptr = minimum(pool[node].right);
+        if (pool[ptr].parent != node) {
+            transplant(ptr, pool[ptr].right);
+            pool[ptr].right = pool[node].right;
+            pool[pool[ptr].right].parent = ptr;
+        }
+        transplant(node, ptr);
+        pool[ptr].left = pool[node].left;
+        pool[pool[ptr].left].parent = ptr;
+    }
+    --numOfNodes;
+}
+
+// rotation methods
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void CompactTree<Key, Value, Compare, Alloc>::rotateLeft(CompactIndex node) {
+    CompactIndex ptr = pool[node].right;
+    pool[node].right = pool[ptr].left;
+    if (pool[ptr].left != 0) {
+        pool[pool[ptr].left].parent = node;
+    }
+
+    CompactIndex parent = pool[node].parent;
+    pool[ptr].parent = parent;
+    if (parent == 0) {
+        root = ptr;
+    } else if (node == pool[parent].left) {
+        pool[parent].left = ptr;
+    } else {
+        pool[parent].right = ptr;
+    }
+    pool[ptr].left = node;
+    pool[node].parent = ptr;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void CompactTree<Key, Value, Compare, Alloc>::rotateRight(CompactIndex node) {
+    CompactIndex ptr = pool[node].left;
+    pool[node].left = pool[ptr].right;
+    if (pool[ptr].right != 0) {
+        pool[pool[ptr].right].parent = node;
+    }
+
+    CompactIndex parent = pool[node].parent;
+    pool[ptr].parent = parent;
+    if (parent == 0) {
+        root = ptr;
+    } else if (node == pool[parent].right) {
+        pool[parent].right = ptr;
+    } else {
+        pool[parent].left = ptr;
+    }
+    pool[ptr].right = node;
+    pool[node].parent = ptr;
+}
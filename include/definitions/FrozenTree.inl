@@ -0,0 +1,100 @@
+/**
+ * @file FrozenTree.inl
+ * @brief This file contains the implementation of the FrozenTree class
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include "FrozenTree.hpp"
+
+#if defined(__GNUC__)
+#define FROZEN_TREE_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define FROZEN_TREE_PREFETCH(address)
+#endif
+
+// constructor
+template <typename Key, typename Value, typename Compare>
+template <typename T>
+FrozenTree<Key, Value, Compare>::FrozenTree(const T& tree, const Compare& comp)
+    : comp(comp), numOfNodes(tree.getNumOfNodes()) {
+    std::vector<decltype(tree.successor(tree.minimum()))> nodes;
+    nodes.reserve(numOfNodes);
+    if (numOfNodes > 0) {
+        nodes.push_back(tree.minimum());
+        for (uint i{1}; i < numOfNodes; ++i) {
+            nodes.push_back(tree.successor(nodes.back()));
+        }
+    }
+
+    keys.reserve(numOfNodes + 1);
+    values.reserve(numOfNodes + 1);
+    if (numOfNodes > 0) { // position 0 holds a copy of the minimum, it is never returned
+        keys.resize(numOfNodes + 1, nodes[0]->getKey());
+        values.resize(numOfNodes + 1, nodes[0]->getValue());
+    }
+    uint next{0};
+    fill(nodes, next, 1);
+}
+
+// the inorder visit of the implicit tree gets the keys in sorted order
+template <typename Key, typename Value, typename Compare>
+template <typename T_NODE>
+void FrozenTree<Key, Value, Compare>::fill(std::vector<T_NODE>& nodes, uint& next, uint position) {
+    if (position <= numOfNodes) {
+        fill(nodes, next, 2 * position);
+        keys[position] = nodes[next]->getKey();
+        values[position] = nodes[next]->getValue();
+        ++next;
+        fill(nodes, next, 2 * position + 1);
+    }
+}
+
+// getters
+template <typename Key, typename Value, typename Compare>
+inline unsigned int FrozenTree<Key, Value, Compare>::getNumOfNodes() const {
+    return numOfNodes;
+}
+
+template <typename Key, typename Value, typename Compare>
+inline unsigned int FrozenTree<Key, Value, Compare>::getNil() const {
+    return 0;
+}
+
+template <typename Key, typename Value, typename Compare>
+inline const Key& FrozenTree<Key, Value, Compare>::getKey(uint position) const {
+    return keys[position];
+}
+
+template <typename Key, typename Value, typename Compare>
+inline const Value& FrozenTree<Key, Value, Compare>::getValue(uint position) const {
+    return values[position];
+}
+
+// lookups
+template <typename Key, typename Value, typename Compare>
+inline unsigned int FrozenTree<Key, Value, Compare>::lower_bound(const Key& key) const {
+    // the 2^prefetchLevels descendants of a position are contiguous: fetch them while comparing
+    const std::size_t prefetchLevels = (sizeof(Key) <= 4) ? 4 : (sizeof(Key) <= 8) ? 3 : 2;
+    const Key* data = keys.data();
+    std::size_t position = 1;
+    while (position <= numOfNodes) {
+        FROZEN_TREE_PREFETCH(data + (position << prefetchLevels)); // a prefetch never faults
+        position = 2 * position + comp(data[position], key); // go right while the key is smaller
+    }
+    // the answer is the last node where the descent went left: drop the trailing right turns and that left turn
+    while (position & 1) {
+        position >>= 1;
+    }
+    position >>= 1;
+    return static_cast<uint>(position);
+}
+
+template <typename Key, typename Value, typename Compare>
+inline unsigned int FrozenTree<Key, Value, Compare>::search(const Key& key) const {
+    uint position = lower_bound(key);
+    return (position != 0 && !comp(key, keys[position])) ? position : 0;
+}
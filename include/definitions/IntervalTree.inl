@@ -0,0 +1,112 @@
+/**
+ * @file IntervalTree.inl
+ * @brief This file contains the implementation of the IntervalTree class
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include "IntervalTree.hpp"
+
+template <typename Point, typename Value, typename Alloc>
+IntervalTree<Point, Value, Alloc>::IntervalTree(const Alloc& alloc) : Tree(std::less<Point>(), alloc) {}
+
+template <typename Point, typename Value, typename Alloc>
+ptr_RBTreeNode<Point, IntervalData<Point, Value>, MonoidAugmentation<MaxEndpoint<Point, Value>>> IntervalTree<Point, Value, Alloc>::insert(const Point& low, const Point& high, const Value& value) {
+    return this->emplace(low, high, value);
+}
+
+template <typename Point, typename Value, typename Alloc>
+ptr_RBTreeNode<Point, IntervalData<Point, Value>, MonoidAugmentation<MaxEndpoint<Point, Value>>> IntervalTree<Point, Value, Alloc>::insert(const Point& low, const Point& high, Value&& value) {
+    return this->emplace(low, high, std::move(value));
+}
+
+template <typename Point, typename Value, typename Alloc>
+bool IntervalTree<Point, Value, Alloc>::remove(const Point& low, const Point& high) {
+    ptr_RBTreeNode<Point, IntervalData<Point, Value>, Augment> node = find(low, high);
+    if (node == this->getNil()) {
+        return false;
+    }
+    Tree::remove(node);
+    return true;
+}
+
+template <typename Point, typename Value, typename Alloc>
+ptr_RBTreeNode<Point, IntervalData<Point, Value>, MonoidAugmentation<MaxEndpoint<Point, Value>>> IntervalTree<Point, Value, Alloc>::find(const Point& low, const Point& high) const {
+    return findSubtree(this->getRoot(), low, high);
+}
+
+// the intervals with the same low endpoint may hang on both sides of a node with that key, a subtree is only
+// entered if its greatest endpoint can be high
+template <typename Point, typename Value, typename Alloc>
+ptr_RBTreeNode<Point, IntervalData<Point, Value>, MonoidAugmentation<MaxEndpoint<Point, Value>>> IntervalTree<Point, Value, Alloc>::findSubtree(ptr_RBTreeNode<Point, IntervalData<Point, Value>, Augment> node, const Point& low, const Point& high) const {
+    ptr_RBTreeNode<Point, IntervalData<Point, Value>, Augment> nil = this->getNil();
+    while (node != nil && !(Augment::aggregate(node) < high)) {
+        if (low < node->getKey()) {
+            node = node->getLeft();
+        } else if (node->getKey() < low) {
+            node = node->getRight();
+        } else {
+            if (!(node->getValue().high < high) && !(high < node->getValue().high)) {
+                return node;
+            }
+            ptr_RBTreeNode<Point, IntervalData<Point, Value>, Augment> found = findSubtree(node->getLeft(), low, high);
+            if (found != nil) {
+                return found;
+            }
+            node = node->getRight();
+        }
+    }
+    return nil;
+}
+
+template <typename Point, typename Value, typename Alloc>
+template <typename F>
+void IntervalTree<Point, Value, Alloc>::stab(const Point& point, F report) const {
+    overlapSubtree(this->getRoot(), point, point, report);
+}
+
+template <typename Point, typename Value, typename Alloc>
+template <typename F>
+void IntervalTree<Point, Value, Alloc>::overlap(const Point& lo, const Point& hi, F report) const {
+    overlapSubtree(this->getRoot(), lo, hi, report);
+}
+
+// in order, recursing only on the left children: a subtree ending before lo is skipped whole, and once a low
+// endpoint is after hi so are the ones of the right subtree
+template <typename Point, typename Value, typename Alloc>
+template <typename F>
+void IntervalTree<Point, Value, Alloc>::overlapSubtree(ptr_RBTreeNode<Point, IntervalData<Point, Value>, Augment> node, const Point& lo, const Point& hi, F& report) const {
+    ptr_RBTreeNode<Point, IntervalData<Point, Value>, Augment> nil = this->getNil();
+    while (node != nil && !(Augment::aggregate(node) < lo)) {
+        overlapSubtree(node->getLeft(), lo, hi, report);
+        if (hi < node->getKey()) {
+            return;
+        }
+        if (!(node->getValue().high < lo)) {
+            report(node->getKey(), node->getValue().high, node->getValue().value);
+        }
+        node = node->getRight();
+    }
+}
+
+// the classic descent: if the left subtree ends at or after lo, either it holds an overlapping interval or none
+// of the right subtree (all starting after its low endpoints) can overlap
+template <typename Point, typename Value, typename Alloc>
+bool IntervalTree<Point, Value, Alloc>::overlaps(const Point& lo, const Point& hi) const {
+    ptr_RBTreeNode<Point, IntervalData<Point, Value>, Augment> nil = this->getNil();
+    ptr_RBTreeNode<Point, IntervalData<Point, Value>, Augment> node = this->getRoot();
+    while (node != nil) {
+        if (!(hi < node->getKey()) && !(node->getValue().high < lo)) {
+            return true;
+        }
+        if (node->getLeft() != nil && !(Augment::aggregate(node->getLeft()) < lo)) {
+            node = node->getLeft();
+        } else {
+            node = node->getRight();
+        }
+    }
+    return false;
+}
@@ -0,0 +1,188 @@
+/**
+ * @file PathAVLTree.inl
+ * @brief This file contains the implementation of the PathAVLTree class
+ * @version 1.0
+ * @date 2023-01-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#include "PathAVLTree.hpp"
+
+// constructor
+template <typename Key, typename Value, typename Compare, typename Alloc>
+PathAVLTree<Key, Value, Compare, Alloc>::PathAVLTree(const Compare& comp, const Alloc& alloc)
+    : PathTree<Key, Value, Compare, Alloc>(comp, alloc) {}
+
+// core functions
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void PathAVLTree<Key, Value, Compare, Alloc>::insert(Node* node) {
+    Path path;
+    this->descend(node->getKey(), path);
+    this->link(path, node);
+    setBalance(node, 0);
+    for (int level = path.depth - 1; level > 0; --level) { // fix after insertion, the subtree at level has grown by one
+        Node* parent = path.nodes[level - 1];
+        int parentBalance = balanceFactor(parent) + ((path.nodes[level] == parent->getLeft()) ? 1 : -1);
+        if (parentBalance == 0) { // the height of parent did not change
+            setBalance(parent, 0);
+            break;
+        } else if (parentBalance == 2 || parentBalance == -2) { // the tree requires rebalancing only once
+            this->replaceChild(path, level - 1, balance(parent, parentBalance));
+            break;
+        }
+        setBalance(parent, parentBalance);
+    }
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void PathAVLTree<Key, Value, Compare, Alloc>::insert(const Key& key, const Value& value) {
+    emplace(key, value);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void PathAVLTree<Key, Value, Compare, Alloc>::insert(const Key& key, Value&& value) {
+    emplace(key, std::move(value));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+template <typename... Args>
+typename PathAVLTree<Key, Value, Compare, Alloc>::Node* PathAVLTree<Key, Value, Compare, Alloc>::emplace(const Key& key, Args&&... args) {
+    Node* node = this->createNode(key, std::forward<Args>(args)...);
+    insert(node);
+    return node;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void PathAVLTree<Key, Value, Compare, Alloc>::insert(TreeNodeObject* obj) {
+    emplace(obj->getKey(), sptr_TreeNodeObject(obj));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void PathAVLTree<Key, Value, Compare, Alloc>::remove(Node* node) {
+    Path path;
+    if (this->findPath(node, path)) {
+        removeAt(path);
+    }
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+bool PathAVLTree<Key, Value, Compare, Alloc>::remove(const Key& key) {
+    Path path;
+    this->lowerBound(key, path);
+    if (path.depth == 0 || this->comp(key, path.top()->getKey())) {
+        return false;
+    }
+    removeAt(path);
+    return true;
+}
+
+// remove the top of the path: same bookkeeping of AVLTree::remove, the successor takes the place and the
+// balance of the node, and the path is extended down to it so that the retracing can start from below
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void PathAVLTree<Key, Value, Compare, Alloc>::removeAt(Path& path) {
+    Node* node = path.top();
+    int level = path.depth - 1;
+    int parentLevel = level - 1;
+    bool fromLeft = level > 0 && path.nodes[level - 1]->getLeft() == node;
+    if (node->getLeft() != nullptr && node->getRight() != nullptr) {
+        for (Node* ptr = node->getRight(); ptr != nullptr; ptr = ptr->getLeft()) {
+            path.push(ptr);
+        }
+        Node* successor = path.top();
+        int successorLevel = path.depth - 1;
+        fromLeft = successorLevel > level + 1;
+        if (fromLeft) {
+            path.nodes[successorLevel - 1]->setLeft(successor->getRight());
+            successor->setRight(node->getRight());
+        }
+        successor->setLeft(node->getLeft());
+        setBalance(successor, balanceFactor(node));
+        this->replaceChild(path, level, successor);
+        path.nodes[level] = successor;
+        parentLevel = fromLeft ? successorLevel - 1 : level;
+    } else {
+        this->replaceChild(path, level, (node->getLeft() != nullptr) ? node->getLeft() : node->getRight());
+    }
+    this->destroyNode(node);
+    --(this->numOfNodes);
+    fixAfterRemove(path, parentLevel, fromLeft);
+}
+
+// fixers
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void PathAVLTree<Key, Value, Compare, Alloc>::fixAfterRemove(Path& path, int level, bool fromLeft) {
+    while (level >= 0) { // the subtree on the fromLeft side of path.nodes[level] has shrunk by one
+        Node* parent = path.nodes[level];
+        int parentBalance = balanceFactor(parent) + (fromLeft ? -1 : 1);
+        if (parentBalance == 1 || parentBalance == -1) { // the height of parent did not change
+            setBalance(parent, parentBalance);
+            return;
+        }
+        Node* subtree = parent;
+        if (parentBalance == 0) {
+            setBalance(parent, 0);
+        } else {
+            int siblingBalance = balanceFactor((parentBalance == 2) ? parent->getLeft() : parent->getRight());
+            subtree = balance(parent, parentBalance);
+            this->replaceChild(path, level, subtree);
+            if (siblingBalance == 0) { // a single rotation over a balanced sibling keeps the height
+                return;
+            }
+        }
+        --level;
+        fromLeft = level >= 0 && path.nodes[level]->getLeft() == subtree;
+    }
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+inline int PathAVLTree<Key, Value, Compare, Alloc>::balanceFactor(const Node* node) const {
+    if (node == nullptr)
+        return 0;
+    return static_cast<int>(node->getTag()) - 1;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+inline void PathAVLTree<Key, Value, Compare, Alloc>::setBalance(Node* node, int balance) {
+    node->setTag(static_cast<unsigned>(balance + 1));
+}
+
+// rotate the unbalanced node, the caller hangs the returned root of the subtree in its place
+template <typename Key, typename Value, typename Compare, typename Alloc>
+typename PathAVLTree<Key, Value, Compare, Alloc>::Node* PathAVLTree<Key, Value, Compare, Alloc>::balance(Node* node, int nodeBalance) {
+    if (nodeBalance == 2) {
+        Node* left = node->getLeft();
+        int leftBalance = balanceFactor(left);
+        if (leftBalance == -1) {
+            Node* pivot = left->getRight();
+            int pivotBalance = balanceFactor(pivot);
+            node->setLeft(this->rotateLeft(left));
+            this->rotateRight(node);
+            setBalance(node, (pivotBalance == 1) ? -1 : 0);
+            setBalance(left, (pivotBalance == -1) ? 1 : 0);
+            setBalance(pivot, 0);
+            return pivot;
+        }
+        this->rotateRight(node);
+        setBalance(node, (leftBalance == 0) ? 1 : 0);
+        setBalance(left, (leftBalance == 0) ? -1 : 0);
+        return left;
+    }
+    Node* right = node->getRight();
+    int rightBalance = balanceFactor(right);
+    if (rightBalance == 1) {
+        Node* pivot = right->getLeft();
+        int pivotBalance = balanceFactor(pivot);
+        node->setRight(this->rotateRight(right));
+        this->rotateLeft(node);
+        setBalance(node, (pivotBalance == -1) ? 1 : 0);
+        setBalance(right, (pivotBalance == 1) ? -1 : 0);
+        setBalance(pivot, 0);
+        return pivot;
+    }
+    this->rotateLeft(node);
+    setBalance(node, (rightBalance == 0) ? -1 : 0);
+    setBalance(right, (rightBalance == 0) ? 1 : 0);
+    return right;
+}
@@ -0,0 +1,216 @@
+/**
+ * @file PathRBTree.inl
+ * @brief This file contains the implementation of the PathRBTree class
+ * @version 1.0
+ * @date 2023-01-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#include "PathRBTree.hpp"
+
+// constructor
+template <typename Key, typename Value, typename Compare, typename Alloc>
+PathRBTree<Key, Value, Compare, Alloc>::PathRBTree(const Compare& comp, const Alloc& alloc)
+    : PathTree<Key, Value, Compare, Alloc>(comp, alloc) {}
+
+// colors
+template <typename Key, typename Value, typename Compare, typename Alloc>
+inline RBColor PathRBTree<Key, Value, Compare, Alloc>::getColor(const Node* node) const {
+    return (node == nullptr || (node->getTag() & 1)) ? RBColor::BLACK : RBColor::RED;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+inline void PathRBTree<Key, Value, Compare, Alloc>::setColor(Node* node, RBColor color) {
+    node->setTag((color == RBColor::BLACK) ? 1 : 0);
+}
+
+// core functionalities
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void PathRBTree<Key, Value, Compare, Alloc>::insert(Node* node) {
+    Path path;
+    this->descend(node->getKey(), path);
+    this->link(path, node);
+    setColor(node, RBColor::RED);
+    int level = path.depth - 1;
+    while (level > 1 && getColor(path.nodes[level - 1]) == RBColor::RED) { // a red parent is not the root
+        Node* parent = path.nodes[level - 1];
+        Node* grandparent = path.nodes[level - 2];
+        bool parentIsLeft = parent == grandparent->getLeft();
+        Node* uncle = parentIsLeft ? grandparent->getRight() : grandparent->getLeft();
+        if (getColor(uncle) == RBColor::RED) {
+            setColor(parent, RBColor::BLACK);
+            setColor(uncle, RBColor::BLACK);
+            setColor(grandparent, RBColor::RED);
+            level -= 2;
+            continue;
+        }
+        Node* child = path.nodes[level];
+        if (parentIsLeft) {
+            if (child == parent->getRight()) {
+                grandparent->setLeft(this->rotateLeft(parent));
+                parent = child;
+            }
+            setColor(parent, RBColor::BLACK);
+            setColor(grandparent, RBColor::RED);
+            this->replaceChild(path, level - 2, this->rotateRight(grandparent));
+        } else {
+            if (child == parent->getLeft()) {
+                grandparent->setRight(this->rotateRight(parent));
+                parent = child;
+            }
+            setColor(parent, RBColor::BLACK);
+            setColor(grandparent, RBColor::RED);
+            this->replaceChild(path, level - 2, this->rotateLeft(grandparent));
+        }
+        break;
+    }
+    setColor(this->root, RBColor::BLACK);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void PathRBTree<Key, Value, Compare, Alloc>::insert(const Key& key, const Value& value) {
+    emplace(key, value);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void PathRBTree<Key, Value, Compare, Alloc>::insert(const Key& key, Value&& value) {
+    emplace(key, std::move(value));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+template <typename... Args>
+typename PathRBTree<Key, Value, Compare, Alloc>::Node* PathRBTree<Key, Value, Compare, Alloc>::emplace(const Key& key, Args&&... args) {
+    Node* node = this->createNode(key, std::forward<Args>(args)...);
+    insert(node);
+    return node;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void PathRBTree<Key, Value, Compare, Alloc>::insert(TreeNodeObject* obj) {
+    emplace(obj->getKey(), sptr_TreeNodeObject(obj));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void PathRBTree<Key, Value, Compare, Alloc>::remove(Node* node) {
+    Path path;
+    if (this->findPath(node, path)) {
+        removeAt(path);
+    }
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+bool PathRBTree<Key, Value, Compare, Alloc>::remove(const Key& key) {
+    Path path;
+    this->lowerBound(key, path);
+    if (path.depth == 0 || this->comp(key, path.top()->getKey())) {
+        return false;
+    }
+    removeAt(path);
+    return true;
+}
+
+// remove the top of the path: the successor takes the place and the color of the node, the fix up
+// starts from the parent of the child that moved up (path.nodes[parentLevel], on the fromLeft side)
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void PathRBTree<Key, Value, Compare, Alloc>::removeAt(Path& path) {
+    Node* node = path.top();
+    int level = path.depth - 1;
+    int parentLevel = level - 1;
+    bool fromLeft = level > 0 && path.nodes[level - 1]->getLeft() == node;
+    RBColor originalColor = getColor(node);
+    if (node->getLeft() != nullptr && node->getRight() != nullptr) {
+        for (Node* ptr = node->getRight(); ptr != nullptr; ptr = ptr->getLeft()) {
+            path.push(ptr);
+        }
+        Node* successor = path.top();
+        int successorLevel = path.depth - 1;
+        originalColor = getColor(successor);
+        fromLeft = successorLevel > level + 1;
+        if (fromLeft) {
+            path.nodes[successorLevel - 1]->setLeft(successor->getRight());
+            successor->setRight(node->getRight());
+        }
+        successor->setLeft(node->getLeft());
+        setColor(successor, getColor(node));
+        this->replaceChild(path, level, successor);
+        path.nodes[level] = successor;
+        parentLevel = fromLeft ? successorLevel - 1 : level;
+    } else {
+        this->replaceChild(path, level, (node->getLeft() != nullptr) ? node->getLeft() : node->getRight());
+    }
+    this->destroyNode(node);
+    --(this->numOfNodes);
+    if (originalColor == RBColor::BLACK) {
+        delFixUp(path, parentLevel, fromLeft);
+    }
+}
+
+// fixers
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void PathRBTree<Key, Value, Compare, Alloc>::delFixUp(Path& path, int level, bool fromLeft) {
+    Node* node = (level < 0) ? this->root : (fromLeft ? path.nodes[level]->getLeft() : path.nodes[level]->getRight());
+    while (level >= 0 && getColor(node) == RBColor::BLACK) { // node, the fromLeft child of path.nodes[level], misses a black
+        Node* parent = path.nodes[level];
+        if (fromLeft) {
+            Node* sibling = parent->getRight();
+            if (getColor(sibling) == RBColor::RED) { // the sibling moves above parent, the path grows by one
+                setColor(sibling, RBColor::BLACK);
+                setColor(parent, RBColor::RED);
+                this->replaceChild(path, level, this->rotateLeft(parent));
+                path.nodes[level] = sibling;
+                path.nodes[++level] = parent;
+                sibling = parent->getRight();
+            }
+            if (getColor(sibling->getLeft()) == RBColor::BLACK && getColor(sibling->getRight()) == RBColor::BLACK) {
+                setColor(sibling, RBColor::RED);
+            } else {
+                if (getColor(sibling->getRight()) == RBColor::BLACK) {
+                    setColor(sibling->getLeft(), RBColor::BLACK);
+                    setColor(sibling, RBColor::RED);
+                    sibling = this->rotateRight(sibling);
+                    parent->setRight(sibling);
+                }
+                setColor(sibling, getColor(parent));
+                setColor(parent, RBColor::BLACK);
+                setColor(sibling->getRight(), RBColor::BLACK);
+                this->replaceChild(path, level, this->rotateLeft(parent));
+                node = this->root;
+                break;
+            }
+        } else {
+            Node* sibling = parent->getLeft();
+            if (getColor(sibling) == RBColor::RED) {
+                setColor(sibling, RBColor::BLACK);
+                setColor(parent, RBColor::RED);
+                this->replaceChild(path, level, this->rotateRight(parent));
+                path.nodes[level] = sibling;
+                path.nodes[++level] = parent;
+                sibling = parent->getLeft();
+            }
+            if (getColor(sibling->getRight()) == RBColor::BLACK && getColor(sibling->getLeft()) == RBColor::BLACK) {
+                setColor(sibling, RBColor::RED);
+            } else {
+                if (getColor(sibling->getLeft()) == RBColor::BLACK) {
+                    setColor(sibling->getRight(), RBColor::BLACK);
+                    setColor(sibling, RBColor::RED);
+                    sibling = this->rotateLeft(sibling);
+                    parent->setLeft(sibling);
+                }
+                setColor(sibling, getColor(parent));
+                setColor(parent, RBColor::BLACK);
+                setColor(sibling->getLeft(), RBColor::BLACK);
+                this->replaceChild(path, level, this->rotateRight(parent));
+                node = this->root;
+                break;
+            }
+        }
+        node = parent; // the missing black moves up
+        --level;
+        fromLeft = level >= 0 && path.nodes[level]->getLeft() == node;
+    }
+    if (node != nullptr) {
+        setColor(node, RBColor::BLACK);
+    }
+}
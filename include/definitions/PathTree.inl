@@ -0,0 +1,265 @@
+/**
+ * @file PathTree.inl
+ * @brief This file contains the implementation of the PathTree class
+ * @version 1.0
+ * @date 2023-01-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#include "PathTree.hpp"
+
+// constructors and destructor
+template <typename Key, typename Value, typename Compare, typename Alloc>
+PathTree<Key, Value, Compare, Alloc>::PathTree(const Compare& comp, const Alloc& alloc)
+    : comp(comp), allocator(alloc) {}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+PathTree<Key, Value, Compare, Alloc>::PathTree(PathTree&& other)
+    : comp(other.comp), allocator(other.allocator), root{other.root}, numOfNodes{other.numOfNodes} {
+    other.root = nullptr;
+    other.numOfNodes = 0;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+PathTree<Key, Value, Compare, Alloc>::~PathTree() {
+    clear();
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void PathTree<Key, Value, Compare, Alloc>::clear() {
+    if (root != nullptr) {
+        clear(root);
+    }
+    root = nullptr;
+    numOfNodes = 0;
+}
+
+// the tree is balanced, the recursion is at most MAX_DEPTH deep
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void PathTree<Key, Value, Compare, Alloc>::clear(Node* node) {
+    if (node->getLeft() != nullptr) {
+        clear(node->getLeft());
+    }
+    if (node->getRight() != nullptr) {
+        clear(node->getRight());
+    }
+    destroyNode(node);
+}
+
+// getters
+template <typename Key, typename Value, typename Compare, typename Alloc>
+inline bool PathTree<Key, Value, Compare, Alloc>::isEmpty() const {
+    return numOfNodes == 0;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+inline uint PathTree<Key, Value, Compare, Alloc>::getNumOfNodes() const {
+    return numOfNodes;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+inline typename PathTree<Key, Value, Compare, Alloc>::Node* PathTree<Key, Value, Compare, Alloc>::getRoot() const {
+    return root;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+inline typename PathTree<Key, Value, Compare, Alloc>::Node* PathTree<Key, Value, Compare, Alloc>::getNil() const {
+    return nullptr;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+uint PathTree<Key, Value, Compare, Alloc>::getHeight() const {
+    iterator it = begin();
+    uint height{it.path.depth};
+    for (; it.path.depth != 0; ++it) { // every leaf is reached by the walk, with its whole path
+        height = (it.path.depth > height) ? it.path.depth : height;
+    }
+    return height;
+}
+
+// node management
+template <typename Key, typename Value, typename Compare, typename Alloc>
+template <typename... Args>
+typename PathTree<Key, Value, Compare, Alloc>::Node* PathTree<Key, Value, Compare, Alloc>::createNode(const Key& key, Args&&... args) {
+    Node* node = std::allocator_traits<NodeAllocator>::allocate(allocator, 1);
+    std::allocator_traits<NodeAllocator>::construct(allocator, node, key, std::forward<Args>(args)...);
+    return node;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void PathTree<Key, Value, Compare, Alloc>::destroyNode(Node* node) {
+    std::allocator_traits<NodeAllocator>::destroy(allocator, node);
+    std::allocator_traits<NodeAllocator>::deallocate(allocator, node, 1);
+}
+
+// paths
+// record the path to the empty slot of a new key, equal keys go to the right
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void PathTree<Key, Value, Compare, Alloc>::descend(const Key& key, Path& path) const {
+    path.depth = 0;
+    for (Node* curr = root; curr != nullptr; curr = comp(key, curr->getKey()) ? curr->getLeft() : curr->getRight()) {
+        path.push(curr);
+    }
+}
+
+// hang the node in the slot found by descend and push it on the path
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void PathTree<Key, Value, Compare, Alloc>::link(Path& path, Node* node) {
+    if (path.depth == 0) {
+        root = node;
+    } else if (comp(node->getKey(), path.top()->getKey())) {
+        path.top()->setLeft(node);
+    } else {
+        path.top()->setRight(node);
+    }
+    path.push(node);
+    ++numOfNodes;
+}
+
+// the path to the first node with key >= key, empty if there is none
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void PathTree<Key, Value, Compare, Alloc>::lowerBound(const Key& key, Path& path) const {
+    path.depth = 0;
+    uint found{0};
+    for (Node* curr = root; curr != nullptr;) {
+        path.push(curr);
+        if (comp(curr->getKey(), key)) {
+            curr = curr->getRight();
+        } else {
+            found = path.depth; // a candidate, the ones below it on the left are smaller
+            curr = curr->getLeft();
+        }
+    }
+    path.depth = found;
+}
+
+// the path to a given node: equal keys are contiguous in key order, so it is among the ones from the lower bound
+template <typename Key, typename Value, typename Compare, typename Alloc>
+bool PathTree<Key, Value, Compare, Alloc>::findPath(Node* node, Path& path) const {
+    lowerBound(node->getKey(), path);
+    while (path.depth != 0 && path.top() != node) {
+        if (comp(node->getKey(), path.top()->getKey())) {
+            path.depth = 0;
+            break;
+        }
+        path.advance();
+    }
+    return path.depth != 0;
+}
+
+// replace the top of the path with its successor, the path becomes empty after the maximum
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void PathTree<Key, Value, Compare, Alloc>::Path::advance() {
+    Node* node = top();
+    if (node->getRight() != nullptr) {
+        for (node = node->getRight(); node != nullptr; node = node->getLeft()) {
+            push(node);
+        }
+        return;
+    }
+    Node* child;
+    do { // climb while coming from the right
+        child = nodes[--depth];
+    } while (depth != 0 && top()->getRight() == child);
+}
+
+// hang child where path.nodes[level] was
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void PathTree<Key, Value, Compare, Alloc>::replaceChild(const Path& path, uint level, Node* child) {
+    if (level == 0) {
+        root = child;
+        return;
+    }
+    Node* parent = path.nodes[level - 1];
+    if (parent->getLeft() == path.nodes[level]) {
+        parent->setLeft(child);
+    } else {
+        parent->setRight(child);
+    }
+}
+
+// core functionalities
+template <typename Key, typename Value, typename Compare, typename Alloc>
+typename PathTree<Key, Value, Compare, Alloc>::Node* PathTree<Key, Value, Compare, Alloc>::search(const Key& key) const {
+    Node* curr = root;
+    while (curr != nullptr) {
+        if (comp(key, curr->getKey())) {
+            curr = curr->getLeft();
+        } else if (comp(curr->getKey(), key)) {
+            curr = curr->getRight();
+        } else {
+            break;
+        }
+    }
+    return curr;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+typename PathTree<Key, Value, Compare, Alloc>::Node* PathTree<Key, Value, Compare, Alloc>::successor(Node* node) const {
+    Path path;
+    if (!findPath(node, path)) {
+        return nullptr;
+    }
+    path.advance();
+    return (path.depth == 0) ? nullptr : path.top();
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+typename PathTree<Key, Value, Compare, Alloc>::Node* PathTree<Key, Value, Compare, Alloc>::minimum() const {
+    Node* node = root;
+    while (node != nullptr && node->getLeft() != nullptr) {
+        node = node->getLeft();
+    }
+    return node;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+typename PathTree<Key, Value, Compare, Alloc>::Node* PathTree<Key, Value, Compare, Alloc>::maximum() const {
+    Node* node = root;
+    while (node != nullptr && node->getRight() != nullptr) {
+        node = node->getRight();
+    }
+    return node;
+}
+
+// iterators
+template <typename Key, typename Value, typename Compare, typename Alloc>
+typename PathTree<Key, Value, Compare, Alloc>::iterator PathTree<Key, Value, Compare, Alloc>::begin() const {
+    iterator it;
+    for (Node* node = root; node != nullptr; node = node->getLeft()) {
+        it.path.push(node);
+    }
+    return it;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+typename PathTree<Key, Value, Compare, Alloc>::iterator PathTree<Key, Value, Compare, Alloc>::lower_bound(const Key& key) const {
+    iterator it;
+    lowerBound(key, it.path);
+    return it;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+inline typename PathTree<Key, Value, Compare, Alloc>::iterator& PathTree<Key, Value, Compare, Alloc>::iterator::operator++() {
+    path.advance();
+    return *this;
+}
+
+// rotation methods, the caller hangs the returned node in place of the old one
+template <typename Key, typename Value, typename Compare, typename Alloc>
+typename PathTree<Key, Value, Compare, Alloc>::Node* PathTree<Key, Value, Compare, Alloc>::rotateLeft(Node* node) {
+    Node* ptr = node->getRight();
+    node->setRight(ptr->getLeft());
+    ptr->setLeft(node);
+    return ptr;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+typename PathTree<Key, Value, Compare, Alloc>::Node* PathTree<Key, Value, Compare, Alloc>::rotateRight(Node* node) {
+    Node* ptr = node->getLeft();
+    node->setLeft(ptr->getRight());
+    ptr->setRight(node);
+    return ptr;
+}
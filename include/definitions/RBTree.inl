@@ -8,68 +8,226 @@
  * 
  */
 
+#include <iterator>
 #include "RBTree.hpp"
 #include "RBTreeNode.hpp"
 
-const RBTreeNode::Color COL_RED = RBTreeNode::Color::RED;
-const RBTreeNode::Color COL_BLACK = RBTreeNode::Color::BLACK;
+const RBColor COL_RED = RBColor::RED;
+const RBColor COL_BLACK = RBColor::BLACK;
 
 // constuctors and destructors
-template <bool CMP(const int& key1, const int& key2)>
-RBTree<CMP>::RBTree() {
-    nil = std::make_shared<RBTreeNode>(nullptr);
-    nil->setColor(COL_BLACK);
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+RBTree<Key, Value, Compare, Alloc, Augment>::RBTree(const Compare& comp, const Alloc& alloc)
+    : SelfBalancingTree<Key, Value, Compare, Alloc, RBTreeNode<Key, Value, Augment>>(comp, alloc) {
+    nil = sharedNil();
     this->root = nil;
     this->nullValue = nil;
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-RBTree<CMP>::RBTree(sptr_RBTreeNode root) : RBTree() {
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+RBTree<Key, Value, Compare, Alloc, Augment>::RBTree(ptr_RBTreeNode<Key, Value, Augment> root, const Compare& comp, const Alloc& alloc) : RBTree(comp, alloc) {
     insert(root);
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-RBTree<CMP>::~RBTree() {}
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+RBTree<Key, Value, Compare, Alloc, Augment>::RBTree(RBTree&& other)
+    : SelfBalancingTree<Key, Value, Compare, Alloc, RBTreeNode<Key, Value, Augment>>(std::move(other)), nil{other.nil} {
+    other.root = other.nullValue = other.nil;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+RBTree<Key, Value, Compare, Alloc, Augment>::~RBTree() {
+    this->clear();
+    this->root = this->nullValue = nil = nullptr;
+}
+
+// the nil node is shared by every tree of the same type and never written after its construction (removals track
+// the parent of the replacing node instead of storing it in nil), so subtrees can move between trees as they are
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+ptr_RBTreeNode<Key, Value, Augment> RBTree<Key, Value, Compare, Alloc, Augment>::sharedNil() {
+    struct BlackNode : public RBTreeNode<Key, Value, Augment> {
+        BlackNode() : RBTreeNode<Key, Value, Augment>(Key(), Value()) {
+            this->setColor(COL_BLACK);
+        }
+    };
+    static BlackNode node;
+    return &node;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+template <typename Iterator>
+RBTree<Key, Value, Compare, Alloc, Augment> RBTree<Key, Value, Compare, Alloc, Augment>::buildFromSorted(Iterator first, Iterator last, const Compare& comp, const Alloc& alloc) {
+    RBTree tree(comp, alloc);
+    tree.buildBalanced(first, std::distance(first, last), annotateBalanced);
+    return tree;
+}
+
+// every nil of a tree linked by halving hangs from the last level or the one above, so coloring red only the
+// last level (below the root) gives the same black height on every path
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void RBTree<Key, Value, Compare, Alloc, Augment>::annotateBalanced(RBTreeNode<Key, Value, Augment>* node, unsigned int depth, int, unsigned int lastLevel, int) {
+    node->setColor((depth == lastLevel && depth > 0) ? COL_RED : COL_BLACK);
+}
 
 // getters
-template <bool CMP(const int& key1, const int& key2)>
-sptr_RBTreeNode RBTree<CMP>::getRoot() const {
-    return std::static_pointer_cast<RBTreeNode>(this->root);
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+ptr_RBTreeNode<Key, Value, Augment> RBTree<Key, Value, Compare, Alloc, Augment>::getRoot() const {
+    return static_cast<ptr_RBTreeNode<Key, Value, Augment>>(this->root);
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-sptr_RBTreeNode RBTree<CMP>::getNil() const {
-    return std::static_pointer_cast<RBTreeNode>(this->nil);
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+ptr_RBTreeNode<Key, Value, Augment> RBTree<Key, Value, Compare, Alloc, Augment>::getNil() const {
+    return nil;
 }
 
 // core functionalities
-template <bool CMP(const int& key1, const int& key2)>
-void RBTree<CMP>::insert(sptr_RBTreeNode&& node) {
-    BinarySearchTree<CMP>::insert(node);
-    if (this->numOfNodes == 1) {
-        node->setParent(this->nil);
-    }
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void RBTree<Key, Value, Compare, Alloc, Augment>::insert(ptr_RBTreeNode<Key, Value, Augment> node) {
+    BinarySearchTree<Key, Value, Compare, Alloc, RBTreeNode<Key, Value, Augment>>::insert(node);
+    fixAfterInsert(node);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void RBTree<Key, Value, Compare, Alloc, Augment>::fixAfterInsert(ptr_RBTreeNode<Key, Value, Augment> node) {
     node->setColor(COL_RED);
     node->setRight(this->nil);
     node->setLeft(this->nil);
     insFixUp(node);
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-void RBTree<CMP>::insert(sptr_TreeNodeObject&& obj) { 
-    this->insert(std::make_shared<RBTreeNode>(obj));
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void RBTree<Key, Value, Compare, Alloc, Augment>::insert(const Key& key, const Value& value) {
+    emplace(key, value);
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-void RBTree<CMP>::insert(TreeNodeObject* obj) {
-    this->insert(std::shared_ptr<TreeNodeObject>(obj));
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void RBTree<Key, Value, Compare, Alloc, Augment>::insert(const Key& key, Value&& value) {
+    emplace(key, std::move(value));
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-void RBTree<CMP>::remove(sptr_RBTreeNode node) {
-    sptr_RBTreeNode tmp = node;
-    RBTreeNode::Color tmpOriginalColor = tmp->getColor();
-    sptr_RBTreeNode tmp2;
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+template <typename... Args>
+ptr_RBTreeNode<Key, Value, Augment> RBTree<Key, Value, Compare, Alloc, Augment>::emplace(const Key& key, Args&&... args) {
+    ptr_RBTreeNode<Key, Value, Augment> node = this->createNode(key, std::forward<Args>(args)...);
+    this->insert(node);
+    return node;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void RBTree<Key, Value, Compare, Alloc, Augment>::insert(TreeNodeObject* obj) {
+    emplace(obj->getKey(), this->shareObject(obj));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+template <typename... Args>
+ptr_RBTreeNode<Key, Value, Augment> RBTree<Key, Value, Compare, Alloc, Augment>::emplaceHint(ptr_RBTreeNode<Key, Value, Augment> hint, const Key& key, Args&&... args) {
+    ptr_RBTreeNode<Key, Value, Augment> node = this->createNode(key, std::forward<Args>(args)...);
+    this->insertNear(hint, node);
+    fixAfterInsert(node);
+    return node;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+ptr_RBTreeNode<Key, Value, Augment> RBTree<Key, Value, Compare, Alloc, Augment>::insert(ptr_RBTreeNode<Key, Value, Augment> hint, TreeNodeObject* obj) {
+    return emplaceHint(hint, obj->getKey(), this->shareObject(obj));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void RBTree<Key, Value, Compare, Alloc, Augment>::insertBatch(std::vector<std::pair<Key, Value>> batch) {
+    if (this->mergeBatch(batch, annotateBalanced)) {
+        return;
+    }
+    ptr_RBTreeNode<Key, Value, Augment> hint = nil;
+    for (typename std::vector<std::pair<Key, Value>>::iterator it = batch.begin(); it != batch.end(); ++it) {
+        ptr_RBTreeNode<Key, Value, Augment> node = this->createNode(it->first, std::move(it->second));
+        this->insertNear(hint, node);
+        fixAfterInsert(node);
+        hint = node;
+    }
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void RBTree<Key, Value, Compare, Alloc, Augment>::insertBatch(const std::vector<TreeNodeObject*>& objects) {
+    std::vector<std::pair<Key, Value>> batch;
+    batch.reserve(objects.size());
+    for (TreeNodeObject* obj : objects) {
+        batch.emplace_back(obj->getKey(), this->shareObject(obj));
+    }
+    insertBatch(std::move(batch));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void RBTree<Key, Value, Compare, Alloc, Augment>::removeBatch(std::vector<Key> keys) {
+    if (this->mergeRemoveBatch(keys, annotateBalanced)) {
+        return;
+    }
+    for (typename std::vector<Key>::const_iterator key = keys.begin(); key != keys.end(); ++key) {
+        ptr_RBTreeNode<Key, Value, Augment> node = search(*key);
+        if (node != nil) {
+            remove(node);
+        }
+    }
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void RBTree<Key, Value, Compare, Alloc, Augment>::remove(ptr_RBTreeNode<Key, Value, Augment> node) {
+    detach(node);
+    this->destroyNode(node);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+bool RBTree<Key, Value, Compare, Alloc, Augment>::erase(const Key& key) {
+    ptr_RBTreeNode<Key, Value, Augment> node = search(key);
+    if (node == nil) {
+        return false;
+    }
+    remove(node);
+    return true;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+unsigned int RBTree<Key, Value, Compare, Alloc, Augment>::eraseRange(const Key& lo, const Key& hi) {
+    if (this->comp(hi, lo) || this->isEmpty()) {
+        return 0;
+    }
+    ptr_RBTreeNode<Key, Value, Augment> left = nil;
+    ptr_RBTreeNode<Key, Value, Augment> rest = nil;
+    unsigned int leftHeight{0};
+    unsigned int restHeight{0};
+    splitSubtree(getRoot(), blackHeight(getRoot()), lo, left, leftHeight, rest, restHeight);
+    // the first key past hi, the keys equal to it are all past the range
+    ptr_RBTreeNode<Key, Value, Augment> bound = nil;
+    for (ptr_RBTreeNode<Key, Value, Augment> node = rest; node != nil; ) {
+        if (this->comp(hi, node->getKey())) {
+            bound = node;
+            node = node->getLeft();
+        } else {
+            node = node->getRight();
+        }
+    }
+    ptr_RBTreeNode<Key, Value, Augment> middle = rest;
+    ptr_RBTreeNode<Key, Value, Augment> right = nil;
+    unsigned int middleHeight{restHeight};
+    unsigned int rightHeight{0};
+    if (bound != nil) {
+        splitSubtree(rest, restHeight, bound->getKey(), middle, middleHeight, right, rightHeight);
+    }
+    unsigned int count = this->destroySubtree(middle);
+    unsigned int numOfNodes = this->numOfNodes; // the pivot of the join is detached and relinked
+    unsigned int joinedHeight{0};
+    this->root = join2Subtrees(left, leftHeight, right, rightHeight, joinedHeight);
+    this->numOfNodes = this->countStale ? numOfNodes : numOfNodes - count;
+    return count;
+}
+
+// unlink the node from the tree and restore the colors, without freeing it
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void RBTree<Key, Value, Compare, Alloc, Augment>::detach(ptr_RBTreeNode<Key, Value, Augment> node) {
+    ptr_RBTreeNode<Key, Value, Augment> tmp = node;
+    RBColor tmpOriginalColor = tmp->getColor();
+    ptr_RBTreeNode<Key, Value, Augment> tmp2;
+    ptr_RBTreeNode<Key, Value, Augment> tmp2Parent = node->getParent(); // tmp2 may be nil, which does not store its parent
+    this->forgetNode(node);
     if (node->getLeft() == nil) {
         tmp2 = node->getRight();
         transplant(node, node->getRight());
@@ -77,22 +235,251 @@ void RBTree<CMP>::remove(sptr_RBTreeNode node) {
         tmp2 = node->getLeft();
         transplant(node, node->getLeft());
     } else {
-        removeWithTwoChildren(node, tmp, tmp2, tmpOriginalColor);
+        removeWithTwoChildren(node, tmp, tmp2, tmp2Parent, tmpOriginalColor);
     }
+    this->updatePath(tmp2Parent);
     if (tmpOriginalColor == COL_BLACK) {
-        delFixUp(tmp2);
+        delFixUp(tmp2, tmp2Parent);
     }
     --(this->numOfNodes);
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-void RBTree<CMP>::removeWithTwoChildren(sptr_RBTreeNode& node, sptr_RBTreeNode& tmp, sptr_RBTreeNode& tmp2, RBTreeNode::Color& tmpOriginalColor) {
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+RBTree<Key, Value, Compare, Alloc, Augment> RBTree<Key, Value, Compare, Alloc, Augment>::join(RBTree&& left, const Key& key, Value value, RBTree&& right) {
+    left.requireSameAllocator(right);
+    RBTree tree(std::move(left));
+    tree.join(tree.createNode(key, std::move(value)), right);
+    return tree;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+RBTree<Key, Value, Compare, Alloc, Augment> RBTree<Key, Value, Compare, Alloc, Augment>::join(RBTree&& left, RBTree&& right) {
+    left.requireSameAllocator(right);
+    RBTree tree(std::move(left));
+    if (!right.isEmpty()) {
+        ptr_RBTreeNode<Key, Value, Augment> pivot = right.minimum();
+        right.detach(pivot);
+        tree.join(pivot, right);
+    }
+    return tree;
+}
+
+// join this tree, pivot and the nodes of right into this tree
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void RBTree<Key, Value, Compare, Alloc, Augment>::join(ptr_RBTreeNode<Key, Value, Augment> pivot, RBTree& right) {
+    ptr_RBTreeNode<Key, Value, Augment> leftRoot = getRoot();
+    ptr_RBTreeNode<Key, Value, Augment> rightRoot = right.getRoot();
+    unsigned int joinedHeight{0};
+    this->takeNodes(right);
+    ++(this->numOfNodes);
+    joinSubtrees(leftRoot, blackHeight(leftRoot), pivot, rightRoot, blackHeight(rightRoot), joinedHeight);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+std::pair<RBTree<Key, Value, Compare, Alloc, Augment>, RBTree<Key, Value, Compare, Alloc, Augment>> RBTree<Key, Value, Compare, Alloc, Augment>::split(const Key& key) {
+    ptr_RBTreeNode<Key, Value, Augment> leftRoot = nil;
+    ptr_RBTreeNode<Key, Value, Augment> rightRoot = nil;
+    unsigned int leftHeight{0};
+    unsigned int rightHeight{0};
+    splitSubtree(getRoot(), blackHeight(getRoot()), key, leftRoot, leftHeight, rightRoot, rightHeight);
+
+    std::pair<RBTree, RBTree> halves(RBTree(this->comp, Alloc(this->nodeAllocator)), RBTree(this->comp, Alloc(this->nodeAllocator)));
+    halves.first.root = leftRoot;
+    halves.second.root = rightRoot;
+    halves.first.countStale = halves.second.countStale = true;
+    halves.first.blocks = this->blocks;
+    halves.second.blocks = std::move(this->blocks);
+    this->blocks.clear();
+    this->resetFinger();
+    this->root = nil;
+    this->numOfNodes = 0;
+    this->countStale = false;
+    return halves;
+}
+
+// the number of black nodes on every path from node down to nil, node included
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+unsigned int RBTree<Key, Value, Compare, Alloc, Augment>::blackHeight(ptr_RBTreeNode<Key, Value, Augment> node) const {
+    unsigned int height{0};
+    for (; node != nil; node = node->getLeft()) {
+        height += (node->getColor() == COL_BLACK) ? 1 : 0;
+    }
+    return height;
+}
+
+// link left, pivot and right (keys in this order, black or nil roots) into one subtree, which becomes the root of the
+// tree; the pivot replaces, red, the first black node on the inner spine of the other subtree with the same black height
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+ptr_RBTreeNode<Key, Value, Augment> RBTree<Key, Value, Compare, Alloc, Augment>::joinSubtrees(ptr_RBTreeNode<Key, Value, Augment> left, unsigned int leftHeight, ptr_RBTreeNode<Key, Value, Augment> pivot, ptr_RBTreeNode<Key, Value, Augment> right, unsigned int rightHeight, unsigned int& height) {
+    if (leftHeight == rightHeight) {
+        pivot->setLeft(left);
+        pivot->setRight(right);
+        pivot->setParent(nil);
+        pivot->setColor(COL_BLACK);
+        if (left != nil) {
+            left->setParent(pivot);
+        }
+        if (right != nil) {
+            right->setParent(pivot);
+        }
+        this->updateNode(pivot);
+        this->root = pivot;
+        height = leftHeight + 1;
+        return pivot;
+    }
+    bool leftTaller = leftHeight > rightHeight;
+    ptr_RBTreeNode<Key, Value, Augment> taller = leftTaller ? left : right;
+    ptr_RBTreeNode<Key, Value, Augment> shorter = leftTaller ? right : left;
+    unsigned int tallerHeight = leftTaller ? leftHeight : rightHeight;
+    unsigned int shorterHeight = leftTaller ? rightHeight : leftHeight;
+    ptr_RBTreeNode<Key, Value, Augment> parent = nil;
+    ptr_RBTreeNode<Key, Value, Augment> curr = taller;
+    unsigned int currHeight = tallerHeight;
+    while (curr->getColor() == COL_RED || currHeight > shorterHeight) {
+        currHeight -= (curr->getColor() == COL_BLACK) ? 1 : 0;
+        parent = curr;
+        curr = leftTaller ? curr->getRight() : curr->getLeft();
+    }
+    taller->setParent(nil);
+    this->root = taller;
+    pivot->setParent(parent);
+    pivot->setColor(COL_RED);
+    if (leftTaller) {
+        parent->setRight(pivot);
+        pivot->setLeft(curr);
+        pivot->setRight(shorter);
+    } else {
+        parent->setLeft(pivot);
+        pivot->setLeft(shorter);
+        pivot->setRight(curr);
+    }
+    if (curr != nil) {
+        curr->setParent(pivot);
+    }
+    if (shorter != nil) {
+        shorter->setParent(pivot);
+    }
+    this->updatePath(pivot);
+    height = tallerHeight + (insFixUp(pivot) ? 1 : 0);
+    return getRoot();
+}
+
+// split the subtree of node (black or nil) into the subtree of the keys less than key and the one of the others; if
+// found is given, a node with the key is left out of both and stored there
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void RBTree<Key, Value, Compare, Alloc, Augment>::splitSubtree(ptr_RBTreeNode<Key, Value, Augment> node, unsigned int nodeHeight, const Key& key, ptr_RBTreeNode<Key, Value, Augment>& left, unsigned int& leftHeight, ptr_RBTreeNode<Key, Value, Augment>& right, unsigned int& rightHeight, ptr_RBTreeNode<Key, Value, Augment>* found) {
+    if (node == nil) {
+        left = right = nil;
+        leftHeight = rightHeight = 0;
+        return;
+    }
+    ptr_RBTreeNode<Key, Value, Augment> children[2] = {node->getLeft(), node->getRight()};
+    unsigned int childrenHeight[2] = {nodeHeight - 1, nodeHeight - 1};
+    for (int i{0}; i < 2; ++i) {
+        if (children[i]->getColor() == COL_RED) { // the subtree will be a root: blackening it adds one to its black height
+            children[i]->setColor(COL_BLACK);
+            ++childrenHeight[i];
+        }
+    }
+    ptr_RBTreeNode<Key, Value, Augment> middle = nil;
+    unsigned int middleHeight{0};
+    if (this->comp(node->getKey(), key)) { // node and its left subtree go left
+        splitSubtree(children[1], childrenHeight[1], key, middle, middleHeight, right, rightHeight, found);
+        left = joinSubtrees(children[0], childrenHeight[0], node, middle, middleHeight, leftHeight);
+    } else if (found != nullptr && !this->comp(key, node->getKey())) {
+        left = children[0];
+        leftHeight = childrenHeight[0];
+        right = children[1];
+        rightHeight = childrenHeight[1];
+        *found = node;
+    } else {
+        splitSubtree(children[0], childrenHeight[0], key, left, leftHeight, middle, middleHeight, found);
+        right = joinSubtrees(middle, middleHeight, node, children[1], childrenHeight[1], rightHeight);
+    }
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+unsigned int RBTree<Key, Value, Compare, Alloc, Augment>::subtreeRank(ptr_RBTreeNode<Key, Value, Augment> node) const {
+    return blackHeight(node);
+}
+
+// the children of node, the black root of a subtree of the given black height, blackened to be roots themselves
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void RBTree<Key, Value, Compare, Alloc, Augment>::expose(ptr_RBTreeNode<Key, Value, Augment> node, unsigned int nodeHeight, ptr_RBTreeNode<Key, Value, Augment>& left, unsigned int& leftHeight, ptr_RBTreeNode<Key, Value, Augment>& right, unsigned int& rightHeight) const {
+    left = node->getLeft();
+    right = node->getRight();
+    leftHeight = rightHeight = nodeHeight - 1;
+    if (left->getColor() == COL_RED) {
+        left->setColor(COL_BLACK);
+        ++leftHeight;
+    }
+    if (right->getColor() == COL_RED) {
+        right->setColor(COL_BLACK);
+        ++rightHeight;
+    }
+}
+
+// link left and right (keys in this order, black or nil roots) into one subtree, using the minimum of right as pivot
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+ptr_RBTreeNode<Key, Value, Augment> RBTree<Key, Value, Compare, Alloc, Augment>::join2Subtrees(ptr_RBTreeNode<Key, Value, Augment> left, unsigned int leftHeight, ptr_RBTreeNode<Key, Value, Augment> right, unsigned int rightHeight, unsigned int& height) {
+    if (right == nil) {
+        height = leftHeight;
+        return left;
+    }
+    right->setParent(nil);
+    this->root = right;
+    ptr_RBTreeNode<Key, Value, Augment> pivot = minimum(right);
+    detach(pivot);
+    right = getRoot();
+    rightHeight = blackHeight(right);
+    return joinSubtrees(left, leftHeight, pivot, right, rightHeight, height);
+}
+
+// an empty tree sharing the comparator and the allocator, whose root is scratch space for the joins of a subtree
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+RBTree<Key, Value, Compare, Alloc, Augment> RBTree<Key, Value, Compare, Alloc, Augment>::workspace() const {
+    return RBTree(this->comp, Alloc(this->nodeAllocator));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+RBTree<Key, Value, Compare, Alloc, Augment> RBTree<Key, Value, Compare, Alloc, Augment>::setUnion(RBTree&& first, RBTree&& second) {
+    return SetOperations<RBTree, RBTreeNode<Key, Value, Augment>, unsigned int>::unite(std::move(first), std::move(second), nullptr);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+RBTree<Key, Value, Compare, Alloc, Augment> RBTree<Key, Value, Compare, Alloc, Augment>::setUnion(RBTree&& first, RBTree&& second, ThreadPool& pool) {
+    return SetOperations<RBTree, RBTreeNode<Key, Value, Augment>, unsigned int>::unite(std::move(first), std::move(second), &pool);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+RBTree<Key, Value, Compare, Alloc, Augment> RBTree<Key, Value, Compare, Alloc, Augment>::setIntersection(RBTree&& first, RBTree&& second) {
+    return SetOperations<RBTree, RBTreeNode<Key, Value, Augment>, unsigned int>::intersect(std::move(first), std::move(second), nullptr);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+RBTree<Key, Value, Compare, Alloc, Augment> RBTree<Key, Value, Compare, Alloc, Augment>::setIntersection(RBTree&& first, RBTree&& second, ThreadPool& pool) {
+    return SetOperations<RBTree, RBTreeNode<Key, Value, Augment>, unsigned int>::intersect(std::move(first), std::move(second), &pool);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+RBTree<Key, Value, Compare, Alloc, Augment> RBTree<Key, Value, Compare, Alloc, Augment>::setDifference(RBTree&& first, RBTree&& second) {
+    return SetOperations<RBTree, RBTreeNode<Key, Value, Augment>, unsigned int>::subtract(std::move(first), std::move(second), nullptr);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+RBTree<Key, Value, Compare, Alloc, Augment> RBTree<Key, Value, Compare, Alloc, Augment>::setDifference(RBTree&& first, RBTree&& second, ThreadPool& pool) {
+    return SetOperations<RBTree, RBTreeNode<Key, Value, Augment>, unsigned int>::subtract(std::move(first), std::move(second), &pool);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void RBTree<Key, Value, Compare, Alloc, Augment>::removeWithTwoChildren(ptr_RBTreeNode<Key, Value, Augment>& node, ptr_RBTreeNode<Key, Value, Augment>& tmp, ptr_RBTreeNode<Key, Value, Augment>& tmp2, ptr_RBTreeNode<Key, Value, Augment>& tmp2Parent, RBColor& tmpOriginalColor) {
     tmp = minimum(node->getRight());
     tmpOriginalColor = tmp->getColor();
     tmp2 = tmp->getRight();
     if (tmp->getParent() == node) {
-        tmp2->setParent(tmp);
+        tmp2Parent = tmp;
     } else {
+        tmp2Parent = tmp->getParent();
         transplant(tmp, tmp->getRight());
         tmp->setRight(node->getRight());
         tmp->getRight()->setParent(tmp);
@@ -104,31 +491,35 @@ void RBTree<CMP>::removeWithTwoChildren(sptr_RBTreeNode& node, sptr_RBTreeNode&
 }
 
 
-template <bool CMP(const int& key1, const int& key2)>
-sptr_RBTreeNode RBTree<CMP>::search(int key) {
-    sptr_TreeNode node = BinarySearchTree<CMP>::search(key);
-    return std::static_pointer_cast<RBTreeNode>(node);
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+ptr_RBTreeNode<Key, Value, Augment> RBTree<Key, Value, Compare, Alloc, Augment>::search(const Key& key) const {
+    return static_cast<ptr_RBTreeNode<Key, Value, Augment>>(BinarySearchTree<Key, Value, Compare, Alloc, RBTreeNode<Key, Value, Augment>>::search(key));
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-sptr_RBTreeNode RBTree<CMP>::minimum(sptr_RBTreeNode root) const {
-    return std::static_pointer_cast<RBTreeNode>(BinarySearchTree<CMP>::minimum(root));
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+ptr_RBTreeNode<Key, Value, Augment> RBTree<Key, Value, Compare, Alloc, Augment>::select(unsigned int index) const {
+    return static_cast<ptr_RBTreeNode<Key, Value, Augment>>(BinarySearchTree<Key, Value, Compare, Alloc, RBTreeNode<Key, Value, Augment>>::select(index));
 }
-template <bool CMP(const int& key1, const int& key2)>
-inline sptr_RBTreeNode RBTree<CMP>::minimum() const {
-    return std::static_pointer_cast<RBTreeNode>(BinarySearchTree<CMP>::minimum());
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+ptr_RBTreeNode<Key, Value, Augment> RBTree<Key, Value, Compare, Alloc, Augment>::minimum(ptr_RBTreeNode<Key, Value, Augment> root) const {
+    return static_cast<ptr_RBTreeNode<Key, Value, Augment>>(BinarySearchTree<Key, Value, Compare, Alloc, RBTreeNode<Key, Value, Augment>>::minimum(root));
 }
-template <bool CMP(const int& key1, const int& key2)>
-sptr_RBTreeNode RBTree<CMP>::maximum(sptr_RBTreeNode root) const {
-    return std::static_pointer_cast<RBTreeNode>(BinarySearchTree<CMP>::maximum(root));
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+inline ptr_RBTreeNode<Key, Value, Augment> RBTree<Key, Value, Compare, Alloc, Augment>::minimum() const {
+    return static_cast<ptr_RBTreeNode<Key, Value, Augment>>(BinarySearchTree<Key, Value, Compare, Alloc, RBTreeNode<Key, Value, Augment>>::minimum());
 }
-template <bool CMP(const int& key1, const int& key2)>
-inline sptr_RBTreeNode RBTree<CMP>::maximum() const {
-    return std::static_pointer_cast<RBTreeNode>(BinarySearchTree<CMP>::maximum());
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+ptr_RBTreeNode<Key, Value, Augment> RBTree<Key, Value, Compare, Alloc, Augment>::maximum(ptr_RBTreeNode<Key, Value, Augment> root) const {
+    return static_cast<ptr_RBTreeNode<Key, Value, Augment>>(BinarySearchTree<Key, Value, Compare, Alloc, RBTreeNode<Key, Value, Augment>>::maximum(root));
+}
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+inline ptr_RBTreeNode<Key, Value, Augment> RBTree<Key, Value, Compare, Alloc, Augment>::maximum() const {
+    return static_cast<ptr_RBTreeNode<Key, Value, Augment>>(BinarySearchTree<Key, Value, Compare, Alloc, RBTreeNode<Key, Value, Augment>>::maximum());
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-void RBTree<CMP>::transplant(sptr_RBTreeNode curr_node, sptr_RBTreeNode new_node) {
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void RBTree<Key, Value, Compare, Alloc, Augment>::transplant(ptr_RBTreeNode<Key, Value, Augment> curr_node, ptr_RBTreeNode<Key, Value, Augment> new_node) {
     if (curr_node->getParent() == nil) {
         this->root = new_node;
     } else if (curr_node == curr_node->getParent()->getLeft()) {
@@ -136,12 +527,14 @@ void RBTree<CMP>::transplant(sptr_RBTreeNode curr_node, sptr_RBTreeNode new_node
     } else {
         curr_node->getParent()->setRight(new_node);
     }
-    new_node->setParent(curr_node->getParent());
+    if (new_node != nil) {
+        new_node->setParent(curr_node->getParent());
+    }
 }
 
 // fixers
-template <bool CMP(const int& key1, const int& key2)>
-void RBTree<CMP>::insFixUp(sptr_RBTreeNode node) {
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+bool RBTree<Key, Value, Compare, Alloc, Augment>::insFixUp(ptr_RBTreeNode<Key, Value, Augment> node) {
     while (node->getParent()->getColor() == COL_RED) {
         if (!insFixUpRedUncle(node)) {
             if (!insFixUpBlackUncleLeft(node)) {
@@ -150,13 +543,15 @@ void RBTree<CMP>::insFixUp(sptr_RBTreeNode node) {
         }
     }
     
+    bool grown = this->getRoot()->getColor() == COL_RED; // blackening a red root adds one to every black height
     this->getRoot()->setColor(COL_BLACK);
+    return grown;
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-bool RBTree<CMP>::insFixUpRedUncle(sptr_RBTreeNode& node) {
-    sptr_RBTreeNode grandparent = node->getParent()->getParent(); 
-    sptr_RBTreeNode uncle = grandparent->getLeft(); 
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+bool RBTree<Key, Value, Compare, Alloc, Augment>::insFixUpRedUncle(ptr_RBTreeNode<Key, Value, Augment>& node) {
+    ptr_RBTreeNode<Key, Value, Augment> grandparent = node->getParent()->getParent(); 
+    ptr_RBTreeNode<Key, Value, Augment> uncle = grandparent->getLeft(); 
     if (node->getParent() == grandparent->getLeft()) { 
         uncle = grandparent->getRight(); 
     }
@@ -170,9 +565,9 @@ bool RBTree<CMP>::insFixUpRedUncle(sptr_RBTreeNode& node) {
     return false; // execute the insFixUpBlackUncleLeft or insFixUpBlackUncleRight next
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-bool RBTree<CMP>::insFixUpBlackUncleLeft(sptr_RBTreeNode& node) {
-    sptr_RBTreeNode grandparent = node->getParent()->getParent();
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+bool RBTree<Key, Value, Compare, Alloc, Augment>::insFixUpBlackUncleLeft(ptr_RBTreeNode<Key, Value, Augment>& node) {
+    ptr_RBTreeNode<Key, Value, Augment> grandparent = node->getParent()->getParent();
     if (node->getParent() == grandparent->getLeft()) {
         if (node == node->getParent()->getRight()) {
             node = node->getParent();
@@ -186,9 +581,9 @@ bool RBTree<CMP>::insFixUpBlackUncleLeft(sptr_RBTreeNode& node) {
     return false;
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-bool RBTree<CMP>::insFixUpBlackUncleRight(sptr_RBTreeNode& node) {
-    sptr_RBTreeNode grandparent = node->getParent()->getParent();
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+bool RBTree<Key, Value, Compare, Alloc, Augment>::insFixUpBlackUncleRight(ptr_RBTreeNode<Key, Value, Augment>& node) {
+    ptr_RBTreeNode<Key, Value, Augment> grandparent = node->getParent()->getParent();
     if (node->getParent() == grandparent->getRight()) {
         if (node == node->getParent()->getLeft()) {
             node = node->getParent();
@@ -202,89 +597,94 @@ bool RBTree<CMP>::insFixUpBlackUncleRight(sptr_RBTreeNode& node) {
     return false;
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-void RBTree<CMP>::delFixUp(sptr_RBTreeNode node) {
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void RBTree<Key, Value, Compare, Alloc, Augment>::delFixUp(ptr_RBTreeNode<Key, Value, Augment> node, ptr_RBTreeNode<Key, Value, Augment> parent) {
+    // when node is nil its sibling is not (it holds the black node that was lost), so the side test is unambiguous
     while (node != getRoot() && node->getColor() == COL_BLACK) {
-        if (node == node->getParent()->getLeft()) {
-            delFixUpLeft(node);
+        if (node == parent->getLeft()) {
+            delFixUpLeft(node, parent);
         } else {
-            delFixUpRight(node);
+            delFixUpRight(node, parent);
         }
     }
-    node->setColor(COL_BLACK);
+    if (node != nil) {
+        node->setColor(COL_BLACK);
+    }
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-void RBTree<CMP>::delFixUpLeft(sptr_RBTreeNode& node) {
-    sptr_RBTreeNode sibling = node->getParent()->getRight();
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void RBTree<Key, Value, Compare, Alloc, Augment>::delFixUpLeft(ptr_RBTreeNode<Key, Value, Augment>& node, ptr_RBTreeNode<Key, Value, Augment>& parent) {
+    ptr_RBTreeNode<Key, Value, Augment> sibling = parent->getRight();
     if (sibling->getColor() == COL_RED) {
         sibling->setColor(COL_BLACK);
-        node->getParent()->setColor(COL_RED);
-        this->rotateLeft(node->getParent());
-        sibling = node->getParent()->getRight();
+        parent->setColor(COL_RED);
+        this->rotateLeft(parent);
+        sibling = parent->getRight();
     }
     if (sibling->getLeft()->getColor() == COL_BLACK && sibling->getRight()->getColor() == COL_BLACK) {
         sibling->setColor(COL_RED);
-        node = node->getParent();
+        node = parent;
+        parent = node->getParent();
     } else {
         if (sibling->getRight()->getColor() == COL_BLACK) {
             sibling->getLeft()->setColor(COL_BLACK);
             sibling->setColor(COL_RED);
             this->rotateRight(sibling);
-            sibling = node->getParent()->getRight();
+            sibling = parent->getRight();
         }
-        sibling->setColor(node->getParent()->getColor());
-        node->getParent()->setColor(COL_BLACK);
+        sibling->setColor(parent->getColor());
+        parent->setColor(COL_BLACK);
         sibling->getRight()->setColor(COL_BLACK);
-        this->rotateLeft(node->getParent());
+        this->rotateLeft(parent);
         node = getRoot();
     }
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-void RBTree<CMP>::delFixUpRight(sptr_RBTreeNode& node) {
-    sptr_RBTreeNode sibling = node->getParent()->getLeft();
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void RBTree<Key, Value, Compare, Alloc, Augment>::delFixUpRight(ptr_RBTreeNode<Key, Value, Augment>& node, ptr_RBTreeNode<Key, Value, Augment>& parent) {
+    ptr_RBTreeNode<Key, Value, Augment> sibling = parent->getLeft();
     if (sibling->getColor() == COL_RED) {
         sibling->setColor(COL_BLACK);
-        node->getParent()->setColor(COL_RED);
-        this->rotateRight(node->getParent());
-        sibling = node->getParent()->getLeft();
+        parent->setColor(COL_RED);
+        this->rotateRight(parent);
+        sibling = parent->getLeft();
     }
     if (sibling->getRight()->getColor() == COL_BLACK && sibling->getLeft()->getColor() == COL_BLACK) {
         sibling->setColor(COL_RED);
-        node = node->getParent();
+        node = parent;
+        parent = node->getParent();
     } else {
         if (sibling->getLeft()->getColor() == COL_BLACK) {
             sibling->getRight()->setColor(COL_BLACK);
             sibling->setColor(COL_RED);
             this->rotateLeft(sibling);
-            sibling = node->getParent()->getLeft();
+            sibling = parent->getLeft();
         }
-        sibling->setColor(node->getParent()->getColor());
-        node->getParent()->setColor(COL_BLACK);
+        sibling->setColor(parent->getColor());
+        parent->setColor(COL_BLACK);
         sibling->getLeft()->setColor(COL_BLACK);
-        this->rotateRight(node->getParent());
+        this->rotateRight(parent);
         node = getRoot();
     }
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-void RBTree<CMP>::rotateLeft(sptr_RBTreeNode node) {
-    SelfBalancingTree<CMP>::rotateLeft(node);
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void RBTree<Key, Value, Compare, Alloc, Augment>::rotateLeft(ptr_RBTreeNode<Key, Value, Augment> node) {
+    SelfBalancingTree<Key, Value, Compare, Alloc, RBTreeNode<Key, Value, Augment>>::rotateLeft(node);
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-void RBTree<CMP>::rotateRight(sptr_RBTreeNode node) {
-    SelfBalancingTree<CMP>::rotateRight(node);
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void RBTree<Key, Value, Compare, Alloc, Augment>::rotateRight(ptr_RBTreeNode<Key, Value, Augment> node) {
+    SelfBalancingTree<Key, Value, Compare, Alloc, RBTreeNode<Key, Value, Augment>>::rotateRight(node);
 }
 
 // print tree structure
-template <bool CMP(const int& key1, const int& key2)>
-void RBTree<CMP>::prettyPrint(const std::string& prefix, sptr_RBTreeNode node, bool isLeft) const {
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void RBTree<Key, Value, Compare, Alloc, Augment>::prettyPrint(const std::string& prefix, ptr_RBTreeNode<Key, Value, Augment> node, bool isLeft) const {
     if (node != nullptr && node != nil) {
         std::cout << prefix;
         std::cout << (isLeft ? "├──" : "└──");
-        std::cout << node->getObjKey() << ((node->getColor() == COL_RED) ? "R":"B")<< std::endl;
+        std::cout << node->getKey() << ((node->getColor() == COL_RED) ? "R":"B")<< std::endl;
         // enter the next tree level - left and right branch
         prettyPrint( prefix + (isLeft ? "│   " : "    "), node->getRight(), true);
         prettyPrint( prefix + (isLeft ? "│   " : "    "), node->getLeft(), false);
@@ -295,7 +695,7 @@ void RBTree<CMP>::prettyPrint(const std::string& prefix, sptr_RBTreeNode node, b
     }
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-void RBTree<CMP>::prettyPrint() const {
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void RBTree<Key, Value, Compare, Alloc, Augment>::prettyPrint() const {
     prettyPrint("", getRoot(), false);
 }
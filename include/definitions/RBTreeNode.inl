@@ -0,0 +1,41 @@
+/**
+ * @file RBTreeNode.inl
+ * @brief This file contains the implementation of the RBTreeNode class
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include "RBTreeNode.hpp"
+
+
+// constructor
+template <typename Key, typename Value, typename Augment>
+template <typename... Args>
+RBTreeNode<Key, Value, Augment>::RBTreeNode(const Key& key, Args&&... args) : TreeNode<Key, Value>(key, std::forward<Args>(args)...) {
+    setColor(RBColor::RED);
+}
+
+// getters and setters
+template <typename Key, typename Value, typename Augment>
+RBColor RBTreeNode<Key, Value, Augment>::getColor() const {
+    return this->getTag() ? RBColor::BLACK : RBColor::RED;
+}
+template <typename Key, typename Value, typename Augment>
+void RBTreeNode<Key, Value, Augment>::setColor(RBColor color) {
+    this->setTag(color == RBColor::BLACK ? 1 : 0);
+}
+template <typename Key, typename Value, typename Augment>
+RBTreeNode<Key, Value, Augment>* RBTreeNode<Key, Value, Augment>::getLeft() const {
+    return static_cast<RBTreeNode*>(this->left);
+}
+template <typename Key, typename Value, typename Augment>
+RBTreeNode<Key, Value, Augment>* RBTreeNode<Key, Value, Augment>::getRight() const {
+    return static_cast<RBTreeNode*>(this->right); 
+}
+template <typename Key, typename Value, typename Augment>
+RBTreeNode<Key, Value, Augment>* RBTreeNode<Key, Value, Augment>::getParent() const {
+    return static_cast<RBTreeNode*>(TreeNode<Key, Value>::getParent());
+}
@@ -0,0 +1,242 @@
+/**
+ * @file ScapegoatTree.inl
+
+ * @brief This file contains the implementation of the ScapegoatTree class
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include "ScapegoatTree.hpp"
+
+// constuctor and destructor
+template <typename Key, typename Value, typename Compare, typename Alloc>
+ScapegoatTree<Key, Value, Compare, Alloc>::ScapegoatTree(const Compare& comp, const Alloc& alloc)
+: BinarySearchTree<Key, Value, Compare, Alloc>{comp, alloc} {}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+ScapegoatTree<Key, Value, Compare, Alloc>::~ScapegoatTree() = default;
+
+// core functions
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void ScapegoatTree<Key, Value, Compare, Alloc>::insert(const Key& key, const Value& value) {
+    emplace(key, value);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void ScapegoatTree<Key, Value, Compare, Alloc>::insert(const Key& key, Value&& value) {
+    emplace(key, std::move(value));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+template <typename... Args>
+ptr_TreeNode<Key, Value> ScapegoatTree<Key, Value, Compare, Alloc>::emplace(const Key& key, Args&&... args) {
+    ptr_TreeNode<Key, Value> node = this->createNode(key, std::forward<Args>(args)...);
+    BinarySearchTree<Key, Value, Compare, Alloc>::insert(node);
+    fixAfterInsert(node);
+    return node;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void ScapegoatTree<Key, Value, Compare, Alloc>::insert(TreeNodeObject* obj) {
+    emplace(obj->getKey(), this->shareObject(obj));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+template <typename... Args>
+ptr_TreeNode<Key, Value> ScapegoatTree<Key, Value, Compare, Alloc>::emplaceHint(ptr_TreeNode<Key, Value> hint, const Key& key, Args&&... args) {
+    ptr_TreeNode<Key, Value> node = this->createNode(key, std::forward<Args>(args)...);
+    this->insertNear(hint, node);
+    fixAfterInsert(node);
+    return node;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+ptr_TreeNode<Key, Value> ScapegoatTree<Key, Value, Compare, Alloc>::insert(ptr_TreeNode<Key, Value> hint, TreeNodeObject* obj) {
+    return emplaceHint(hint, obj->getKey(), this->shareObject(obj));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void ScapegoatTree<Key, Value, Compare, Alloc>::insertBatch(std::vector<std::pair<Key, Value>> batch) {
+    if (batch.empty()) {
+        return;
+    }
+    if (this->mergeBatch(batch, BinarySearchTree<Key, Value, Compare, Alloc>::keepShape)) { // the whole tree was relinked balanced
+        setMaxNumOfNodes(this->numOfNodes);
+        return;
+    }
+    ptr_TreeNode<Key, Value> hint = this->nullValue;
+    for (typename std::vector<std::pair<Key, Value>>::iterator it = batch.begin(); it != batch.end(); ++it) {
+        hint = emplaceHint(hint, it->first, std::move(it->second));
+    }
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void ScapegoatTree<Key, Value, Compare, Alloc>::insertBatch(const std::vector<TreeNodeObject*>& objects) {
+    std::vector<std::pair<Key, Value>> batch;
+    batch.reserve(objects.size());
+    for (TreeNodeObject* obj : objects) {
+        batch.emplace_back(obj->getKey(), this->shareObject(obj));
+    }
+    insertBatch(std::move(batch));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void ScapegoatTree<Key, Value, Compare, Alloc>::remove(ptr_TreeNode<Key, Value> node) {
+    this->unlink(node);
+    this->destroyNode(node);
+    fixAfterRemove();
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+bool ScapegoatTree<Key, Value, Compare, Alloc>::erase(const Key& key) {
+    ptr_TreeNode<Key, Value> node = this->search(key);
+    if (node == this->nullValue) {
+        return false;
+    }
+    remove(node);
+    return true;
+}
+
+// one node at a time: BinarySearchTree::eraseRange hangs what is left on the right of the range below the left
+// part, which may push it past depthLimit
+template <typename Key, typename Value, typename Compare, typename Alloc>
+unsigned int ScapegoatTree<Key, Value, Compare, Alloc>::eraseRange(const Key& lo, const Key& hi) {
+    unsigned int count{0};
+    ptr_TreeNode<Key, Value> node = this->lower_bound(lo).getNode();
+    while (node != this->nullValue && !this->comp(hi, node->getKey())) {
+        ptr_TreeNode<Key, Value> next = this->successor(node); // a rebuild relinks the nodes, next stays in the tree
+        remove(node);
+        node = next;
+        ++count;
+    }
+    return count;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void ScapegoatTree<Key, Value, Compare, Alloc>::removeBatch(std::vector<Key> keys) {
+    if (keys.empty()) {
+        return;
+    }
+    if (this->mergeRemoveBatch(keys, BinarySearchTree<Key, Value, Compare, Alloc>::keepShape)) { // the whole tree was relinked balanced
+        setMaxNumOfNodes(this->numOfNodes);
+        return;
+    }
+    for (typename std::vector<Key>::const_iterator key = keys.begin(); key != keys.end(); ++key) {
+        erase(*key);
+    }
+}
+
+// fixers
+// a node deeper than depthLimit has an ancestor whose child on the path holds more than 2/3 of its subtree: the
+// sizes are counted climbing from the node, the sibling subtrees are visited once
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void ScapegoatTree<Key, Value, Compare, Alloc>::fixAfterInsert(ptr_TreeNode<Key, Value> node) {
+    if (this->numOfNodes > maxNumOfNodes) {
+        maxNumOfNodes = this->numOfNodes;
+        while (maxNumOfNodes >= nextLimitSize) {
+            ++depthLimit;
+            nextLimitSize *= 1.5;
+        }
+    }
+    uint depth{0};
+    for (ptr_TreeNode<Key, Value> ptr = node->getParent(); ptr != this->nullValue && depth <= depthLimit; ptr = ptr->getParent()) {
+        ++depth;
+    }
+    if (depth <= depthLimit) {
+        return;
+    }
+    uint childSize{1};
+    for (ptr_TreeNode<Key, Value> child = node, parent = node->getParent(); parent != this->nullValue; child = parent, parent = parent->getParent()) {
+        ptr_TreeNode<Key, Value> sibling = (child == parent->getLeft()) ? parent->getRight() : parent->getLeft();
+        uint size = childSize + 1 + subtreeSize(sibling);
+        if (3 * childSize > 2 * size) {
+            rebuild(parent, size);
+            return;
+        }
+        childSize = size;
+    }
+}
+
+// less than 2/3 of the largest size left: rebuild the whole tree, which becomes the new largest size
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void ScapegoatTree<Key, Value, Compare, Alloc>::fixAfterRemove() {
+    if (3 * this->numOfNodes < 2 * maxNumOfNodes) {
+        if (this->root != this->nullValue) {
+            rebuild(this->root, this->numOfNodes);
+        }
+        setMaxNumOfNodes(this->numOfNodes);
+    }
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void ScapegoatTree<Key, Value, Compare, Alloc>::setMaxNumOfNodes(uint size) {
+    maxNumOfNodes = size;
+    depthLimit = 0;
+    nextLimitSize = 1.5;
+    while (size >= nextLimitSize) {
+        ++depthLimit;
+        nextLimitSize *= 1.5;
+    }
+}
+
+// the subtrees are at most O(log n) deep, the recursion is bounded
+template <typename Key, typename Value, typename Compare, typename Alloc>
+unsigned int ScapegoatTree<Key, Value, Compare, Alloc>::subtreeSize(ptr_TreeNode<Key, Value> node) const {
+    if (node == this->nullValue) {
+        return 0;
+    }
+    return subtreeSize(node->getLeft()) + 1 + subtreeSize(node->getRight());
+}
+
+// rebuilding
+// relink the size nodes of the subtree of node perfectly balanced, in the place of node; the keys keep their
+// order, so the finger of insert stays valid
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void ScapegoatTree<Key, Value, Compare, Alloc>::rebuild(ptr_TreeNode<Key, Value> node, uint size) {
+    ptr_TreeNode<Key, Value> parent = node->getParent();
+    bool isLeft = parent != this->nullValue && parent->getLeft() == node;
+    ptr_TreeNode<Key, Value> head = flatten(node, this->nullValue);
+    ptr_TreeNode<Key, Value> subtree = buildFromList(head, size);
+    subtree->setParent(parent);
+    if (parent == this->nullValue) {
+        this->root = subtree;
+    } else if (isLeft) {
+        parent->setLeft(subtree);
+    } else {
+        parent->setRight(subtree);
+    }
+}
+
+// thread the subtree of node in key order through the right links, followed by the list next; returns its head
+template <typename Key, typename Value, typename Compare, typename Alloc>
+ptr_TreeNode<Key, Value> ScapegoatTree<Key, Value, Compare, Alloc>::flatten(ptr_TreeNode<Key, Value> node, ptr_TreeNode<Key, Value> next) {
+    if (node == this->nullValue) {
+        return next;
+    }
+    node->setRight(flatten(node->getRight(), next));
+    return flatten(node->getLeft(), node);
+}
+
+// link the first size nodes of the list into a balanced subtree, advancing head past them
+template <typename Key, typename Value, typename Compare, typename Alloc>
+ptr_TreeNode<Key, Value> ScapegoatTree<Key, Value, Compare, Alloc>::buildFromList(ptr_TreeNode<Key, Value>& head, uint size) {
+    if (size == 0) {
+        return this->nullValue;
+    }
+    ptr_TreeNode<Key, Value> left = buildFromList(head, (size - 1) / 2);
+    ptr_TreeNode<Key, Value> node = head;
+    head = head->getRight();
+    ptr_TreeNode<Key, Value> right = buildFromList(head, size - 1 - (size - 1) / 2);
+    node->setLeft(left);
+    node->setRight(right);
+    if (left != this->nullValue) {
+        left->setParent(node);
+    }
+    if (right != this->nullValue) {
+        right->setParent(node);
+    }
+    return node;
+}
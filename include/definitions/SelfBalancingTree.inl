@@ -10,28 +10,29 @@
 
 #include "SelfBalancingTree.hpp"
 // constructors and destructor
-template <bool CMP(const int& key1, const int& key2)>
-SelfBalancingTree<CMP>::SelfBalancingTree() {}
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+SelfBalancingTree<Key, Value, Compare, Alloc, Node>::SelfBalancingTree(const Compare& comp, const Alloc& alloc)
+    : BinarySearchTree<Key, Value, Compare, Alloc, Node>(comp, alloc) {}
 
 
-template <bool CMP(const int& key1, const int& key2)>
-SelfBalancingTree<CMP>::SelfBalancingTree(sptr_TreeNode root)
-    : BinarySearchTree<CMP>(root) {}
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+SelfBalancingTree<Key, Value, Compare, Alloc, Node>::SelfBalancingTree(ptr_TreeNode<Key, Value> root, const Compare& comp, const Alloc& alloc)
+    : BinarySearchTree<Key, Value, Compare, Alloc, Node>(root, comp, alloc) {}
 
-template <bool CMP(const int& key1, const int& key2)>
-SelfBalancingTree<CMP>::~SelfBalancingTree() {};
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+SelfBalancingTree<Key, Value, Compare, Alloc, Node>::~SelfBalancingTree() {};
 
 // rotation methods
-template <bool CMP(const int& key1, const int& key2)>
-void SelfBalancingTree<CMP>::rotateLeft(sptr_TreeNode node) {
-    sptr_TreeNode ptr = node->getRight();
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+void SelfBalancingTree<Key, Value, Compare, Alloc, Node>::rotateLeft(ptr_TreeNode<Key, Value> node) {
+    ptr_TreeNode<Key, Value> ptr = node->getRight();
     node->setRight(ptr->getLeft());
-    if (ptr->getLeft().get() != this->nullValue.get()) {
+    if (ptr->getLeft() != this->nullValue) {
         ptr->getLeft()->setParent(node);
     }
 
     ptr->setParent(node->getParent());
-    if (node->getParent().get() == this->nullValue.get()) {
+    if (node->getParent() == this->nullValue) {
         this->root = ptr;
     } else if (node == node->getParent()->getLeft()) {
         node->getParent()->setLeft(ptr);
@@ -40,18 +41,20 @@ void SelfBalancingTree<CMP>::rotateLeft(sptr_TreeNode node) {
     }
     ptr->setLeft(node);
     node->setParent(ptr);
+    this->updateNode(node);
+    this->updateNode(ptr);
 }
 
-template <bool CMP(const int& key1, const int& key2)>
-void SelfBalancingTree<CMP>::rotateRight(sptr_TreeNode node) {
-    sptr_TreeNode ptr = node->getLeft();
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Node>
+void SelfBalancingTree<Key, Value, Compare, Alloc, Node>::rotateRight(ptr_TreeNode<Key, Value> node) {
+    ptr_TreeNode<Key, Value> ptr = node->getLeft();
     node->setLeft(ptr->getRight());
 
-    if (ptr->getRight().get() != this->nullValue.get()) {
+    if (ptr->getRight() != this->nullValue) {
         ptr->getRight()->setParent(node);
     }
     ptr->setParent(node->getParent());
-    if (node->getParent().get() == this->nullValue.get()) {
+    if (node->getParent() == this->nullValue) {
         this->root = ptr;
     } else if (node == node->getParent()->getRight()) {
         node->getParent()->setRight(ptr);
@@ -60,5 +63,7 @@ void SelfBalancingTree<CMP>::rotateRight(sptr_TreeNode node) {
     }
     ptr->setRight(node);
     node->setParent(ptr);
+    this->updateNode(node);
+    this->updateNode(ptr);
 }
 
@@ -0,0 +1,146 @@
+/**
+ * @file SetOperations.inl
+ * @brief This file contains the implementation of the SetOperations class
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include "SetOperations.hpp"
+
+template <typename Tree, typename Node, typename Rank>
+Tree SetOperations<Tree, Node, Rank>::unite(Tree&& first, Tree&& second, ThreadPool* pool) {
+    return apply(std::move(first), std::move(second), pool, Operation::UNION);
+}
+
+template <typename Tree, typename Node, typename Rank>
+Tree SetOperations<Tree, Node, Rank>::intersect(Tree&& first, Tree&& second, ThreadPool* pool) {
+    return apply(std::move(first), std::move(second), pool, Operation::INTERSECTION);
+}
+
+template <typename Tree, typename Node, typename Rank>
+Tree SetOperations<Tree, Node, Rank>::subtract(Tree&& first, Tree&& second, ThreadPool* pool) {
+    return apply(std::move(first), std::move(second), pool, Operation::DIFFERENCE);
+}
+
+template <typename Tree, typename Node, typename Rank>
+Tree SetOperations<Tree, Node, Rank>::apply(Tree&& first, Tree&& second, ThreadPool* pool, Operation operation) {
+    first.requireSameAllocator(second); // the nodes of second are freed by the allocator of first
+    Tree result(std::move(first));
+    Node* nil = static_cast<Node*>(result.nullValue);
+    Node* firstRoot = result.getRoot();
+    Node* secondRoot = second.getRoot();
+    Rank firstRank = result.subtreeRank(firstRoot);
+    Rank secondRank = second.subtreeRank(secondRoot);
+    result.takeNodes(second);
+
+    Context context{operation, pool, 0};
+    if (pool != nullptr) { // about 8 tasks per worker, to even out the unbalanced splits
+        while ((1u << context.parallelDepth) < 8 * pool->getNumOfThreads()) {
+            ++context.parallelDepth;
+        }
+    }
+    std::vector<Node*> dropped;
+    Rank rank{0};
+    Node* root = combine(result, firstRoot, firstRank, secondRoot, secondRank, rank, context, 0, dropped);
+    result.root = root;
+    if (root != nil) {
+        root->setParent(nil);
+    }
+    for (typename std::vector<Node*>::const_iterator node = dropped.begin(); node != dropped.end(); ++node) {
+        result.destroyNode(*node);
+    }
+    result.countStale = true;
+    return result;
+}
+
+// combine the subtrees first and second in the workspace (a tree whose root is scratch space for the joins),
+// returning the root of the result and its rank; the nodes to free are appended to dropped
+template <typename Tree, typename Node, typename Rank>
+Node* SetOperations<Tree, Node, Rank>::combine(Tree& workspace, Node* first, Rank firstRank, Node* second, Rank secondRank, Rank& rank, const Context& context, unsigned int depth, std::vector<Node*>& dropped) {
+    Node* nil = static_cast<Node*>(workspace.nullValue);
+    if (first == nil || second == nil) {
+        switch (context.operation) {
+            case Operation::UNION:
+                rank = (first == nil) ? secondRank : firstRank;
+                return (first == nil) ? second : first;
+            case Operation::INTERSECTION:
+                collect(first, nil, dropped);
+                collect(second, nil, dropped);
+                rank = 0;
+                return nil;
+            default:
+                collect(second, nil, dropped);
+                rank = firstRank;
+                return first;
+        }
+    }
+    Node* secondLeft = nil;
+    Node* secondRight = nil;
+    Rank secondLeftRank{0};
+    Rank secondRightRank{0};
+    workspace.expose(second, secondRank, secondLeft, secondLeftRank, secondRight, secondRightRank);
+    Node* firstLeft = nil;
+    Node* firstRight = nil;
+    Node* found = nil;
+    Rank firstLeftRank{0};
+    Rank firstRightRank{0};
+    workspace.splitSubtree(first, firstRank, second->getKey(), firstLeft, firstLeftRank, firstRight, firstRightRank, &found);
+
+    Node* left = nil;
+    Node* right = nil;
+    Rank leftRank{0};
+    Rank rightRank{0};
+    if (context.pool != nullptr && depth < context.parallelDepth) {
+        Tree rightWorkspace = workspace.workspace();
+        std::vector<Node*> rightDropped;
+        ThreadPool::TaskHandle task = context.pool->submit([&]() {
+            right = combine(rightWorkspace, firstRight, firstRightRank, secondRight, secondRightRank, rightRank, context, depth + 1, rightDropped);
+        });
+        left = combine(workspace, firstLeft, firstLeftRank, secondLeft, secondLeftRank, leftRank, context, depth + 1, dropped);
+        context.pool->wait(task);
+        rightWorkspace.root = rightWorkspace.nullValue; // the nodes belong to the result
+        rightWorkspace.numOfNodes = 0;
+        dropped.insert(dropped.end(), rightDropped.begin(), rightDropped.end());
+    } else {
+        left = combine(workspace, firstLeft, firstLeftRank, secondLeft, secondLeftRank, leftRank, context, depth + 1, dropped);
+        right = combine(workspace, firstRight, firstRightRank, secondRight, secondRightRank, rightRank, context, depth + 1, dropped);
+    }
+
+    if (context.operation == Operation::UNION) {
+        Node* pivot = second;
+        if (found != nil) { // the key is in both trees, keep the node of the first one
+            dropped.push_back(second);
+            pivot = found;
+        }
+        return workspace.joinSubtrees(left, leftRank, pivot, right, rightRank, rank);
+    }
+    dropped.push_back(second);
+    if (context.operation == Operation::INTERSECTION && found != nil) {
+        return workspace.joinSubtrees(left, leftRank, found, right, rightRank, rank);
+    }
+    if (found != nil) {
+        dropped.push_back(found);
+    }
+    return workspace.join2Subtrees(left, leftRank, right, rightRank, rank);
+}
+
+// append every node of a subtree, without following the parent links
+template <typename Tree, typename Node, typename Rank>
+void SetOperations<Tree, Node, Rank>::collect(Node* node, Node* nil, std::vector<Node*>& dropped) {
+    if (node == nil) {
+        return;
+    }
+    std::size_t next = dropped.size();
+    dropped.push_back(node);
+    for (; next < dropped.size(); ++next) {
+        if (dropped[next]->getLeft() != nil) {
+            dropped.push_back(dropped[next]->getLeft());
+        }
+        if (dropped[next]->getRight() != nil) {
+            dropped.push_back(dropped[next]->getRight());
+        }
+    }
+}
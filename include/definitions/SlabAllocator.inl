@@ -0,0 +1,51 @@
+/**
+ * @file SlabAllocator.inl
+ * @brief This file contains the implementation of the SlabAllocator class
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include <new>
+#include "SlabAllocator.hpp"
+
+// constructors
+template <typename T>
+SlabAllocator<T>::SlabAllocator() : arena{std::make_shared<SlabArena>()} {}
+
+template <typename T>
+template <typename U>
+SlabAllocator<T>::SlabAllocator(const SlabAllocator<U>& other) : arena{other.arena} {}
+
+// core functionalities
+template <typename T>
+T* SlabAllocator<T>::allocate(std::size_t n) {
+    if (n != 1) {
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+    return static_cast<T*>(arena->allocate(sizeof(T)));
+}
+
+template <typename T>
+void SlabAllocator<T>::deallocate(T* ptr, std::size_t n) {
+    if (n != 1) {
+        ::operator delete(ptr);
+        return;
+    }
+    arena->deallocate(ptr, sizeof(T));
+}
+
+// operators
+template <typename T>
+template <typename U>
+bool SlabAllocator<T>::operator==(const SlabAllocator<U>& other) const {
+    return arena == other.arena;
+}
+
+template <typename T>
+template <typename U>
+bool SlabAllocator<T>::operator!=(const SlabAllocator<U>& other) const {
+    return arena != other.arena;
+}
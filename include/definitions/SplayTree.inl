@@ -0,0 +1,307 @@
+/**
+ * @file SplayTree.inl
+
+ * @brief This file contains the implementation of the SplayTree class
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include "SplayTree.hpp"
+
+// constuctor and destructor
+template <typename Key, typename Value, typename Compare, typename Alloc>
+SplayTree<Key, Value, Compare, Alloc>::SplayTree(const Compare& comp, const Alloc& alloc)
+: SelfBalancingTree<Key, Value, Compare, Alloc, TreeNode<Key, Value>>{comp, alloc} {}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+SplayTree<Key, Value, Compare, Alloc>::~SplayTree() = default;
+
+// splaying
+// top-down splay: the nodes passed on the way down are hung on a left tree (keys less than key) and a right
+// tree (keys greater), two at a time with a rotation when the path goes the same way twice; at the end the
+// last node of the search becomes the root with the two trees as subtrees. Every link keeps its parent
+// link, so the rotations of SelfBalancingTree work on the partial trees as well
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void SplayTree<Key, Value, Compare, Alloc>::splay(const Key& key) {
+    ptr_TreeNode<Key, Value> node = this->root;
+    if (node == nullptr) {
+        return;
+    }
+    ptr_TreeNode<Key, Value> leftRoot = nullptr;
+    ptr_TreeNode<Key, Value> leftMax = nullptr; // where the next node of the left tree is hung (right child)
+    ptr_TreeNode<Key, Value> rightRoot = nullptr;
+    ptr_TreeNode<Key, Value> rightMin = nullptr; // where the next node of the right tree is hung (left child)
+    while (true) {
+        if (this->comp(key, node->getKey())) {
+            if (node->getLeft() == nullptr) {
+                break;
+            }
+            if (this->comp(key, node->getLeft()->getKey())) { // zig-zig
+                ptr_TreeNode<Key, Value> left = node->getLeft();
+                this->rotateRight(node);
+                node = left;
+                if (node->getLeft() == nullptr) {
+                    break;
+                }
+            }
+            if (rightMin == nullptr) { // link right
+                rightRoot = node;
+            } else {
+                rightMin->setLeft(node);
+            }
+            node->setParent(rightMin);
+            rightMin = node;
+            node = node->getLeft();
+        } else if (this->comp(node->getKey(), key)) {
+            if (node->getRight() == nullptr) {
+                break;
+            }
+            if (this->comp(node->getRight()->getKey(), key)) { // zig-zig
+                ptr_TreeNode<Key, Value> right = node->getRight();
+                this->rotateLeft(node);
+                node = right;
+                if (node->getRight() == nullptr) {
+                    break;
+                }
+            }
+            if (leftMax == nullptr) { // link left
+                leftRoot = node;
+            } else {
+                leftMax->setRight(node);
+            }
+            node->setParent(leftMax);
+            leftMax = node;
+            node = node->getRight();
+        } else {
+            break;
+        }
+    }
+    // assemble: the subtrees of node close the two trees, which become its subtrees
+    if (leftMax == nullptr) {
+        leftRoot = node->getLeft();
+    } else {
+        leftMax->setRight(node->getLeft());
+        if (node->getLeft() != nullptr) {
+            node->getLeft()->setParent(leftMax);
+        }
+    }
+    if (rightMin == nullptr) {
+        rightRoot = node->getRight();
+    } else {
+        rightMin->setLeft(node->getRight());
+        if (node->getRight() != nullptr) {
+            node->getRight()->setParent(rightMin);
+        }
+    }
+    node->setLeft(leftRoot);
+    node->setRight(rightRoot);
+    if (leftRoot != nullptr) {
+        leftRoot->setParent(node);
+    }
+    if (rightRoot != nullptr) {
+        rightRoot->setParent(node);
+    }
+    node->setParent(nullptr);
+    this->root = node;
+}
+
+// bottom-up splay of a given node with the zig, zig-zig and zig-zag rotations, for a node already found
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void SplayTree<Key, Value, Compare, Alloc>::splayNode(ptr_TreeNode<Key, Value> node) {
+    while (node->getParent() != nullptr) {
+        ptr_TreeNode<Key, Value> parent = node->getParent();
+        ptr_TreeNode<Key, Value> grandparent = parent->getParent();
+        bool isLeft = node == parent->getLeft();
+        if (grandparent == nullptr) { // zig
+            isLeft ? this->rotateRight(parent) : this->rotateLeft(parent);
+        } else if (isLeft == (parent == grandparent->getLeft())) { // zig-zig
+            isLeft ? this->rotateRight(grandparent) : this->rotateLeft(grandparent);
+            isLeft ? this->rotateRight(parent) : this->rotateLeft(parent);
+        } else { // zig-zag
+            isLeft ? this->rotateRight(parent) : this->rotateLeft(parent);
+            isLeft ? this->rotateLeft(grandparent) : this->rotateRight(grandparent);
+        }
+    }
+}
+
+// core functions
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void SplayTree<Key, Value, Compare, Alloc>::insert(const Key& key, const Value& value) {
+    emplace(key, value);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void SplayTree<Key, Value, Compare, Alloc>::insert(const Key& key, Value&& value) {
+    emplace(key, std::move(value));
+}
+
+// splay the key, then split the tree between the new root and the root found, equal keys go to the left
+template <typename Key, typename Value, typename Compare, typename Alloc>
+template <typename... Args>
+ptr_TreeNode<Key, Value> SplayTree<Key, Value, Compare, Alloc>::emplace(const Key& key, Args&&... args) {
+    ptr_TreeNode<Key, Value> node = this->createNode(key, std::forward<Args>(args)...);
+    splay(key);
+    ptr_TreeNode<Key, Value> root = this->root;
+    if (root != nullptr) {
+        if (this->comp(key, root->getKey())) {
+            node->setLeft(root->getLeft());
+            node->setRight(root);
+            root->setLeft(nullptr);
+        } else {
+            node->setRight(root->getRight());
+            node->setLeft(root);
+            root->setRight(nullptr);
+        }
+        if (node->getLeft() != nullptr) {
+            node->getLeft()->setParent(node);
+        }
+        if (node->getRight() != nullptr) {
+            node->getRight()->setParent(node);
+        }
+    }
+    this->root = node;
+    this->resetFinger(); // the neighbours of the finger of BinarySearchTree::insert may have changed
+    ++(this->numOfNodes);
+    return node;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void SplayTree<Key, Value, Compare, Alloc>::insert(TreeNodeObject* obj) {
+    emplace(obj->getKey(), this->shareObject(obj));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+template <typename... Args>
+ptr_TreeNode<Key, Value> SplayTree<Key, Value, Compare, Alloc>::emplaceHint(ptr_TreeNode<Key, Value> hint, const Key& key, Args&&... args) {
+    ptr_TreeNode<Key, Value> node = this->createNode(key, std::forward<Args>(args)...);
+    this->insertNear(hint, node);
+    splayNode(node);
+    this->resetFinger(); // the splay moved the neighbours of the finger set by insertNear
+    return node;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+ptr_TreeNode<Key, Value> SplayTree<Key, Value, Compare, Alloc>::insert(ptr_TreeNode<Key, Value> hint, TreeNodeObject* obj) {
+    return emplaceHint(hint, obj->getKey(), this->shareObject(obj));
+}
+
+// BinarySearchTree::insertBatch links the small batches without splaying
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void SplayTree<Key, Value, Compare, Alloc>::insertBatch(std::vector<std::pair<Key, Value>> batch) {
+    if (this->mergeBatch(batch, BinarySearchTree<Key, Value, Compare, Alloc>::keepShape)) {
+        return;
+    }
+    ptr_TreeNode<Key, Value> hint = nullptr;
+    for (typename std::vector<std::pair<Key, Value>>::iterator it = batch.begin(); it != batch.end(); ++it) {
+        hint = emplaceHint(hint, it->first, std::move(it->second));
+    }
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void SplayTree<Key, Value, Compare, Alloc>::insertBatch(const std::vector<TreeNodeObject*>& objects) {
+    std::vector<std::pair<Key, Value>> batch;
+    batch.reserve(objects.size());
+    for (TreeNodeObject* obj : objects) {
+        batch.emplace_back(obj->getKey(), this->shareObject(obj));
+    }
+    insertBatch(std::move(batch));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+ptr_TreeNode<Key, Value> SplayTree<Key, Value, Compare, Alloc>::search(const Key& key) {
+    splay(key);
+    ptr_TreeNode<Key, Value> root = this->root;
+    if (root == nullptr || this->comp(key, root->getKey()) || this->comp(root->getKey(), key)) {
+        return nullptr;
+    }
+    return root;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void SplayTree<Key, Value, Compare, Alloc>::remove(ptr_TreeNode<Key, Value> node) {
+    splayNode(node);
+    removeRoot();
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+bool SplayTree<Key, Value, Compare, Alloc>::erase(const Key& key) {
+    if (search(key) == nullptr) {
+        return false;
+    }
+    removeRoot();
+    return true;
+}
+
+// with the first node of the range at the root, its left subtree (the keys less than lo) is set aside and the
+// first node past the range is splayed up: its left subtree is then the range
+template <typename Key, typename Value, typename Compare, typename Alloc>
+unsigned int SplayTree<Key, Value, Compare, Alloc>::eraseRange(const Key& lo, const Key& hi) {
+    if (this->comp(hi, lo)) {
+        return 0;
+    }
+    ptr_TreeNode<Key, Value> first = this->lower_bound(lo).getNode();
+    if (first == nullptr || this->comp(hi, first->getKey())) {
+        return 0;
+    }
+    splayNode(first);
+    ptr_TreeNode<Key, Value> left = first->getLeft();
+    first->setLeft(nullptr);
+    ptr_TreeNode<Key, Value> past = this->upper_bound(hi).getNode();
+    unsigned int count{0};
+    if (past == nullptr) {
+        count = this->destroySubtree(first);
+        this->root = left;
+        if (left != nullptr) {
+            left->setParent(nullptr);
+        }
+    } else {
+        splayNode(past);
+        count = this->destroySubtree(past->getLeft());
+        past->setLeft(left);
+        if (left != nullptr) {
+            left->setParent(past);
+        }
+    }
+    if (!this->countStale) {
+        this->numOfNodes -= count;
+    }
+    return count;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void SplayTree<Key, Value, Compare, Alloc>::removeBatch(std::vector<Key> keys) {
+    if (this->mergeRemoveBatch(keys, BinarySearchTree<Key, Value, Compare, Alloc>::keepShape)) {
+        return;
+    }
+    for (typename std::vector<Key>::const_iterator key = keys.begin(); key != keys.end(); ++key) {
+        erase(*key);
+    }
+}
+
+// free the root, the maximum of the left subtree is splayed up and takes the right subtree
+template <typename Key, typename Value, typename Compare, typename Alloc>
+void SplayTree<Key, Value, Compare, Alloc>::removeRoot() {
+    ptr_TreeNode<Key, Value> node = this->root;
+    ptr_TreeNode<Key, Value> left = node->getLeft();
+    ptr_TreeNode<Key, Value> right = node->getRight();
+    this->forgetNode(node);
+    if (left == nullptr) {
+        this->root = right;
+        if (right != nullptr) {
+            right->setParent(nullptr);
+        }
+    } else {
+        left->setParent(nullptr);
+        this->root = left;
+        splayNode(this->maximum(left));
+        this->root->setRight(right);
+        if (right != nullptr) {
+            right->setParent(this->root);
+        }
+    }
+    --(this->numOfNodes);
+    this->destroyNode(node);
+}
@@ -0,0 +1,385 @@
+/**
+ * @file Treap.inl
+
+ * @brief This file contains the implementation of the Treap class
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include "Treap.hpp"
+
+// constuctor and destructor
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+Treap<Key, Value, Compare, Alloc, Augment>::Treap(const Compare& comp, const Alloc& alloc)
+: SelfBalancingTree<Key, Value, Compare, Alloc, TreapNode<Key, Value, Augment>>{comp, alloc} {}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+Treap<Key, Value, Compare, Alloc, Augment>::~Treap() = default;
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+template <typename Iterator>
+Treap<Key, Value, Compare, Alloc, Augment> Treap<Key, Value, Compare, Alloc, Augment>::buildFromSorted(Iterator first, Iterator last, const Compare& comp, const Alloc& alloc) {
+    Treap tree(comp, alloc);
+    tree.root = tree.linkSorted(first, last);
+    return tree;
+}
+
+// the right spine holds the nodes still waiting for a right child: a new node, the greatest key so far, takes as
+// left child the part of the spine with lower priority; a node leaving the spine has its final subtree. The
+// values are taken with *it, so a move iterator moves them into the nodes
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+template <typename Iterator>
+ptr_TreapNode<Key, Value, Augment> Treap<Key, Value, Compare, Alloc, Augment>::linkSorted(Iterator first, Iterator last) {
+    ptr_TreapNode<Key, Value, Augment> root = nullptr;
+    ptr_TreapNode<Key, Value, Augment> spine = nullptr;
+    for (Iterator it = first; it != last; ++it) {
+        ptr_TreapNode<Key, Value, Augment> node = this->createNode((*it).first, (*it).second);
+        node->setPriority(nextPriority());
+        ptr_TreapNode<Key, Value, Augment> child = nullptr;
+        while (spine != nullptr && spine->getPriority() < node->getPriority()) {
+            this->updateNode(spine);
+            child = spine;
+            spine = spine->getParent();
+        }
+        node->setLeft(child);
+        if (child != nullptr) {
+            child->setParent(node);
+        }
+        node->setParent(spine);
+        if (spine == nullptr) {
+            root = node;
+        } else {
+            spine->setRight(node);
+        }
+        spine = node;
+        ++(this->numOfNodes);
+    }
+    for (; spine != nullptr; spine = spine->getParent()) {
+        this->updateNode(spine);
+    }
+    return root;
+}
+
+// getters
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+ptr_TreapNode<Key, Value, Augment> Treap<Key, Value, Compare, Alloc, Augment>::getRoot() const {
+    return static_cast<ptr_TreapNode<Key, Value, Augment>>(this->root);
+}
+
+// one draw from the entropy source per process, spread over the trees by a counter and mixed (murmur3 finalizer),
+// so that every tree has its own sequence; xorshift32 must not start from 0
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+std::uint32_t Treap<Key, Value, Compare, Alloc, Augment>::randomSeed() {
+    static const std::uint32_t entropy = std::random_device()();
+    static std::atomic<std::uint32_t> counter{0};
+    std::uint32_t state = entropy + 0x9E3779B9u * ++counter;
+    state ^= state >> 16;
+    state *= 0x85EBCA6Bu;
+    state ^= state >> 13;
+    state *= 0xC2B2AE35u;
+    state ^= state >> 16;
+    return (state == 0) ? 2463534242u : state;
+}
+
+// xorshift32, the priorities only need to be independent of the keys
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+inline unsigned int Treap<Key, Value, Compare, Alloc, Augment>::nextPriority() {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+// core functions
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void Treap<Key, Value, Compare, Alloc, Augment>::insert(ptr_TreapNode<Key, Value, Augment> node) {
+    node->setPriority(nextPriority());
+    BinarySearchTree<Key, Value, Compare, Alloc, TreapNode<Key, Value, Augment>>::insert(node);
+    fixAfterInsert(node);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void Treap<Key, Value, Compare, Alloc, Augment>::insert(const Key& key, const Value& value) {
+    emplace(key, value);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void Treap<Key, Value, Compare, Alloc, Augment>::insert(const Key& key, Value&& value) {
+    emplace(key, std::move(value));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+template <typename... Args>
+ptr_TreapNode<Key, Value, Augment> Treap<Key, Value, Compare, Alloc, Augment>::emplace(const Key& key, Args&&... args) {
+    ptr_TreapNode<Key, Value, Augment> node = this->createNode(key, std::forward<Args>(args)...);
+    insert(node);
+    return node;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void Treap<Key, Value, Compare, Alloc, Augment>::insert(TreeNodeObject* obj) {
+    emplace(obj->getKey(), this->shareObject(obj));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+template <typename... Args>
+ptr_TreapNode<Key, Value, Augment> Treap<Key, Value, Compare, Alloc, Augment>::emplaceHint(ptr_TreapNode<Key, Value, Augment> hint, const Key& key, Args&&... args) {
+    ptr_TreapNode<Key, Value, Augment> node = this->createNode(key, std::forward<Args>(args)...);
+    node->setPriority(nextPriority());
+    this->insertNear(hint, node);
+    fixAfterInsert(node);
+    return node;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+ptr_TreapNode<Key, Value, Augment> Treap<Key, Value, Compare, Alloc, Augment>::insert(ptr_TreapNode<Key, Value, Augment> hint, TreeNodeObject* obj) {
+    return emplaceHint(hint, obj->getKey(), this->shareObject(obj));
+}
+
+// the sorted batch is linked into a treap of its own in O(k) and united with the tree
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void Treap<Key, Value, Compare, Alloc, Augment>::insertBatch(std::vector<std::pair<Key, Value>> batch) {
+    if (batch.empty()) {
+        return;
+    }
+    this->sortBatch(batch);
+    this->resetFinger();
+    this->root = uniteSubtrees(getRoot(), linkSorted(std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end())));
+    this->root->setParent(nullptr);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void Treap<Key, Value, Compare, Alloc, Augment>::insertBatch(const std::vector<TreeNodeObject*>& objects) {
+    std::vector<std::pair<Key, Value>> batch;
+    batch.reserve(objects.size());
+    for (TreeNodeObject* obj : objects) {
+        batch.emplace_back(obj->getKey(), this->shareObject(obj));
+    }
+    insertBatch(std::move(batch));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+ptr_TreapNode<Key, Value, Augment> Treap<Key, Value, Compare, Alloc, Augment>::search(const Key& key) const {
+    return static_cast<ptr_TreapNode<Key, Value, Augment>>(BinarySearchTree<Key, Value, Compare, Alloc, TreapNode<Key, Value, Augment>>::search(key));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+ptr_TreapNode<Key, Value, Augment> Treap<Key, Value, Compare, Alloc, Augment>::select(unsigned int index) const {
+    return static_cast<ptr_TreapNode<Key, Value, Augment>>(BinarySearchTree<Key, Value, Compare, Alloc, TreapNode<Key, Value, Augment>>::select(index));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void Treap<Key, Value, Compare, Alloc, Augment>::remove(ptr_TreapNode<Key, Value, Augment> node) {
+    detach(node);
+    this->destroyNode(node);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+bool Treap<Key, Value, Compare, Alloc, Augment>::erase(const Key& key) {
+    ptr_TreapNode<Key, Value, Augment> node = search(key);
+    if (node == nullptr) {
+        return false;
+    }
+    remove(node);
+    return true;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+unsigned int Treap<Key, Value, Compare, Alloc, Augment>::eraseRange(const Key& lo, const Key& hi) {
+    if (this->comp(hi, lo) || this->isEmpty()) {
+        return 0;
+    }
+    ptr_TreapNode<Key, Value, Augment> left = nullptr;
+    ptr_TreapNode<Key, Value, Augment> rest = nullptr;
+    ptr_TreapNode<Key, Value, Augment> middle = nullptr;
+    ptr_TreapNode<Key, Value, Augment> right = nullptr;
+    splitSubtree(getRoot(), lo, false, left, rest);
+    splitSubtree(rest, hi, true, middle, right);
+    unsigned int count = this->destroySubtree(middle);
+    this->root = joinSubtrees(left, right);
+    if (!this->countStale) {
+        this->numOfNodes -= count;
+    }
+    return count;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void Treap<Key, Value, Compare, Alloc, Augment>::removeBatch(std::vector<Key> keys) {
+    for (typename std::vector<Key>::const_iterator key = keys.begin(); key != keys.end(); ++key) {
+        erase(*key);
+    }
+}
+
+// fixers
+// rotate the new node up while its priority is higher than the one of its parent
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void Treap<Key, Value, Compare, Alloc, Augment>::fixAfterInsert(ptr_TreapNode<Key, Value, Augment> node) {
+    for (ptr_TreapNode<Key, Value, Augment> parent = node->getParent(); parent != nullptr && parent->getPriority() < node->getPriority(); parent = node->getParent()) {
+        if (node == parent->getLeft()) {
+            this->rotateRight(parent);
+        } else {
+            this->rotateLeft(parent);
+        }
+    }
+}
+
+// rotate the node down, under its child of higher priority, until it has at most one child and can be unlinked
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void Treap<Key, Value, Compare, Alloc, Augment>::detach(ptr_TreapNode<Key, Value, Augment> node) {
+    while (node->getLeft() != nullptr && node->getRight() != nullptr) {
+        if (node->getLeft()->getPriority() > node->getRight()->getPriority()) {
+            this->rotateRight(node);
+        } else {
+            this->rotateLeft(node);
+        }
+    }
+    this->unlink(node);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+Treap<Key, Value, Compare, Alloc, Augment> Treap<Key, Value, Compare, Alloc, Augment>::join(Treap&& left, Treap&& right) {
+    left.requireSameAllocator(right);
+    Treap tree(std::move(left));
+    ptr_TreapNode<Key, Value, Augment> leftRoot = tree.getRoot();
+    ptr_TreapNode<Key, Value, Augment> rightRoot = right.getRoot();
+    tree.takeNodes(right);
+    tree.root = tree.joinSubtrees(leftRoot, rightRoot);
+    return tree;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+std::pair<Treap<Key, Value, Compare, Alloc, Augment>, Treap<Key, Value, Compare, Alloc, Augment>> Treap<Key, Value, Compare, Alloc, Augment>::split(const Key& key) {
+    ptr_TreapNode<Key, Value, Augment> leftRoot = nullptr;
+    ptr_TreapNode<Key, Value, Augment> rightRoot = nullptr;
+    splitSubtree(getRoot(), key, false, leftRoot, rightRoot);
+
+    std::pair<Treap, Treap> halves(Treap(this->comp, Alloc(this->nodeAllocator)), Treap(this->comp, Alloc(this->nodeAllocator)));
+    halves.first.root = leftRoot;
+    halves.second.root = rightRoot;
+    halves.first.seed = nextPriority();
+    halves.second.seed = nextPriority();
+    halves.first.countStale = halves.second.countStale = true;
+    halves.first.blocks = this->blocks;
+    halves.second.blocks = std::move(this->blocks);
+    this->blocks.clear();
+    this->resetFinger();
+    this->root = this->nullValue;
+    this->numOfNodes = 0;
+    this->countStale = false;
+    return halves;
+}
+
+// split and join
+// cut the subtree of node into the nodes with key less than key (not greater, with orEqual) and the others: the
+// nodes on the search path are hung on the two sides in the order they are met, which keeps the heap order
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void Treap<Key, Value, Compare, Alloc, Augment>::splitSubtree(ptr_TreapNode<Key, Value, Augment> node, const Key& key, bool orEqual, ptr_TreapNode<Key, Value, Augment>& left, ptr_TreapNode<Key, Value, Augment>& right) {
+    ptr_TreapNode<Key, Value, Augment> leftLast = nullptr; // the greatest node of left, waiting for a right child
+    ptr_TreapNode<Key, Value, Augment> rightLast = nullptr; // the smallest node of right, waiting for a left child
+    left = nullptr;
+    right = nullptr;
+    while (node != nullptr) {
+        if (orEqual ? !this->comp(key, node->getKey()) : this->comp(node->getKey(), key)) {
+            if (leftLast == nullptr) {
+                left = node;
+            } else {
+                leftLast->setRight(node);
+            }
+            node->setParent(leftLast);
+            leftLast = node;
+            node = node->getRight();
+        } else {
+            if (rightLast == nullptr) {
+                right = node;
+            } else {
+                rightLast->setLeft(node);
+            }
+            node->setParent(rightLast);
+            rightLast = node;
+            node = node->getLeft();
+        }
+    }
+    if (leftLast != nullptr) {
+        leftLast->setRight(nullptr);
+        this->updatePath(leftLast);
+    }
+    if (rightLast != nullptr) {
+        rightLast->setLeft(nullptr);
+        this->updatePath(rightLast);
+    }
+}
+
+// unite the nodes of two subtrees: the root of higher priority stays on top and splits the other subtree at its
+// key, the two sides are united with its children. The keys of added equal to one of node go after it, as if
+// inserted later; O(m log(n/m + 1)) expected for subtrees of m <= n nodes
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+ptr_TreapNode<Key, Value, Augment> Treap<Key, Value, Compare, Alloc, Augment>::uniteSubtrees(ptr_TreapNode<Key, Value, Augment> node, ptr_TreapNode<Key, Value, Augment> added) {
+    if (node == nullptr || added == nullptr) {
+        return (node != nullptr) ? node : added;
+    }
+    ptr_TreapNode<Key, Value, Augment> left = nullptr;
+    ptr_TreapNode<Key, Value, Augment> right = nullptr;
+    ptr_TreapNode<Key, Value, Augment> top = node;
+    if (node->getPriority() >= added->getPriority()) {
+        splitSubtree(added, node->getKey(), false, left, right);
+        left = uniteSubtrees(node->getLeft(), left);
+        right = uniteSubtrees(node->getRight(), right);
+    } else {
+        top = added;
+        splitSubtree(node, added->getKey(), true, left, right);
+        left = uniteSubtrees(left, added->getLeft());
+        right = uniteSubtrees(right, added->getRight());
+    }
+    top->setLeft(left);
+    top->setRight(right);
+    if (left != nullptr) {
+        left->setParent(top);
+    }
+    if (right != nullptr) {
+        right->setParent(top);
+    }
+    this->updateNode(top);
+    return top;
+}
+
+// join two subtrees, every key of left not greater than the ones of right: the right spine of left and the left
+// spine of right are merged by priority, the rest of the subtrees stays in place
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+ptr_TreapNode<Key, Value, Augment> Treap<Key, Value, Compare, Alloc, Augment>::joinSubtrees(ptr_TreapNode<Key, Value, Augment> left, ptr_TreapNode<Key, Value, Augment> right) {
+    ptr_TreapNode<Key, Value, Augment> root = nullptr;
+    ptr_TreapNode<Key, Value, Augment> parent = nullptr; // the last node merged
+    bool fromRight = false; // parent comes from right, the next node is its left child
+    while (true) {
+        ptr_TreapNode<Key, Value, Augment> top;
+        if (left == nullptr || right == nullptr) {
+            top = (left != nullptr) ? left : right;
+        } else {
+            top = (left->getPriority() >= right->getPriority()) ? left : right;
+        }
+        if (parent == nullptr) {
+            root = top;
+        } else if (fromRight) {
+            parent->setLeft(top);
+        } else {
+            parent->setRight(top);
+        }
+        if (top != nullptr) {
+            top->setParent(parent);
+        }
+        if (left == nullptr || right == nullptr) {
+            break;
+        }
+        fromRight = top == right;
+        if (fromRight) {
+            right = right->getLeft();
+        } else {
+            left = left->getRight();
+        }
+        parent = top;
+    }
+    this->updatePath(parent);
+    return root;
+}
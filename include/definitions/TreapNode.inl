@@ -0,0 +1,43 @@
+/**
+ * @file TreapNode.inl
+ * @brief This class implements TreapNode
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include "TreapNode.hpp"
+
+// constructor
+template <typename Key, typename Value, typename Augment>
+template <typename... Args>
+TreapNode<Key, Value, Augment>::TreapNode(const Key& key, Args&&... args) : TreeNode<Key, Value>(key, std::forward<Args>(args)...) {}
+
+// getters
+template <typename Key, typename Value, typename Augment>
+TreapNode<Key, Value, Augment>* TreapNode<Key, Value, Augment>::getLeft() const {
+    return static_cast<TreapNode*>(this->left);
+}
+
+template <typename Key, typename Value, typename Augment>
+TreapNode<Key, Value, Augment>* TreapNode<Key, Value, Augment>::getRight() const {
+    return static_cast<TreapNode*>(this->right);
+}
+
+template <typename Key, typename Value, typename Augment>
+TreapNode<Key, Value, Augment>* TreapNode<Key, Value, Augment>::getParent() const {
+    return static_cast<TreapNode*>(TreeNode<Key, Value>::getParent());
+}
+
+template <typename Key, typename Value, typename Augment>
+unsigned int TreapNode<Key, Value, Augment>::getPriority() const {
+    return priority;
+}
+
+// setters
+template <typename Key, typename Value, typename Augment>
+void TreapNode<Key, Value, Augment>::setPriority(unsigned int priority) {
+    this->priority = priority;
+}
@@ -0,0 +1,51 @@
+/**
+ * @file TreeNode.inl
+ * @brief This file contains the implementation of the TreeNode class
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include "TreeNode.hpp"
+
+// constructor and destructor
+template <typename Key, typename Value>
+template <typename... Args>
+TreeNode<Key, Value>::TreeNode(const Key& key, Args&&... args) : key(key), value(std::forward<Args>(args)...) {
+    static_assert(alignof(TreeNode) > TAG_MASK, "the tag bits of the parent link must be free");
+}
+
+template <typename Key, typename Value>
+TreeNode<Key, Value>::~TreeNode() = default;
+
+// getters
+template <typename Key, typename Value>
+const Value& TreeNode<Key, Value>::getValue() const { return value; }
+template <typename Key, typename Value>
+Value& TreeNode<Key, Value>::getValue() { return value; }
+template <typename Key, typename Value>
+TreeNode<Key, Value>* TreeNode<Key, Value>::getLeft() const { return left; }
+template <typename Key, typename Value>
+TreeNode<Key, Value>* TreeNode<Key, Value>::getRight() const { return right; }
+template <typename Key, typename Value>
+TreeNode<Key, Value>* TreeNode<Key, Value>::getParent() const { return reinterpret_cast<TreeNode*>(parent & ~TAG_MASK); }
+
+// setters
+template <typename Key, typename Value>
+void TreeNode<Key, Value>::setValue(const Value& value) { this->value = value; }
+template <typename Key, typename Value>
+void TreeNode<Key, Value>::setLeft(TreeNode* left) { this->left = left; }
+template <typename Key, typename Value>
+void TreeNode<Key, Value>::setRight(TreeNode* right) { this->right = right; }
+template <typename Key, typename Value>
+void TreeNode<Key, Value>::setParent(TreeNode* parent) {
+    this->parent = reinterpret_cast<std::uintptr_t>(parent) | (this->parent & TAG_MASK);
+}
+
+// operators
+template <typename Key, typename Value>
+std::ostream& operator<<(std::ostream &s, const TreeNode<Key, Value> &node) {
+    return s << node.getKey();
+}
@@ -0,0 +1,279 @@
+/**
+ * @file WAVLTree.inl
+
+ * @brief This file contains the implementation of the WAVLTree class
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include "WAVLTree.hpp"
+
+// constuctor and destructor
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+WAVLTree<Key, Value, Compare, Alloc, Augment>::WAVLTree(const Compare& comp, const Alloc& alloc)
+: SelfBalancingTree<Key, Value, Compare, Alloc, WAVLTreeNode<Key, Value, Augment>>{comp, alloc} {}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+WAVLTree<Key, Value, Compare, Alloc, Augment>::~WAVLTree() = default;
+
+// getters
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+ptr_WAVLTreeNode<Key, Value, Augment> WAVLTree<Key, Value, Compare, Alloc, Augment>::getRoot() const {
+    return static_cast<ptr_WAVLTreeNode<Key, Value, Augment>>(this->root);
+}
+
+// a missing child has rank -1
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+unsigned WAVLTree<Key, Value, Compare, Alloc, Augment>::rankParity(ptr_WAVLTreeNode<Key, Value, Augment> node) {
+    return (node == nullptr) ? 1 : node->getRankParity();
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+bool WAVLTree<Key, Value, Compare, Alloc, Augment>::isLeaf(ptr_WAVLTreeNode<Key, Value, Augment> node) {
+    return node->getLeft() == nullptr && node->getRight() == nullptr;
+}
+
+// in a perfectly balanced tree the siblings differ in height by at most one, so rank = height - 1 (a leaf has
+// rank 0) gives every child a rank difference of 1 or 2
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void WAVLTree<Key, Value, Compare, Alloc, Augment>::annotateBalanced(WAVLTreeNode<Key, Value, Augment>* node, unsigned int, int, unsigned int, int height) {
+    if (node->getRankParity() != static_cast<unsigned>(height - 1) % 2) {
+        node->flipRank();
+    }
+}
+
+// core functions
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void WAVLTree<Key, Value, Compare, Alloc, Augment>::insert(ptr_WAVLTreeNode<Key, Value, Augment> node) {
+    BinarySearchTree<Key, Value, Compare, Alloc, WAVLTreeNode<Key, Value, Augment>>::insert(node);
+    fixAfterInsert(node);
+}
+
+// the new leaf has rank 0: it is a 0-child only if its parent was a leaf too. The rank differences are 1 or 2
+// before a promotion, so right after it equal parities mean a 0-child
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void WAVLTree<Key, Value, Compare, Alloc, Augment>::fixAfterInsert(ptr_WAVLTreeNode<Key, Value, Augment> node) {
+    ptr_WAVLTreeNode<Key, Value, Augment> parent = node->getParent();
+    while (parent != nullptr && rankParity(node) == rankParity(parent)) { // node is a 0-child of parent
+        bool isLeft = node == parent->getLeft();
+        ptr_WAVLTreeNode<Key, Value, Augment> sibling = isLeft ? parent->getRight() : parent->getLeft();
+        if (rankParity(sibling) != rankParity(parent)) { // a 1-child sibling: promote parent and climb
+            parent->flipRank();
+            node = parent;
+            parent = parent->getParent();
+            continue;
+        }
+        // a 2-child sibling: one or two rotations end the fix
+        ptr_WAVLTreeNode<Key, Value, Augment> inner = isLeft ? node->getRight() : node->getLeft();
+        if (rankParity(inner) == rankParity(node)) { // the inner child is a 2-child
+            isLeft ? rotateRight(parent) : rotateLeft(parent);
+            parent->flipRank();
+        } else {
+            isLeft ? rotateLeft(node) : rotateRight(node);
+            isLeft ? rotateRight(parent) : rotateLeft(parent);
+            inner->flipRank();
+            node->flipRank();
+            parent->flipRank();
+        }
+        return;
+    }
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void WAVLTree<Key, Value, Compare, Alloc, Augment>::insert(const Key& key, const Value& value) {
+    emplace(key, value);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void WAVLTree<Key, Value, Compare, Alloc, Augment>::insert(const Key& key, Value&& value) {
+    emplace(key, std::move(value));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+template <typename... Args>
+ptr_WAVLTreeNode<Key, Value, Augment> WAVLTree<Key, Value, Compare, Alloc, Augment>::emplace(const Key& key, Args&&... args) {
+    ptr_WAVLTreeNode<Key, Value, Augment> node = this->createNode(key, std::forward<Args>(args)...);
+    insert(node);
+    return node;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void WAVLTree<Key, Value, Compare, Alloc, Augment>::insert(TreeNodeObject* obj) {
+    emplace(obj->getKey(), this->shareObject(obj));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+template <typename... Args>
+ptr_WAVLTreeNode<Key, Value, Augment> WAVLTree<Key, Value, Compare, Alloc, Augment>::emplaceHint(ptr_WAVLTreeNode<Key, Value, Augment> hint, const Key& key, Args&&... args) {
+    ptr_WAVLTreeNode<Key, Value, Augment> node = this->createNode(key, std::forward<Args>(args)...);
+    this->insertNear(hint, node);
+    fixAfterInsert(node);
+    return node;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+ptr_WAVLTreeNode<Key, Value, Augment> WAVLTree<Key, Value, Compare, Alloc, Augment>::insert(ptr_WAVLTreeNode<Key, Value, Augment> hint, TreeNodeObject* obj) {
+    return emplaceHint(hint, obj->getKey(), this->shareObject(obj));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void WAVLTree<Key, Value, Compare, Alloc, Augment>::insertBatch(std::vector<std::pair<Key, Value>> batch) {
+    if (this->mergeBatch(batch, annotateBalanced)) {
+        return;
+    }
+    ptr_WAVLTreeNode<Key, Value, Augment> hint = nullptr;
+    for (typename std::vector<std::pair<Key, Value>>::iterator it = batch.begin(); it != batch.end(); ++it) {
+        hint = emplaceHint(hint, it->first, std::move(it->second));
+    }
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void WAVLTree<Key, Value, Compare, Alloc, Augment>::insertBatch(const std::vector<TreeNodeObject*>& objects) {
+    std::vector<std::pair<Key, Value>> batch;
+    batch.reserve(objects.size());
+    for (TreeNodeObject* obj : objects) {
+        batch.emplace_back(obj->getKey(), this->shareObject(obj));
+    }
+    insertBatch(std::move(batch));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+ptr_WAVLTreeNode<Key, Value, Augment> WAVLTree<Key, Value, Compare, Alloc, Augment>::search(const Key& key) const {
+    return static_cast<ptr_WAVLTreeNode<Key, Value, Augment>>(BinarySearchTree<Key, Value, Compare, Alloc, WAVLTreeNode<Key, Value, Augment>>::search(key));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+ptr_WAVLTreeNode<Key, Value, Augment> WAVLTree<Key, Value, Compare, Alloc, Augment>::select(unsigned int index) const {
+    return static_cast<ptr_WAVLTreeNode<Key, Value, Augment>>(BinarySearchTree<Key, Value, Compare, Alloc, WAVLTreeNode<Key, Value, Augment>>::select(index));
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void WAVLTree<Key, Value, Compare, Alloc, Augment>::remove(ptr_WAVLTreeNode<Key, Value, Augment> node) {
+    detach(node);
+    this->destroyNode(node);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+bool WAVLTree<Key, Value, Compare, Alloc, Augment>::erase(const Key& key) {
+    ptr_WAVLTreeNode<Key, Value, Augment> node = search(key);
+    if (node == nullptr) {
+        return false;
+    }
+    remove(node);
+    return true;
+}
+
+// one node at a time: BinarySearchTree::eraseRange relinks the two sides without touching the rank parities
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+unsigned int WAVLTree<Key, Value, Compare, Alloc, Augment>::eraseRange(const Key& lo, const Key& hi) {
+    unsigned int count{0};
+    ptr_WAVLTreeNode<Key, Value, Augment> node = static_cast<ptr_WAVLTreeNode<Key, Value, Augment>>(this->lower_bound(lo).getNode());
+    while (node != nullptr && !this->comp(hi, node->getKey())) {
+        ptr_WAVLTreeNode<Key, Value, Augment> next = static_cast<ptr_WAVLTreeNode<Key, Value, Augment>>(this->successor(node)); // the removal relinks the nodes, next stays in the tree
+        remove(node);
+        node = next;
+        ++count;
+    }
+    return count;
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void WAVLTree<Key, Value, Compare, Alloc, Augment>::removeBatch(std::vector<Key> keys) {
+    if (this->mergeRemoveBatch(keys, annotateBalanced)) {
+        return;
+    }
+    for (typename std::vector<Key>::const_iterator key = keys.begin(); key != keys.end(); ++key) {
+        erase(*key);
+    }
+}
+
+// unlink the node from the tree and restore the ranks, without freeing it
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void WAVLTree<Key, Value, Compare, Alloc, Augment>::detach(ptr_WAVLTreeNode<Key, Value, Augment> node) {
+    // the node leaving its place is the node itself if it has at most one child, otherwise the successor,
+    // which takes the place and the rank of the node; the child moving up is one rank lower than it
+    ptr_WAVLTreeNode<Key, Value, Augment> parent = node->getParent();
+    ptr_WAVLTreeNode<Key, Value, Augment> spliced = node;
+    bool fromLeft = parent != nullptr && node == parent->getLeft();
+    if (node->getLeft() != nullptr && node->getRight() != nullptr) {
+        spliced = static_cast<ptr_WAVLTreeNode<Key, Value, Augment>>(this->minimum(node->getRight()));
+        fromLeft = spliced->getParent() != node;
+        parent = fromLeft ? spliced->getParent() : spliced;
+    }
+    bool threeChild = spliced->getParent() != nullptr && rankParity(spliced) == rankParity(spliced->getParent()); // it was a 2-child
+    if (spliced != node && spliced->getRankParity() != node->getRankParity()) {
+        spliced->flipRank();
+    }
+    this->unlink(node);
+    if (parent == nullptr) {
+        return;
+    }
+    if (!threeChild) { // the child is a 2-child, only a leaf left with two of them is too high
+        if (!isLeaf(parent)) {
+            return;
+        }
+        ptr_WAVLTreeNode<Key, Value, Augment> grandparent = parent->getParent();
+        if (!demote(parent)) {
+            return;
+        }
+        fromLeft = parent == grandparent->getLeft();
+        parent = grandparent;
+    }
+    fixAfterRemove(parent, fromLeft);
+}
+
+// lower the rank of node by one, true if it was a 2-child and is now a 3-child
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+bool WAVLTree<Key, Value, Compare, Alloc, Augment>::demote(ptr_WAVLTreeNode<Key, Value, Augment> node) {
+    ptr_WAVLTreeNode<Key, Value, Augment> parent = node->getParent();
+    bool twoChild = parent != nullptr && node->getRankParity() == parent->getRankParity();
+    node->flipRank();
+    return twoChild;
+}
+
+// fixers
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void WAVLTree<Key, Value, Compare, Alloc, Augment>::fixAfterRemove(ptr_WAVLTreeNode<Key, Value, Augment> parent, bool fromLeft) {
+    while (true) { // the child on the fromLeft side of parent is a 3-child, the sibling exists as parent has rank >= 2
+        ptr_WAVLTreeNode<Key, Value, Augment> sibling = fromLeft ? parent->getRight() : parent->getLeft();
+        if (rankParity(sibling) != rankParity(parent)) { // a 1-child sibling
+            ptr_WAVLTreeNode<Key, Value, Augment> outer = fromLeft ? sibling->getRight() : sibling->getLeft();
+            ptr_WAVLTreeNode<Key, Value, Augment> inner = fromLeft ? sibling->getLeft() : sibling->getRight();
+            if (rankParity(outer) != rankParity(sibling)) { // outer 1-child: single rotation, the sibling goes up one rank
+                fromLeft ? rotateLeft(parent) : rotateRight(parent);
+                sibling->flipRank();
+                parent->flipRank();
+                if (isLeaf(parent)) { // down one more rank, a leaf has rank 0
+                    parent->flipRank();
+                }
+                return;
+            } else if (rankParity(inner) != rankParity(sibling)) { // inner 1-child: double rotation, inner goes up two ranks, parent down two
+                fromLeft ? rotateRight(sibling) : rotateLeft(sibling);
+                fromLeft ? rotateLeft(parent) : rotateRight(parent);
+                sibling->flipRank();
+                return;
+            }
+            sibling->flipRank(); // a 2,2 sibling is demoted with parent
+        }
+        ptr_WAVLTreeNode<Key, Value, Augment> grandparent = parent->getParent();
+        if (!demote(parent)) {
+            return;
+        }
+        fromLeft = parent == grandparent->getLeft();
+        parent = grandparent;
+    }
+}
+
+// rotation methods
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void WAVLTree<Key, Value, Compare, Alloc, Augment>::rotateLeft(ptr_WAVLTreeNode<Key, Value, Augment> node) {
+    SelfBalancingTree<Key, Value, Compare, Alloc, WAVLTreeNode<Key, Value, Augment>>::rotateLeft(node);
+}
+
+template <typename Key, typename Value, typename Compare, typename Alloc, typename Augment>
+void WAVLTree<Key, Value, Compare, Alloc, Augment>::rotateRight(ptr_WAVLTreeNode<Key, Value, Augment> node) {
+    SelfBalancingTree<Key, Value, Compare, Alloc, WAVLTreeNode<Key, Value, Augment>>::rotateRight(node);
+}
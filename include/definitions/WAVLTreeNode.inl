@@ -0,0 +1,43 @@
+/**
+ * @file WAVLTreeNode.inl
+ * @brief This class implements WAVLTreeNode
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include "WAVLTreeNode.hpp"
+
+// constructor
+template <typename Key, typename Value, typename Augment>
+template <typename... Args>
+WAVLTreeNode<Key, Value, Augment>::WAVLTreeNode(const Key& key, Args&&... args) : TreeNode<Key, Value>(key, std::forward<Args>(args)...) {}
+
+// getters
+template <typename Key, typename Value, typename Augment>
+WAVLTreeNode<Key, Value, Augment>* WAVLTreeNode<Key, Value, Augment>::getLeft() const {
+    return static_cast<WAVLTreeNode*>(this->left);
+}
+
+template <typename Key, typename Value, typename Augment>
+WAVLTreeNode<Key, Value, Augment>* WAVLTreeNode<Key, Value, Augment>::getRight() const {
+    return static_cast<WAVLTreeNode*>(this->right);
+}
+
+template <typename Key, typename Value, typename Augment>
+WAVLTreeNode<Key, Value, Augment>* WAVLTreeNode<Key, Value, Augment>::getParent() const {
+    return static_cast<WAVLTreeNode*>(TreeNode<Key, Value>::getParent());
+}
+
+template <typename Key, typename Value, typename Augment>
+unsigned WAVLTreeNode<Key, Value, Augment>::getRankParity() const {
+    return this->getTag() & 1;
+}
+
+// setters
+template <typename Key, typename Value, typename Augment>
+void WAVLTreeNode<Key, Value, Augment>::flipRank() {
+    this->setTag(this->getTag() ^ 1);
+}
@@ -0,0 +1,112 @@
+/**
+ * @file ARTNode.hpp
+ * @brief Implementation of the nodes of an Adaptive Radix Tree
+ * @version 1.0
+ * @date 2023-01-17
+ *
+ * @copyright Copyright (c) 2023
+*/
+
+#ifndef __ARTNODE_HPP__
+#define __ARTNODE_HPP__
+
+#include <cstdint>
+#include <utility>
+
+/**
+ * @brief The kinds of node of an Adaptive Radix Tree
+ */
+enum class ARTNodeType : std::uint8_t {LEAF, NODE4, NODE16, NODE48, NODE256};
+
+/**
+ * @brief This class implements the part shared by every node of an Adaptive Radix Tree
+ */
+struct ARTNode {
+    ARTNodeType type;
+
+    ARTNode(ARTNodeType type) : type{type} {}
+};
+
+/**
+ * @brief This class implements a leaf of an Adaptive Radix Tree, holding a whole key and its value
+ *
+ * @tparam Key the type of the key
+ * @tparam Value the type of the value stored with the key
+ */
+template <typename Key, typename Value>
+struct ARTLeaf : public ARTNode {
+    Key key;
+    Value value;
+
+    /**
+     * @brief Construct a new leaf, building its value in place
+     *
+     * @param key the key of the leaf
+     * @param args the arguments forwarded to the constructor of the value
+     */
+    template <typename... Args>
+    ARTLeaf(const Key& key, Args&&... args) : ARTNode(ARTNodeType::LEAF), key(key), value(std::forward<Args>(args)...) {}
+
+    inline const Key& getKey() const { return key; }
+    inline const Value& getValue() const { return value; }
+    inline Value& getValue() { return value; }
+};
+
+template <typename Key, typename Value>
+using ptr_ARTLeaf = ARTLeaf<Key, Value>*;
+
+/**
+ * @brief This class implements the part shared by the inner nodes: the number of children and the
+ * compressed path, the key bytes shared by every key below the node (keys are at most 8 bytes, so
+ * the whole path always fits)
+ */
+struct ARTInner : public ARTNode {
+    static const unsigned int MAX_PREFIX = 8;
+
+    std::uint8_t prefixLength{0};
+    std::uint16_t count{0};
+    std::uint8_t prefix[MAX_PREFIX];
+
+    ARTInner(ARTNodeType type) : ARTNode(type) {}
+};
+
+/**
+ * @brief Inner node with up to 4 children, key bytes kept sorted
+ */
+struct ARTNode4 : public ARTInner {
+    std::uint8_t keys[4];
+    ARTNode* children[4];
+
+    ARTNode4() : ARTInner(ARTNodeType::NODE4) {}
+};
+
+/**
+ * @brief Inner node with up to 16 children, key bytes kept sorted and searched with SSE2
+ */
+struct ARTNode16 : public ARTInner {
+    std::uint8_t keys[16];
+    ARTNode* children[16];
+
+    ARTNode16() : ARTInner(ARTNodeType::NODE16) {}
+};
+
+/**
+ * @brief Inner node with up to 48 children, indexed by key byte (0 means no child, i + 1 is children[i])
+ */
+struct ARTNode48 : public ARTInner {
+    std::uint8_t childIndex[256];
+    ARTNode* children[48];
+
+    ARTNode48() : ARTInner(ARTNodeType::NODE48), childIndex{}, children{} {}
+};
+
+/**
+ * @brief Inner node with a child slot for every key byte
+ */
+struct ARTNode256 : public ARTInner {
+    ARTNode* children[256];
+
+    ARTNode256() : ARTInner(ARTNodeType::NODE256), children{} {}
+};
+
+#endif // __ARTNODE_HPP__
@@ -12,37 +12,171 @@
 
 #include "SelfBalancingTree.hpp"
 #include "AVLTreeNode.hpp"
+#include "SetOperations.hpp"
 
 /**
  * @brief This template class implements a Self-Balancing Binary Search Tree using the AVL algorithm
  * 
- * @tparam CMP the compare function to use
+ * @tparam Key the type of the keys
+ * @tparam Value the type of the values stored with the keys
+ * @tparam Compare the comparator type, a strict weak ordering on Key
+ * @tparam Alloc the allocator used for the nodes
+ * @tparam Augment the information kept in the nodes about their subtrees, SubtreeSize for the order statistics
  */
-template <bool CMP(const int& key1, const int& key2)>
-class AVLTree : public SelfBalancingTree<CMP> { 
+template <typename Key, typename Value, typename Compare = std::less<Key>, typename Alloc = std::allocator<AVLTreeNode<Key, Value>>, typename Augment = NoAugmentation>
+class AVLTree : public SelfBalancingTree<Key, Value, Compare, Alloc, AVLTreeNode<Key, Value, Augment>> { 
     protected:
-        void insert(sptr_AVLTreeNode&& node);
-        void insert(sptr_TreeNodeObject&& obj);
-        bool balance(sptr_AVLTreeNode& node);
-        int balanceFactor(sptr_AVLTreeNode node);
-        void rotateLeft(sptr_AVLTreeNode node);
-        void rotateRight(sptr_AVLTreeNode node);
-        void updateOnRotation(sptr_AVLTreeNode& node);
-        void updateHeight(sptr_AVLTreeNode& node);
+        void insert(ptr_AVLTreeNode<Key, Value, Augment> node);
+        bool fixAfterInsert(ptr_AVLTreeNode<Key, Value, Augment> node);
+        void detach(ptr_AVLTreeNode<Key, Value, Augment> node);
+        int height(ptr_AVLTreeNode<Key, Value, Augment> node) const;
+        ptr_AVLTreeNode<Key, Value, Augment> joinSubtrees(ptr_AVLTreeNode<Key, Value, Augment> left, int leftHeight, ptr_AVLTreeNode<Key, Value, Augment> pivot, ptr_AVLTreeNode<Key, Value, Augment> right, int rightHeight, int& height);
+        void splitSubtree(ptr_AVLTreeNode<Key, Value, Augment> node, int nodeHeight, const Key& key, ptr_AVLTreeNode<Key, Value, Augment>& left, int& leftHeight, ptr_AVLTreeNode<Key, Value, Augment>& right, int& rightHeight, ptr_AVLTreeNode<Key, Value, Augment>* found = nullptr);
+        int subtreeRank(ptr_AVLTreeNode<Key, Value, Augment> node) const;
+        void expose(ptr_AVLTreeNode<Key, Value, Augment> node, int nodeHeight, ptr_AVLTreeNode<Key, Value, Augment>& left, int& leftHeight, ptr_AVLTreeNode<Key, Value, Augment>& right, int& rightHeight) const;
+        ptr_AVLTreeNode<Key, Value, Augment> join2Subtrees(ptr_AVLTreeNode<Key, Value, Augment> left, int leftHeight, ptr_AVLTreeNode<Key, Value, Augment> right, int rightHeight, int& height);
+        AVLTree workspace() const;
+        void join(ptr_AVLTreeNode<Key, Value, Augment> pivot, AVLTree& right);
+        static void annotateBalanced(AVLTreeNode<Key, Value, Augment>* node, unsigned int depth, int balance, unsigned int lastLevel, int height);
+        friend class SetOperations<AVLTree, AVLTreeNode<Key, Value, Augment>, int>;
+        ptr_AVLTreeNode<Key, Value, Augment> balance(ptr_AVLTreeNode<Key, Value, Augment> node, int nodeBalance);
+        int balanceFactor(ptr_AVLTreeNode<Key, Value, Augment> node);
+        void fixAfterRemove(ptr_AVLTreeNode<Key, Value, Augment> parent, bool fromLeft);
+        void rotateLeft(ptr_AVLTreeNode<Key, Value, Augment> node);
+        void rotateRight(ptr_AVLTreeNode<Key, Value, Augment> node);
 
     public:
         /**
          * @brief Construct a new empty AVL Tree object
          * 
+         * @param comp the comparator of the keys
+         * @param alloc the allocator for the nodes
          */
-        AVLTree();
+        explicit AVLTree(const Compare& comp = Compare(), const Alloc& alloc = Alloc());
 
         /**
          * @brief Construct a new AVL Tree object with defined root
          * 
-         * @param root root of the new AVL Tree
+         * @param root root of the new AVL Tree, the tree takes ownership of it
+         * @param comp the comparator of the keys
+         * @param alloc the allocator for the nodes, it must be able to free root
          */
-        AVLTree(sptr_AVLTreeNode root);
+        AVLTree(ptr_AVLTreeNode<Key, Value, Augment> root, const Compare& comp = Compare(), const Alloc& alloc = Alloc());
+
+        /**
+         * @brief Move the nodes of another AVL Tree into a new one
+         * 
+         * @param other the tree to move from, left empty
+         */
+        AVLTree(AVLTree&& other) = default;
+
+        /**
+         * @brief Build a perfectly balanced AVL Tree from sorted pairs in linear time
+         * 
+         * @note no comparisons nor rotations: the nodes are allocated in one block, linked by halving
+         * the range and annotated with their balance
+         * @param first the first (key, value) pair, pairs must be sorted by key according to comp
+         * @param last one past the last pair
+         * @param comp the comparator of the keys
+         * @param alloc the allocator for the nodes
+         * @return AVLTree the new tree
+         */
+        template <typename Iterator>
+        static AVLTree buildFromSorted(Iterator first, Iterator last, const Compare& comp = Compare(), const Alloc& alloc = Alloc());
+
+        /**
+         * @brief Join two AVL Trees through a new pivot node in O(log n)
+         * 
+         * @note the pivot is hung on the spine of the taller tree where the heights differ by at most one,
+         * then the tree is fixed as after an insertion; the trees must have equal allocators, otherwise
+         * std::invalid_argument is thrown and both trees are left untouched
+         * @param left the tree with the smaller keys, left empty
+         * @param key the key of the pivot, not less than the keys of left and not greater than the keys of right
+         * @param value the value stored with the pivot
+         * @param right the tree with the greater keys, left empty
+         * @return AVLTree the joined tree, with the comparator and the allocator of left
+         */
+        static AVLTree join(AVLTree&& left, const Key& key, Value value, AVLTree&& right);
+
+        /**
+         * @brief Join two AVL Trees in O(log n), the minimum of right becomes the pivot
+         * 
+         * @note the trees must have equal allocators, std::invalid_argument otherwise
+         * @param left the tree with the smaller keys, left empty
+         * @param right the tree with the greater keys, left empty
+         * @return AVLTree the joined tree, with the comparator and the allocator of left
+         */
+        static AVLTree join(AVLTree&& left, AVLTree&& right);
+
+        /**
+         * @brief Split the tree at a key in O(log n), moving its nodes into two new trees
+         * 
+         * @note the subtrees hanging from the search path are joined back bottom up; the node counts of
+         * the halves are computed on the first call to getNumOfNodes
+         * @param key the key where the tree is split
+         * @return std::pair<AVLTree, AVLTree> the tree of the keys less than key and the tree of the others,
+         * this tree is left empty
+         */
+        std::pair<AVLTree, AVLTree> split(const Key& key);
+
+        /**
+         * @brief The union of two trees, in O(m log(n/m + 1)) work for trees of m <= n keys
+         * 
+         * @note the keys are treated as sets: the nodes of both trees are relinked into the result and, for a
+         * key in both, the one of first is kept; the trees must have equal allocators, std::invalid_argument otherwise
+         * @param first the first tree, left empty
+         * @param second the second tree, left empty
+         * @return AVLTree the union, with the comparator and the allocator of first
+         */
+        static AVLTree setUnion(AVLTree&& first, AVLTree&& second);
+
+        /**
+         * @brief The union of two trees, combining disjoint subtrees in parallel on a thread pool
+         * 
+         * @param first the first tree, left empty
+         * @param second the second tree, left empty
+         * @param pool the pool running the recursion
+         * @return AVLTree the union, with the comparator and the allocator of first
+         */
+        static AVLTree setUnion(AVLTree&& first, AVLTree&& second, ThreadPool& pool);
+
+        /**
+         * @brief The intersection of two trees, with the values of first
+         * 
+         * @param first the first tree, left empty
+         * @param second the second tree, left empty
+         * @return AVLTree the intersection, with the comparator and the allocator of first
+         */
+        static AVLTree setIntersection(AVLTree&& first, AVLTree&& second);
+
+        /**
+         * @brief The intersection of two trees, combining disjoint subtrees in parallel on a thread pool
+         * 
+         * @param first the first tree, left empty
+         * @param second the second tree, left empty
+         * @param pool the pool running the recursion
+         * @return AVLTree the intersection, with the comparator and the allocator of first
+         */
+        static AVLTree setIntersection(AVLTree&& first, AVLTree&& second, ThreadPool& pool);
+
+        /**
+         * @brief The keys of first that are not in second
+         * 
+         * @param first the first tree, left empty
+         * @param second the second tree, left empty
+         * @return AVLTree the difference, with the comparator and the allocator of first
+         */
+        static AVLTree setDifference(AVLTree&& first, AVLTree&& second);
+
+        /**
+         * @brief The keys of first that are not in second, combining disjoint subtrees in parallel on a thread pool
+         * 
+         * @param first the first tree, left empty
+         * @param second the second tree, left empty
+         * @param pool the pool running the recursion
+         * @return AVLTree the difference, with the comparator and the allocator of first
+         */
+        static AVLTree setDifference(AVLTree&& first, AVLTree&& second, ThreadPool& pool);
 
         /**
          * @brief Destroy the AVL Tree
@@ -53,30 +187,136 @@ class AVLTree : public SelfBalancingTree<CMP> {
         /**
          * @brief Get the root of the tree
          * 
-         * @return sptr_AVLTreeNode the root of the tree
+         * @return ptr_AVLTreeNode<Key, Value, Augment> the root of the tree
          */
-        sptr_AVLTreeNode getRoot() const;
+        ptr_AVLTreeNode<Key, Value, Augment> getRoot() const;
+
+        /**
+         * @brief Insert a key and a copy of its value in the tree
+         * 
+         * @param key the key to insert
+         * @param value the value stored with the key
+         */
+        void insert(const Key& key, const Value& value);
+
+        /**
+         * @brief Insert a key and its value in the tree, moving the value into the node
+         * 
+         * @param key the key to insert
+         * @param value the value stored with the key
+         */
+        void insert(const Key& key, Value&& value);
+
+        /**
+         * @brief Insert a key building its value directly inside the new node
+         * 
+         * @note the node is the only allocation of the insertion
+         * @param key the key to insert
+         * @param args the arguments forwarded to the constructor of the value
+         * @return ptr_AVLTreeNode<Key, Value, Augment> the new node
+         */
+        template <typename... Args>
+        ptr_AVLTreeNode<Key, Value, Augment> emplace(const Key& key, Args&&... args);
 
         /**
          * @brief Insert a TreeNodeObject in the tree (pointer version)
          * 
-         * @param node the TreeNodeObject to insert
+         * @note only for trees whose values are sptr_TreeNodeObject, the key is the one of the object
+         * @param node the TreeNodeObject to insert, the tree takes ownership of it
          */
         void insert(TreeNodeObject* node);
 
+        /**
+         * @brief Insert a key building its value inside the new node, searching its place from a node near it
+         * 
+         * @note the search climbs from hint only until the key falls inside the subtree, then descends: O(1) for
+         * a key next to hint, O(log d) for a key d positions away, then the tree is fixed as after any insertion
+         * @param hint a node of the tree, nullptr to search from the root
+         * @param key the key to insert
+         * @param args the arguments forwarded to the constructor of the value
+         * @return ptr_AVLTreeNode<Key, Value, Augment> the new node
+         */
+        template <typename... Args>
+        ptr_AVLTreeNode<Key, Value, Augment> emplaceHint(ptr_AVLTreeNode<Key, Value, Augment> hint, const Key& key, Args&&... args);
+
+        /**
+         * @brief Insert a TreeNodeObject in the tree, searching its place from a node near it
+         * 
+         * @note only for trees whose values are sptr_TreeNodeObject, the key is the one of the object
+         * @param hint a node of the tree, nullptr to search from the root
+         * @param obj pointer to the TreeNodeObject to insert, the tree takes ownership of it
+         * @return ptr_AVLTreeNode<Key, Value, Augment> the new node
+         */
+        ptr_AVLTreeNode<Key, Value, Augment> insert(ptr_AVLTreeNode<Key, Value, Augment> hint, TreeNodeObject* obj);
+
+        /**
+         * @brief Insert a batch of keys and values in one coordinated pass
+         * 
+         * @note the batch is sorted, then every key is inserted starting from the node of the previous one
+         * instead of the root; a batch large compared to the tree is merged with the nodes of the tree,
+         * which are relinked into a perfectly balanced tree without rotations
+         * @param batch the (key, value) pairs to insert, in any order
+         */
+        void insertBatch(std::vector<std::pair<Key, Value>> batch);
+
+        /**
+         * @brief Insert a batch of TreeNodeObjects in one coordinated pass (pointer version)
+         * 
+         * @note only for trees whose values are sptr_TreeNodeObject, the tree takes ownership of the objects
+         * @param objects the objects to insert, in any order
+         */
+        void insertBatch(const std::vector<TreeNodeObject*>& objects);
+
         /**
          * @brief Search for a node in the tree
          * 
          * @param key the key to search for
         */
-        sptr_AVLTreeNode search(int key);
+        ptr_AVLTreeNode<Key, Value, Augment> search(const Key& key) const;
 
         /**
-         * @brief Remove a node from the tree
+         * @brief Find the node with the k-th smallest key, in O(log n)
          * 
-         * @param node the node to remove
+         * @note only for trees with Augment = SubtreeSize
+         * @param index the position of the node in the sorted keys, from 0
+         * @return ptr_AVLTreeNode<Key, Value, Augment> the node, nullptr if index is not less than the number of nodes
+         */
+        ptr_AVLTreeNode<Key, Value, Augment> select(unsigned int index) const;
+
+        /**
+         * @brief Remove a node from the tree and free it
+         * 
+         * @param node the node to remove, invalid after the call
         */
-        void remove(sptr_AVLTreeNode node);
+        void remove(ptr_AVLTreeNode<Key, Value, Augment> node);
+
+        /**
+         * @brief Remove a key (one of its copies, if inserted more than once) and free its node
+         * 
+         * @param key the key to remove
+         * @return true if the key was in the tree
+         */
+        bool erase(const Key& key);
+
+        /**
+         * @brief Remove every node with lo <= key <= hi, in O(k + log n) for k removed nodes
+         * 
+         * @note the tree is split at lo and past hi, the middle subtree is freed whole and the two sides are
+         * joined back, so no node of the range is searched nor rebalanced on its own
+         * @param lo the lower bound of the range
+         * @param hi the upper bound of the range
+         * @return unsigned int the number of nodes removed
+         */
+        unsigned int eraseRange(const Key& lo, const Key& hi);
+
+        /**
+         * @brief Remove a batch of keys in one coordinated pass, one node for every occurrence of a key in the batch
+         * 
+         * @note a batch large compared to the tree is removed with a single in-order walk, relinking the
+         * remaining nodes into a perfectly balanced tree
+         * @param keys the keys to remove, in any order, keys not in the tree are ignored
+         */
+        void removeBatch(std::vector<Key> keys);
 };
 
 
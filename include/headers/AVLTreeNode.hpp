@@ -15,18 +15,27 @@
 
 /**
  * @brief This class implements a TreeNode for an AVL Tree
+ * 
+ * @note the balance is stored in the two low bits of the parent link, the node is as big as a TreeNode
+ * plus the Summary of Augment (nothing with the default NoAugmentation)
+ * 
+ * @tparam Key the type of the key
+ * @tparam Value the type of the value stored with the key
+ * @tparam Augment the information kept about the subtree of the node (see Augmentation.hpp)
 */
-class AVLTreeNode : public TreeNode {
-    typedef std::shared_ptr<AVLTreeNode> sptr_AVLTreeNode;
-
+template <typename Key, typename Value, typename Augment = NoAugmentation>
+class AVLTreeNode : public TreeNode<Key, Value>, public Augment::Summary {
 public:
+    typedef Augment Augmentation;
 
     /**
-     * @brief Construct a new AVL Tree Node
+     * @brief Construct a new AVL Tree Node, building its value in place
      * 
-     * @param obj object to store in the node
+     * @param key the key of the node
+     * @param args the arguments forwarded to the constructor of the value
     */
-    AVLTreeNode(sptr_TreeNodeObject obj);
+    template <typename... Args>
+    AVLTreeNode(const Key& key, Args&&... args);
 
     /**
      * @brief Destroy the AVL Tree Node 
@@ -37,43 +46,42 @@ public:
     /**
      * @brief Get the left child of the node
      * 
-     * @return sptr_AVLTreeNode the left child of the node
+     * @return AVLTreeNode* the left child of the node
      */
-    sptr_AVLTreeNode getLeft() const;
+    AVLTreeNode* getLeft() const;
 
     /**
      * @brief Get the right child of the node
      * 
-     * @return sptr_AVLTreeNode the right child of the node
+     * @return AVLTreeNode* the right child of the node
      */
-    sptr_AVLTreeNode getRight() const;
+    AVLTreeNode* getRight() const;
 
     /**
      * @brief Get the parent of the node
      * 
-     * @return sptr_AVLTreeNode the parent of the node
+     * @return AVLTreeNode* the parent of the node
      */
-    sptr_AVLTreeNode getParent() const;
+    AVLTreeNode* getParent() const;
 
     /**
-     * @brief Get the height of the node
+     * @brief Get the balance of the node
      * 
-     * @return int the height of the node
+     * @return int the height of the left subtree minus the height of the right one (-1, 0 or +1)
      */
-    int getHeight() const;
+    int getBalance() const;
 
     /**
-     * @brief Set the height of the node
+     * @brief Set the balance of the node
      * 
-     * @param height the new height of the node
+     * @param balance the new balance of the node (-1, 0 or +1)
     */
-    void setHeight(int height);
-
-protected:
-    int height{0};
+    void setBalance(int balance);
 };
 
-typedef std::shared_ptr<AVLTreeNode> sptr_AVLTreeNode;
+template <typename Key, typename Value, typename Augment = NoAugmentation>
+using ptr_AVLTreeNode = AVLTreeNode<Key, Value, Augment>*;
 
+#include "../definitions/AVLTreeNode.inl"
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,191 @@
+/**
+ * @file AdaptiveRadixTree.hpp
+ * @brief Implementation and management of an Adaptive Radix Tree
+ * @version 1.0
+ * @date 2023-01-17
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef ADAPTIVE_RADIX_TREE_HPP
+#define ADAPTIVE_RADIX_TREE_HPP
+
+#include <memory>
+#include <type_traits>
+#include "ARTNode.hpp"
+#include "TreeNodeObject.hpp"
+
+/**
+ * @brief This template class implements an Adaptive Radix Tree (Leis et al.) over integer keys
+ *
+ * @note the keys are split in bytes, most significant first (with the sign bit flipped for signed
+ * types), so the tree is ordered as the integers. Inner nodes grow and shrink between 4, 16, 48 and
+ * 256 children, and chains of single-child nodes are compressed into the prefix of the next one:
+ * a lookup does at most sizeof(Key) steps and never compares whole keys until the leaf.
+ * Unlike the comparison trees, a key is stored once: inserting it again replaces its value.
+ *
+ * @tparam Key the type of the keys, an integer type of at most 8 bytes
+ * @tparam Value the type of the values stored with the keys
+ * @tparam Alloc the allocator used for the nodes, rebound to every node type
+ */
+template <typename Key, typename Value, typename Alloc = std::allocator<ARTLeaf<Key, Value>>>
+class AdaptiveRadixTree {
+    static_assert(std::is_integral<Key>::value && sizeof(Key) <= ARTInner::MAX_PREFIX, "the keys of an Adaptive Radix Tree are integers of at most 8 bytes");
+    typedef unsigned int uint;
+
+    protected:
+        typedef ARTLeaf<Key, Value> Leaf;
+        typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Leaf> LeafAllocator;
+        typedef typename std::allocator_traits<Alloc>::template rebind_alloc<ARTNode4> Node4Allocator;
+        typedef typename std::allocator_traits<Alloc>::template rebind_alloc<ARTNode16> Node16Allocator;
+        typedef typename std::allocator_traits<Alloc>::template rebind_alloc<ARTNode48> Node48Allocator;
+        typedef typename std::allocator_traits<Alloc>::template rebind_alloc<ARTNode256> Node256Allocator;
+
+        static const uint KEY_BYTES = sizeof(Key);
+
+        LeafAllocator leafAllocator;
+        Node4Allocator node4Allocator;
+        Node16Allocator node16Allocator;
+        Node48Allocator node48Allocator;
+        Node256Allocator node256Allocator;
+        ARTNode* root{nullptr};
+        uint numOfNodes{0};
+
+        static void loadBytes(const Key& key, std::uint8_t* bytes);
+        static uint prefixMismatch(const ARTInner* node, const std::uint8_t* bytes, uint depth);
+        ARTNode** findChild(ARTInner* node, std::uint8_t byte) const;
+        ARTNode* nextChild(ARTInner* node, int byte) const;
+        ARTNode* lastChild(ARTInner* node) const;
+        void addChild(ARTNode** ref, ARTInner* node, std::uint8_t byte, ARTNode* child);
+        void removeChild(ARTNode** ref, ARTInner* node, std::uint8_t byte);
+        ptr_ARTLeaf<Key, Value> minimum(ARTNode* node) const;
+        ptr_ARTLeaf<Key, Value> maximum(ARTNode* node) const;
+        ptr_ARTLeaf<Key, Value> greater(ARTNode* node, const std::uint8_t* bytes, uint depth, const Key& key) const;
+        template <typename T, typename A, typename... Args> T* createNode(A& allocator, Args&&... args);
+        template <typename T, typename A> void freeNode(A& allocator, T* node);
+        void destroyNode(ARTNode* node);
+        void clear(ARTNode* node);
+
+    public:
+        /**
+         * @brief Construct a new empty Adaptive Radix Tree
+         *
+         * @param alloc the allocator for the nodes
+         */
+        explicit AdaptiveRadixTree(const Alloc& alloc = Alloc());
+
+        /**
+         * @brief The tree owns its nodes, so it cannot be copied
+         *
+         */
+        AdaptiveRadixTree(const AdaptiveRadixTree&) = delete;
+        AdaptiveRadixTree& operator=(const AdaptiveRadixTree&) = delete;
+
+        /**
+         * @brief Move the nodes of another Adaptive Radix Tree into a new one
+         *
+         * @param other the tree to move from, left empty
+         */
+        AdaptiveRadixTree(AdaptiveRadixTree&& other);
+
+        /**
+         * @brief Destroy the Adaptive Radix Tree and free its nodes
+         *
+         */
+        ~AdaptiveRadixTree();
+
+        /**
+         * @brief Free every node of the tree, leaving it empty
+         *
+         */
+        void clear();
+
+        /**
+         * @brief Check if the tree has no keys
+         *
+         * @return true if there are no keys
+         */
+        inline bool isEmpty() const;
+
+        /**
+         * @brief Get the number of keys (leaves)
+         *
+         * @return uint the number of keys
+         */
+        inline uint getNumOfNodes() const;
+
+        /**
+         * @brief Insert a key and a copy of its value in the tree
+         *
+         * @param key the key to insert
+         * @param value the value stored with the key
+         */
+        void insert(const Key& key, const Value& value);
+
+        /**
+         * @brief Insert a key and its value in the tree, moving the value into the leaf
+         *
+         * @param key the key to insert
+         * @param value the value stored with the key
+         */
+        void insert(const Key& key, Value&& value);
+
+        /**
+         * @brief Insert a key building its value directly inside the new leaf
+         *
+         * @param key the key to insert, if already in the tree its value is replaced
+         * @param args the arguments forwarded to the constructor of the value
+         * @return ptr_ARTLeaf<Key, Value> the leaf of the key
+         */
+        template <typename... Args>
+        ptr_ARTLeaf<Key, Value> emplace(const Key& key, Args&&... args);
+
+        /**
+         * @brief Insert a TreeNodeObject in the tree (pointer version)
+         *
+         * @note only for trees whose values are sptr_TreeNodeObject, the key is the one of the object
+         * @param node the TreeNodeObject to insert, the tree takes ownership of it
+         */
+        void insert(TreeNodeObject* node);
+
+        /**
+         * @brief Search for a key in the tree
+         *
+         * @param key the key to search
+         * @return ptr_ARTLeaf<Key, Value> the leaf of the key, nullptr if the key is not in the tree
+         */
+        ptr_ARTLeaf<Key, Value> search(const Key& key) const;
+
+        /**
+         * @brief Remove a leaf from the tree and free it
+         *
+         * @param leaf the leaf to remove, invalid after the call
+         */
+        void remove(ptr_ARTLeaf<Key, Value> leaf);
+
+        /**
+         * @brief Find the leaf with the next key
+         *
+         * @param leaf the leaf to find the successor
+         * @return ptr_ARTLeaf<Key, Value> the successor of the leaf, nullptr if it is the maximum
+         */
+        ptr_ARTLeaf<Key, Value> successor(ptr_ARTLeaf<Key, Value> leaf) const;
+
+        /**
+         * @brief Find the leaf with the smallest key
+         *
+         * @return ptr_ARTLeaf<Key, Value> the minimum leaf, nullptr if the tree is empty
+         */
+        ptr_ARTLeaf<Key, Value> minimum() const;
+
+        /**
+         * @brief Find the leaf with the largest key
+         *
+         * @return ptr_ARTLeaf<Key, Value> the maximum leaf, nullptr if the tree is empty
+         */
+        ptr_ARTLeaf<Key, Value> maximum() const;
+};
+
+#include "../definitions/AdaptiveRadixTree.inl"
+
+#endif
@@ -0,0 +1,159 @@
+/**
+ * @file Augmentation.hpp
+ * @brief Implementation of the information kept in the nodes of a tree about their subtrees
+ * @version 1.0
+ * @date 2023-01-17
+ *
+ * @copyright Copyright (c) 2023
+*/
+
+#ifndef __AUGMENTATION_HPP__
+#define __AUGMENTATION_HPP__
+
+#include <limits>
+
+/**
+ * @brief The default augmentation of the nodes: nothing is kept, the nodes do not grow and the trees
+ * skip every update
+ */
+struct NoAugmentation {
+    static const bool ENABLED = false;
+
+    struct Summary {};
+
+    template <typename Node>
+    static inline unsigned int size(const Node*) {
+        return 0; // not kept
+    }
+
+    template <typename Node>
+    static inline void update(Node*) {}
+};
+
+/**
+ * @brief Augmentation keeping in every node the number of nodes of its subtree, for the order statistics
+ * (rank, select, countInRange) in O(log n)
+ *
+ * @note the trees call update on a node after its children change, bottom up: along the path of an
+ * insertion or a removal and on the two nodes of a rotation; a missing child may be nullptr or the nil of
+ * the tree, which is never updated and counts as an empty subtree
+ */
+struct SubtreeSize {
+    static const bool ENABLED = true;
+
+    struct Summary {
+        unsigned int subtreeSize{0};
+    };
+
+    template <typename Node>
+    static inline unsigned int size(const Node* node) {
+        return (node == nullptr) ? 0 : node->subtreeSize;
+    }
+
+    template <typename Node>
+    static inline void update(Node* node) {
+        node->subtreeSize = size(node->getLeft()) + size(node->getRight()) + 1;
+    }
+};
+
+/**
+ * @brief Augmentation keeping in every node, besides the size of its subtree, the aggregate of a monoid over
+ * the nodes of the subtree in key order, for range aggregates in O(log n)
+ *
+ * @note the monoid only has to be associative, the aggregate of a subtree is always
+ * combine(combine(left, lift(node)), right); the value of a node must be changed through the tree
+ * (updateValue), so that the aggregates above it are recomputed
+ *
+ * @tparam Monoid the policy with the type Type of the aggregates and the static functions identity(),
+ * combine(a, b) and lift(key, value), which gives the aggregate of a single node
+ */
+template <typename Monoid>
+struct MonoidAugmentation {
+    static const bool ENABLED = true;
+
+    typedef typename Monoid::Type Type;
+
+    struct Summary {
+        unsigned int subtreeSize{0};
+        Type aggregate{Monoid::identity()};
+    };
+
+    template <typename Node>
+    static inline unsigned int size(const Node* node) {
+        return (node == nullptr) ? 0 : node->subtreeSize;
+    }
+
+    template <typename Node>
+    static inline Type aggregate(const Node* node) {
+        return (node == nullptr) ? Monoid::identity() : node->aggregate;
+    }
+
+    template <typename Node>
+    static inline Type lift(const Node* node) {
+        return Monoid::lift(node->getKey(), node->getValue());
+    }
+
+    static inline Type identity() {
+        return Monoid::identity();
+    }
+
+    static inline Type combine(const Type& left, const Type& right) {
+        return Monoid::combine(left, right);
+    }
+
+    template <typename Node>
+    static inline void update(Node* node) {
+        node->subtreeSize = size(node->getLeft()) + size(node->getRight()) + 1;
+        node->aggregate = combine(combine(aggregate(node->getLeft()), lift(node)), aggregate(node->getRight()));
+    }
+};
+
+/**
+ * @brief Monoid summing the values of the nodes
+ *
+ * @tparam T the type of the values
+ */
+template <typename T>
+struct SumOfValues {
+    typedef T Type;
+
+    static inline T identity() { return T(); }
+    static inline T combine(const T& a, const T& b) { return a + b; }
+
+    template <typename Key>
+    static inline T lift(const Key&, const T& value) { return value; }
+};
+
+/**
+ * @brief Monoid of the minimum value of the nodes, the maximum of T when there are none
+ *
+ * @tparam T the type of the values, with std::numeric_limits
+ */
+template <typename T>
+struct MinOfValues {
+    typedef T Type;
+
+    static inline T identity() { return std::numeric_limits<T>::max(); }
+    static inline T combine(const T& a, const T& b) { return (b < a) ? b : a; }
+
+    template <typename Key>
+    static inline T lift(const Key&, const T& value) { return value; }
+};
+
+/**
+ * @brief Monoid of the maximum value of the nodes, the lowest value of T when there are none
+ *
+ * @tparam T the type of the values, with std::numeric_limits
+ */
+template <typename T>
+struct MaxOfValues {
+    typedef T Type;
+
+    static inline T identity() { return std::numeric_limits<T>::lowest(); }
+    static inline T combine(const T& a, const T& b) { return (a < b) ? b : a; }
+
+    template <typename Key>
+    static inline T lift(const Key&, const T& value) { return value; }
+};
+
+#endif // __AUGMENTATION_HPP__
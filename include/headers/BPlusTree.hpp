@@ -0,0 +1,184 @@
+/**
+ * @file BPlusTree.hpp
+ * @brief Implementation and management of a B+ Tree
+ * @version 1.0
+ * @date 2023-01-17
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef BPLUS_TREE_HPP
+#define BPLUS_TREE_HPP
+
+#include <functional>
+#include <memory>
+#include "BPlusTreeNode.hpp"
+#include "TreeNodeObject.hpp"
+
+/**
+ * @brief This template class implements a B+ Tree: the entries live in linked leaves, the internal
+ * nodes only route the search, so a lookup touches one node (a few cache lines) per level
+ *
+ * @note with std::less on 32 or 64-bit integer keys the search inside a node is done with SSE/AVX2
+ * compares (build with -march=native or -mavx2 to get the AVX2 path)
+ *
+ * @tparam Key the type of the keys, default constructible
+ * @tparam Value the type of the values stored with the keys, default constructible
+ * @tparam Compare the comparator type, a strict weak ordering on Key
+ * @tparam Fanout the maximum number of children of an internal node (at least 4)
+ * @tparam Alloc the allocator used for the nodes, rebound to the leaf and internal node types
+ */
+template <typename Key, typename Value, typename Compare = std::less<Key>, unsigned int Fanout = 32, typename Alloc = std::allocator<BPlusTreeLeaf<Key, Value, Fanout>>>
+class BPlusTree {
+    static_assert(Fanout >= 4, "a B+ Tree node needs at least 4 children");
+    typedef unsigned int uint;
+
+    protected:
+        typedef BPlusTreeNode<Key, Fanout> Node;
+        typedef BPlusTreeInternal<Key, Fanout> Internal;
+        typedef BPlusTreeLeaf<Key, Value, Fanout> Leaf;
+        typedef BPlusTreeKeys<Key, Compare> Keys;
+        typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Leaf> LeafAllocator;
+        typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Internal> InternalAllocator;
+
+        static const uint MIN_KEYS = (Fanout - 1) / 2;
+
+        Compare comp;
+        LeafAllocator leafAllocator;
+        InternalAllocator internalAllocator;
+        Node* root{nullptr};
+        uint numOfKeys{0};
+
+        Leaf* findLeaf(const Key& key) const;
+        Node* insert(Node* node, const Key& key, Value&& value, Key& splitKey);
+        void insertValue(const Key& key, Value&& value);
+        bool remove(Node* node, const Key& key);
+        void fixUnderflow(Internal* parent, uint index);
+        void borrowFromLeft(Internal* parent, uint index);
+        void borrowFromRight(Internal* parent, uint index);
+        void merge(Internal* parent, uint index);
+        void removeChild(Internal* parent, uint index);
+        Leaf* createLeaf();
+        Internal* createInternal();
+        void destroyNode(Node* node);
+        void clear(Node* node);
+
+    public:
+        /**
+         * @brief Construct a new empty B+ Tree
+         *
+         * @param comp the comparator of the keys
+         * @param alloc the allocator for the nodes
+         */
+        explicit BPlusTree(const Compare& comp = Compare(), const Alloc& alloc = Alloc());
+
+        /**
+         * @brief The tree owns its nodes, so it cannot be copied
+         *
+         */
+        BPlusTree(const BPlusTree&) = delete;
+        BPlusTree& operator=(const BPlusTree&) = delete;
+
+        /**
+         * @brief Move the nodes of another B+ Tree into a new one
+         *
+         * @param other the tree to move from, left empty
+         */
+        BPlusTree(BPlusTree&& other);
+
+        /**
+         * @brief Destroy the B+ Tree and free its nodes
+         *
+         */
+        ~BPlusTree();
+
+        /**
+         * @brief Free every node of the tree, leaving it empty
+         *
+         */
+        void clear();
+
+        /**
+         * @brief Check if the tree has no keys
+         *
+         * @return true if there are no keys
+         */
+        inline bool isEmpty() const;
+
+        /**
+         * @brief Get the number of keys
+         *
+         * @return uint the number of keys
+         */
+        inline uint getNumOfKeys() const;
+
+        /**
+         * @brief Get the number of levels, 0 for an empty tree
+         *
+         * @return uint the number of levels
+         */
+        uint getHeight() const;
+
+        /**
+         * @brief Insert a key and a copy of its value in the tree
+         *
+         * @param key the key to insert
+         * @param value the value stored with the key
+         */
+        void insert(const Key& key, const Value& value);
+
+        /**
+         * @brief Insert a key and its value in the tree, moving the value into the leaf
+         *
+         * @param key the key to insert
+         * @param value the value stored with the key
+         */
+        void insert(const Key& key, Value&& value);
+
+        /**
+         * @brief Insert a TreeNodeObject in the tree (pointer version)
+         *
+         * @note only for trees whose values are sptr_TreeNodeObject, the key is the one of the object
+         * @param node the TreeNodeObject to insert, the tree takes ownership of it
+         */
+        void insert(TreeNodeObject* node);
+
+        /**
+         * @brief Search for a key in the tree
+         *
+         * @param key the key to search
+         * @return Value* the value stored with the key, nullptr if the key is not in the tree;
+         * valid until the next insertion or removal
+         */
+        Value* search(const Key& key);
+
+        /**
+         * @brief Search for a key in the tree
+         *
+         * @param key the key to search
+         * @return const Value* the value stored with the key, nullptr if the key is not in the tree
+         */
+        const Value* search(const Key& key) const;
+
+        /**
+         * @brief Remove a key (one of its copies, if inserted more than once) from the tree
+         *
+         * @param key the key to remove
+         * @return true if the key was in the tree
+         */
+        bool remove(const Key& key);
+
+        /**
+         * @brief Visit in order the entries with lo <= key <= hi, walking the linked leaves
+         *
+         * @param lo the lower bound of the range
+         * @param hi the upper bound of the range
+         * @param visit called as visit(key, value) for every entry in the range
+         */
+        template <typename F>
+        void rangeScan(const Key& lo, const Key& hi, F visit) const;
+};
+
+#include "../definitions/BPlusTree.inl"
+
+#endif
@@ -0,0 +1,171 @@
+/**
+ * @file BPlusTreeNode.hpp
+ * @brief Implementation of the nodes of a B+ Tree and of their in-node key search
+ * @version 1.0
+ * @date 2023-01-17
+ *
+ * @copyright Copyright (c) 2023
+*/
+
+#ifndef __BPLUSTREENODE_HPP__
+#define __BPLUSTREENODE_HPP__
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief This template class finds the position of a key inside a node (generic version)
+ *
+ * @tparam Key the type of the keys
+ * @tparam Compare the comparator type
+ */
+template <typename Key, typename Compare>
+struct BPlusTreeKeys {
+    /**
+     * @brief Fill the unused slots of a node, nothing to do for the generic search
+     *
+     * @param keys the keys of the node
+     * @param from the first unused slot
+     * @param to one past the last slot
+     */
+    static inline void pad(Key*, unsigned int, unsigned int) {}
+
+    /**
+     * @brief Count the keys of a node that are less than key
+     *
+     * @param keys the sorted keys of the node
+     * @param count the number of keys
+     * @param key the key to search
+     * @param comp the comparator
+     * @return unsigned int the position of the first key not less than key
+     */
+    static inline unsigned int lowerBound(const Key* keys, unsigned int count, const Key& key, const Compare& comp) {
+        return static_cast<unsigned int>(std::lower_bound(keys, keys + count, key, comp) - keys);
+    }
+};
+
+/**
+ * @brief In-node search for 32-bit integer keys with SIMD compare and movemask
+ *
+ * @note the unused slots hold the maximum key, which is never less than the searched key, so every
+ * vector of the node can be compared without masking and the count of the set lanes is the position
+ */
+template <>
+struct BPlusTreeKeys<std::int32_t, std::less<std::int32_t>> {
+    static inline void pad(std::int32_t* keys, unsigned int from, unsigned int to) {
+        std::fill(keys + from, keys + to, std::numeric_limits<std::int32_t>::max());
+    }
+
+    static inline unsigned int lowerBound(const std::int32_t* keys, unsigned int count, const std::int32_t& key, const std::less<std::int32_t>&) {
+        unsigned int position{0};
+#if defined(__AVX2__)
+        const __m256i needle = _mm256_set1_epi32(key);
+        for (unsigned int i{0}; i < count; i += 8) {
+            __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i));
+            position += __builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(needle, block))));
+        }
+#elif defined(__SSE2__)
+        const __m128i needle = _mm_set1_epi32(key);
+        for (unsigned int i{0}; i < count; i += 4) {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i));
+            position += __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(needle, block))));
+        }
+#else
+        while (position < count && keys[position] < key) {
+            ++position;
+        }
+#endif
+        return position;
+    }
+};
+
+/**
+ * @brief In-node search for 64-bit integer keys with SIMD compare and movemask
+ *
+ * @note same padding scheme of the 32-bit version, the vector path needs AVX2 or SSE4.2
+ */
+template <>
+struct BPlusTreeKeys<std::int64_t, std::less<std::int64_t>> {
+    static inline void pad(std::int64_t* keys, unsigned int from, unsigned int to) {
+        std::fill(keys + from, keys + to, std::numeric_limits<std::int64_t>::max());
+    }
+
+    static inline unsigned int lowerBound(const std::int64_t* keys, unsigned int count, const std::int64_t& key, const std::less<std::int64_t>&) {
+        unsigned int position{0};
+#if defined(__AVX2__)
+        const __m256i needle = _mm256_set1_epi64x(key);
+        for (unsigned int i{0}; i < count; i += 4) {
+            __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i));
+            position += __builtin_popcount(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(needle, block))));
+        }
+#elif defined(__SSE4_2__)
+        const __m128i needle = _mm_set1_epi64x(key);
+        for (unsigned int i{0}; i < count; i += 2) {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i));
+            position += __builtin_popcount(_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(needle, block))));
+        }
+#else
+        while (position < count && keys[position] < key) {
+            ++position;
+        }
+#endif
+        return position;
+    }
+};
+
+/**
+ * @brief This class implements the part shared by the leaves and the internal nodes of a B+ Tree
+ *
+ * @note the key array is rounded up to a multiple of 8 slots, so the SIMD search never reads
+ * past its end; a node holds at most Fanout - 1 keys, the last slot is used while splitting
+ *
+ * @tparam Key the type of the keys
+ * @tparam Fanout the maximum number of children of an internal node
+ */
+template <typename Key, unsigned int Fanout>
+struct BPlusTreeNode {
+    static const unsigned int Capacity = (Fanout + 7) / 8 * 8;
+
+    bool leaf;
+    unsigned int count{0};
+    Key keys[Capacity];
+
+    BPlusTreeNode(bool leaf) : leaf{leaf} {}
+};
+
+/**
+ * @brief This class implements an internal node of a B+ Tree, children[i] holds the keys up to keys[i]
+ *
+ * @tparam Key the type of the keys
+ * @tparam Fanout the maximum number of children
+ */
+template <typename Key, unsigned int Fanout>
+struct BPlusTreeInternal : public BPlusTreeNode<Key, Fanout> {
+    BPlusTreeNode<Key, Fanout>* children[BPlusTreeNode<Key, Fanout>::Capacity + 1];
+
+    BPlusTreeInternal() : BPlusTreeNode<Key, Fanout>(false) {}
+};
+
+/**
+ * @brief This class implements a leaf of a B+ Tree, linked to its neighbours for range scans
+ *
+ * @tparam Key the type of the keys
+ * @tparam Value the type of the values, default constructible
+ * @tparam Fanout the maximum number of entries plus one
+ */
+template <typename Key, typename Value, unsigned int Fanout>
+struct BPlusTreeLeaf : public BPlusTreeNode<Key, Fanout> {
+    Value values[BPlusTreeNode<Key, Fanout>::Capacity];
+    BPlusTreeLeaf* prev{nullptr};
+    BPlusTreeLeaf* next{nullptr};
+
+    BPlusTreeLeaf() : BPlusTreeNode<Key, Fanout>(true) {}
+};
+
+#endif // __BPLUSTREENODE_HPP__
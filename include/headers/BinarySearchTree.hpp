@@ -11,53 +11,166 @@
 #ifndef __BINARYSEARCHTREE_HPP__
 #define __BINARYSEARCHTREE_HPP__
 
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
 #include <string>
+#include <vector>
 #include "TreeNode.hpp"
 #include "TreeNodeObject.hpp"
 
 /**
  * @brief This class implements a Binary Search Tree 
  * 
- * @tparam CMP the compare function to use
+ * @tparam Key the type of the keys
+ * @tparam Value the type of the values stored with the keys
+ * @tparam Compare the comparator type, a strict weak ordering on Key (stateless or stateful)
+ * @tparam Alloc the allocator used for the nodes, rebound to the node type (e.g. SlabAllocator)
+ * @tparam Node the type of the nodes, set by the subclasses
  */
-
-template <bool CMP(const int& key1, const int& key2)>
+template <typename Key, typename Value, typename Compare = std::less<Key>, typename Alloc = std::allocator<TreeNode<Key, Value>>, typename Node = TreeNode<Key, Value>>
 class BinarySearchTree {
     typedef unsigned int uint;
 
     protected:
-        sptr_TreeNode root{nullptr};
-        sptr_TreeNode nullValue{nullptr};
-        uint numOfNodes{0};
-
-        void insert(sptr_TreeNode&& node);
-        void insert(sptr_TreeNodeObject&& obj);
-        sptr_TreeNode search(sptr_TreeNode root, int key) const;
-        sptr_TreeNode minimum(const sptr_TreeNode& root) const;
-        sptr_TreeNode maximum(const sptr_TreeNode& root) const;
-        uint findNumLeaves(const sptr_TreeNode& root) const;
-        void transplant(const sptr_TreeNode& curr_node, sptr_TreeNode&& new_node);
+        typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Node> NodeAllocator;
+        typedef std::allocator_traits<NodeAllocator> NodeAllocatorTraits;
+        typedef typename Node::Augmentation Augmentation;
+
+        Compare comp;
+        NodeAllocator nodeAllocator;
+        ptr_TreeNode<Key, Value> root{nullptr};
+        ptr_TreeNode<Key, Value> nullValue{nullptr};
+        mutable uint numOfNodes{0};
+        mutable bool countStale{false}; // set by split, which cannot count the nodes of the two halves in logarithmic time
+
+        struct NodeBlock {
+            Node* nodes;
+            std::size_t size;
+            std::size_t live;
+        };
+        // the finger: the last inserted node with its in-order neighbours (nullValue past the ends), so that a key
+        // falling between them is linked without any search; dropped when one of them leaves the tree
+        ptr_TreeNode<Key, Value> finger{nullptr};
+        ptr_TreeNode<Key, Value> fingerPrev{nullptr};
+        ptr_TreeNode<Key, Value> fingerNext{nullptr};
+        bool fingerValid{false};
+
+        std::vector<std::shared_ptr<NodeBlock>> blocks; // nodes allocated together by a bulk build, sorted by address, each block is freed with its last node; shared by the trees split from one another
+
+        static const uint FINGER_CLIMB = 4; // a key outside the neighbours of the finger is searched from it only if this close
+        static const uint REBUILD_RATIO = 8; // a batch of at least numOfNodes / REBUILD_RATIO keys is merged by relinking the whole tree
+
+        void insert(ptr_TreeNode<Key, Value> node);
+        void insertNear(ptr_TreeNode<Key, Value> hint, ptr_TreeNode<Key, Value> node, uint maxClimb = ~0u);
+        void linkAtFinger(ptr_TreeNode<Key, Value> node);
+        inline void resetFinger();
+        inline void forgetNode(ptr_TreeNode<Key, Value> node);
+        ptr_TreeNode<Key, Value> search(ptr_TreeNode<Key, Value> root, const Key& key) const;
+        ptr_TreeNode<Key, Value> minimum(ptr_TreeNode<Key, Value> root) const;
+        ptr_TreeNode<Key, Value> maximum(ptr_TreeNode<Key, Value> root) const;
+        uint findNumLeaves(ptr_TreeNode<Key, Value> root) const;
+        void transplant(ptr_TreeNode<Key, Value> curr_node, ptr_TreeNode<Key, Value> new_node);
+        ptr_TreeNode<Key, Value> unlink(ptr_TreeNode<Key, Value> node);
+        template <typename... Args> Node* createNode(Args&&... args);
+        void destroyNode(ptr_TreeNode<Key, Value> node);
+        static bool beforeBlock(Node* node, const std::shared_ptr<NodeBlock>& block);
+        uint destroySubtree(ptr_TreeNode<Key, Value> node);
+        sptr_TreeNodeObject shareObject(TreeNodeObject* obj);
+        template <typename Iterator, typename Annotate> void buildBalanced(Iterator first, std::size_t n, Annotate annotate);
+        template <typename Annotate> void relinkBalanced(const std::vector<Node*>& nodes, Annotate annotate);
+        template <typename Annotate> ptr_TreeNode<Key, Value> linkBalanced(const std::vector<Node*>& nodes, std::size_t lo, std::size_t hi, uint depth, uint lastLevel, int& height, Annotate& annotate);
+        std::vector<Node*> collectNodes() const;
+        void sortBatch(std::vector<std::pair<Key, Value>>& batch) const;
+        template <typename Annotate> bool mergeBatch(std::vector<std::pair<Key, Value>>& batch, Annotate annotate);
+        template <typename Annotate> bool mergeRemoveBatch(std::vector<Key>& keys, Annotate annotate);
+        static void keepShape(Node*, uint, int, uint, int) {}
+        void takeNodes(BinarySearchTree& other);
+        void requireSameAllocator(const BinarySearchTree& other) const;
+        inline void updateNode(ptr_TreeNode<Key, Value> node);
+        void updatePath(ptr_TreeNode<Key, Value> node);
+        uint countLess(const Key& key, bool orEqual) const;
 
     public:
+        /**
+         * @brief Bidirectional iterator over the nodes in key order, moving along the parent links (no stack,
+         * no allocation); end() is the null value of the tree, and decrementing it gives the maximum
+         * 
+         * @note valid while its node is in the tree and the tree is not moved
+         */
+        class iterator {
+            friend class BinarySearchTree;
+
+            private:
+                const BinarySearchTree* tree{nullptr};
+                ptr_TreeNode<Key, Value> node{nullptr};
+
+                iterator(const BinarySearchTree* tree, ptr_TreeNode<Key, Value> node) : tree{tree}, node{node} {}
+
+            public:
+                typedef std::bidirectional_iterator_tag iterator_category;
+                typedef Node value_type;
+                typedef std::ptrdiff_t difference_type;
+                typedef Node* pointer;
+                typedef Node& reference;
+
+                iterator() = default;
+
+                inline reference operator*() const { return *static_cast<Node*>(node); }
+                inline pointer operator->() const { return static_cast<Node*>(node); }
+                inline pointer getNode() const { return static_cast<Node*>(node); }
+
+                inline iterator& operator++() { node = tree->successor(node); return *this; }
+                inline iterator operator++(int) { iterator old = *this; ++*this; return old; }
+                inline iterator& operator--() { node = (node == tree->nullValue) ? tree->maximum() : tree->predecessor(node); return *this; }
+                inline iterator operator--(int) { iterator old = *this; --*this; return old; }
+
+                inline bool operator==(const iterator& other) const { return node == other.node; }
+                inline bool operator!=(const iterator& other) const { return node != other.node; }
+        };
+        typedef iterator const_iterator;
+
         /**
          * @brief Construct a new empty Binary Tree object
          * 
+         * @param comp the comparator of the keys
+         * @param alloc the allocator for the nodes
          */
-        BinarySearchTree();
+        explicit BinarySearchTree(const Compare& comp = Compare(), const Alloc& alloc = Alloc());
 
         /**
          * @brief Construct a new Binary Tree object with defined root
          * 
-         * @param root root of the new Binary Tree
+         * @param root root of the new Binary Tree, the tree takes ownership of it
+         * @param comp the comparator of the keys
+         * @param alloc the allocator for the nodes, it must be able to free root
+         */
+        BinarySearchTree(ptr_TreeNode<Key, Value> root, const Compare& comp = Compare(), const Alloc& alloc = Alloc());
+
+        /**
+         * @brief Move the nodes of another tree into a new one
+         * 
+         * @param other the tree to move from, left empty
          */
+        BinarySearchTree(BinarySearchTree&& other);
+
+        BinarySearchTree(const BinarySearchTree&) = delete;
+        BinarySearchTree& operator=(const BinarySearchTree&) = delete;
 
-        BinarySearchTree(sptr_TreeNode root);
         /**
-         * @brief Destroy the Binary Tree object
+         * @brief Destroy the Binary Tree object, freeing every node
          * 
          */
-        ~BinarySearchTree();
+        virtual ~BinarySearchTree();
+
+        /**
+         * @brief Remove and free every node of the tree
+         * 
+         * @note iterative, so it does not overflow the stack on degenerate trees
+         */
+        void clear();
 
         /**
          * @brief Check if the tree has no nodes
@@ -76,53 +189,205 @@ class BinarySearchTree {
         /**
          * @brief Get the root of the tree
          * 
-         * @return sptr_TreeNode the root of the tree
+         * @return ptr_TreeNode<Key, Value> the root of the tree
+         */
+        inline ptr_TreeNode<Key, Value> getRoot() const;
+
+        /**
+         * @brief Insert a key and a copy of its value in the tree
+         * 
+         * @param key the key to insert
+         * @param value the value stored with the key
          */
-        inline sptr_TreeNode getRoot() const;
+        void insert(const Key& key, const Value& value);
+
+        /**
+         * @brief Insert a key and its value in the tree, moving the value into the node
+         * 
+         * @param key the key to insert
+         * @param value the value stored with the key
+         */
+        void insert(const Key& key, Value&& value);
+
+        /**
+         * @brief Insert a key building its value directly inside the new node
+         * 
+         * @note the node is the only allocation of the insertion
+         * @param key the key to insert
+         * @param args the arguments forwarded to the constructor of the value
+         * @return ptr_TreeNode<Key, Value> the new node
+         */
+        template <typename... Args>
+        ptr_TreeNode<Key, Value> emplace(const Key& key, Args&&... args);
 
         /**
          * @brief Insert a TreeNodeObject in the tree (pointer version)
          * 
-         * @param obj the object to insert
+         * @note only for trees whose values are sptr_TreeNodeObject, the key is the one of the object
+         * @param obj the object to insert, the tree takes ownership of it
          */
         void insert(TreeNodeObject* obj);
 
         /**
-         * @brief Remove a node from the tree
+         * @brief Insert a key building its value inside the new node, searching its place from a node near it
          * 
-         * @param node the node to remove
-         * @return sptr_TreeNode the child of the node that was actually removed, if it exists, the parent otherwise
+         * @note the search climbs from hint only until the key falls inside the subtree, then descends: O(1) for
+         * a key next to hint, O(log d) for a key d positions away
+         * @param hint a node of the tree, the null value of the tree to search from the root
+         * @param key the key to insert
+         * @param args the arguments forwarded to the constructor of the value
+         * @return ptr_TreeNode<Key, Value> the new node
          */
-        sptr_TreeNode remove(sptr_TreeNode node);
+        template <typename... Args>
+        ptr_TreeNode<Key, Value> emplaceHint(ptr_TreeNode<Key, Value> hint, const Key& key, Args&&... args);
+
+        /**
+         * @brief Insert a TreeNodeObject in the tree, searching its place from a node near it (pointer version)
+         * 
+         * @note only for trees whose values are sptr_TreeNodeObject, the key is the one of the object
+         * @param hint a node of the tree, the null value of the tree to search from the root
+         * @param obj the object to insert, the tree takes ownership of it
+         * @return ptr_TreeNode<Key, Value> the new node
+         */
+        ptr_TreeNode<Key, Value> insert(ptr_TreeNode<Key, Value> hint, TreeNodeObject* obj);
+
+        /**
+         * @brief Insert a batch of keys and values in one coordinated pass
+         * 
+         * @note the batch is sorted, then every key is inserted starting from the node of the previous one
+         * instead of the root; a batch large compared to the tree is merged with the nodes of the tree,
+         * which are relinked into a balanced tree
+         * @param batch the (key, value) pairs to insert, in any order
+         */
+        void insertBatch(std::vector<std::pair<Key, Value>> batch);
+
+        /**
+         * @brief Insert a batch of TreeNodeObjects in one coordinated pass (pointer version)
+         * 
+         * @note only for trees whose values are sptr_TreeNodeObject, the tree takes ownership of the objects
+         * @param objects the objects to insert, in any order
+         */
+        void insertBatch(const std::vector<TreeNodeObject*>& objects);
+
+        /**
+         * @brief Remove a node from the tree and free it
+         * 
+         * @param node the node to remove, invalid after the call
+         */
+        void remove(ptr_TreeNode<Key, Value> node);
+
+        /**
+         * @brief Remove a key (one of its copies, if inserted more than once) and free its node
+         * 
+         * @param key the key to remove
+         * @return true if the key was in the tree
+         */
+        bool erase(const Key& key);
+
+        /**
+         * @brief Remove every node with lo <= key <= hi, in O(k + h) for k removed nodes in a tree of height h
+         * 
+         * @note the nodes in the range are dropped with their subtrees while descending the two boundary paths,
+         * the kept parts of the subtrees of the first node in the range are chained and hung in its place
+         * @param lo the lower bound of the range
+         * @param hi the upper bound of the range
+         * @return uint the number of nodes removed
+         */
+        uint eraseRange(const Key& lo, const Key& hi);
+
+        /**
+         * @brief Remove a batch of keys in one coordinated pass, one node for every occurrence of a key in the batch
+         * 
+         * @note a batch large compared to the tree is removed with a single in-order walk, relinking the
+         * remaining nodes into a balanced tree
+         * @param keys the keys to remove, in any order, keys not in the tree are ignored
+         */
+        void removeBatch(std::vector<Key> keys);
 
         /**
          * @brief Search for a node in the tree
          * 
          * @param key the key to search
         */
-        inline sptr_TreeNode search(int key) const;
+        inline ptr_TreeNode<Key, Value> search(const Key& key) const;
 
         /**
          * @brief Find the successor of a node
          * 
          * @param node the node to find the successor
-         * @return sptr_TreeNode the successor of the node
+         * @return ptr_TreeNode<Key, Value> the successor of the node
         */
-        sptr_TreeNode successor(sptr_TreeNode node) const;
+        ptr_TreeNode<Key, Value> successor(ptr_TreeNode<Key, Value> node) const;
+
+        /**
+         * @brief Find the predecessor of a node
+         * 
+         * @param node the node to find the predecessor
+         * @return ptr_TreeNode<Key, Value> the predecessor of the node, the null value of the tree for the minimum
+        */
+        ptr_TreeNode<Key, Value> predecessor(ptr_TreeNode<Key, Value> node) const;
+
+        /**
+         * @brief Get an iterator to the node with the smallest key
+         * 
+         * @return iterator the first node in key order, end() if the tree is empty
+         */
+        iterator begin() const;
+
+        /**
+         * @brief Get the iterator past the node with the greatest key
+         * 
+         * @return iterator the end of the tree
+         */
+        inline iterator end() const;
+
+        /**
+         * @brief Find the first node whose key is not less than key, in O(log n)
+         * 
+         * @param key the key to search
+         * @return iterator the first node with key <= its key, end() if there is none
+         */
+        iterator lower_bound(const Key& key) const;
+
+        /**
+         * @brief Find the first node whose key is greater than key, in O(log n)
+         * 
+         * @param key the key to search
+         * @return iterator the first node with key < its key, end() if there is none
+         */
+        iterator upper_bound(const Key& key) const;
+
+        /**
+         * @brief Find the range of the nodes with a key equivalent to key
+         * 
+         * @param key the key to search
+         * @return std::pair<iterator, iterator> lower_bound(key) and upper_bound(key)
+         */
+        std::pair<iterator, iterator> equal_range(const Key& key) const;
+
+        /**
+         * @brief Visit in order the nodes with lo <= key <= hi, in O(log n + k) without recursion nor allocation
+         * 
+         * @param lo the lower bound of the range
+         * @param hi the upper bound of the range
+         * @param visit called as visit(key, value) for every node in the range
+         */
+        template <typename F>
+        void forEachInRange(const Key& lo, const Key& hi, F visit) const;
 
         /**
          * @brief Find minumum node in the tree
          * 
-         * @return sptr_TreeNode the minimum node
+         * @return ptr_TreeNode<Key, Value> the minimum node
         */
-        inline sptr_TreeNode minimum() const;
+        inline ptr_TreeNode<Key, Value> minimum() const;
 
         /**
          * @brief Find maximum node in the tree
          * 
-         * @return sptr_TreeNode the maximum node
+         * @return ptr_TreeNode<Key, Value> the maximum node
         */  
-        inline sptr_TreeNode maximum() const;
+        inline ptr_TreeNode<Key, Value> maximum() const;
 
         /**
          * @brief Calculate the number of leaves in the tree
@@ -131,23 +396,70 @@ class BinarySearchTree {
          */
         inline uint findNumLeaves() const;
 
+        /**
+         * @brief Count the keys less than key, in O(log n)
+         * 
+         * @note only for nodes augmented with their subtree size (e.g. SubtreeSize)
+         * @param key the key to rank
+         * @return uint the position that key would take in the sorted keys
+         */
+        uint rank(const Key& key) const;
+
+        /**
+         * @brief Find the node with the k-th smallest key, in O(log n)
+         * 
+         * @note only for nodes augmented with their subtree size (e.g. SubtreeSize)
+         * @param index the position of the node in the sorted keys, from 0
+         * @return ptr_TreeNode<Key, Value> the node, the null value of the tree if index is not less than the number of nodes
+         */
+        ptr_TreeNode<Key, Value> select(uint index) const;
+
+        /**
+         * @brief Count the keys in [lo, hi], in O(log n)
+         * 
+         * @note only for nodes augmented with their subtree size (e.g. SubtreeSize)
+         * @param lo the lower bound of the range
+         * @param hi the upper bound of the range
+         * @return uint the number of keys not less than lo and not greater than hi
+         */
+        uint countInRange(const Key& lo, const Key& hi) const;
+
+        /**
+         * @brief Combine the monoid over the nodes with lo <= key <= hi, in key order, in O(log n)
+         * 
+         * @note only for nodes augmented with a monoid (MonoidAugmentation)
+         * @param lo the lower bound of the range
+         * @param hi the upper bound of the range
+         * @return A::Type the aggregate of the range, the identity of the monoid if it is empty
+         */
+        template <typename A = Augmentation>
+        typename A::Type aggregate(const Key& lo, const Key& hi) const;
+
+        /**
+         * @brief Change the value of a node, recomputing the aggregates that depend on it
+         * 
+         * @param node the node to change
+         * @param value the new value
+         */
+        void updateValue(ptr_TreeNode<Key, Value> node, const Value& value);
+
         /**
          * @brief Walk the tree in preorder
          * 
          */
-        virtual void preorder_walk(const sptr_TreeNode& node) const final;
+        virtual void preorder_walk(ptr_TreeNode<Key, Value> node) const final;
 
         /**
          * @brief Walk the tree in inorder
          * 
          */
-        virtual void inorder_walk(const sptr_TreeNode& node) const final;
+        virtual void inorder_walk(ptr_TreeNode<Key, Value> node) const final;
 
         /**
          * @brief Walk the tree in postorder
          * 
          */
-        virtual void postorder_walk(const sptr_TreeNode& node) const final;
+        virtual void postorder_walk(ptr_TreeNode<Key, Value> node) const final;
 
         /**
          * @brief Print the tree
@@ -157,7 +469,7 @@ class BinarySearchTree {
 
 
     private:
-        void prettyPrint(const std::string& prefix, const sptr_TreeNode node, bool isLeft) const;
+        void prettyPrint(const std::string& prefix, ptr_TreeNode<Key, Value> node, bool isLeft) const;
         
 };
 
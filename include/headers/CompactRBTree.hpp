@@ -0,0 +1,88 @@
+/**
+ * @file CompactRBTree.hpp
+ * @brief Implementation and management of a Red-Black Tree stored in a node pool
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef COMPACT_RB_TREE_HPP
+#define COMPACT_RB_TREE_HPP
+
+#include "CompactTree.hpp"
+#include "RBTreeNode.hpp"
+
+/**
+ * @brief This template class implements the Red-Black algorithm on a CompactTree
+ * 
+ * @note the color of a node is kept in its tag (1 for black), the nil node is black
+ * 
+ * @tparam Key the type of the keys, default constructible
+ * @tparam Value the type of the values stored with the keys, default constructible
+ * @tparam Compare the comparator type, a strict weak ordering on Key
+ * @tparam Alloc the allocator used for the node pool
+ */
+template <typename Key, typename Value, typename Compare = std::less<Key>, typename Alloc = std::allocator<CompactTreeNode<Key, Value>>>
+class CompactRBTree : public CompactTree<Key, Value, Compare, Alloc> {
+    protected:
+        void insert(CompactIndex node);
+        inline RBColor getColor(CompactIndex node) const;
+        inline void setColor(CompactIndex node, RBColor color);
+        void insFixUp(CompactIndex node);
+        void delFixUp(CompactIndex node);
+
+    public:
+        /**
+         * @brief Construct a new empty Compact Red-Black Tree
+         * 
+         * @param comp the comparator of the keys
+         * @param alloc the allocator for the node pool
+         */
+        explicit CompactRBTree(const Compare& comp = Compare(), const Alloc& alloc = Alloc());
+
+        /**
+         * @brief Insert a key and a copy of its value in the tree
+         * 
+         * @param key the key to insert
+         * @param value the value stored with the key
+         */
+        void insert(const Key& key, const Value& value);
+
+        /**
+         * @brief Insert a key and its value in the tree, moving the value into the node
+         * 
+         * @param key the key to insert
+         * @param value the value stored with the key
+         */
+        void insert(const Key& key, Value&& value);
+
+        /**
+         * @brief Insert a key building its value directly inside the new node
+         * 
+         * @param key the key to insert
+         * @param args the arguments forwarded to the constructor of the value
+         * @return CompactIndex the new node
+         */
+        template <typename... Args>
+        CompactIndex emplace(const Key& key, Args&&... args);
+
+        /**
+         * @brief Insert a TreeNodeObject in the tree (pointer version)
+         * 
+         * @note only for trees whose values are sptr_TreeNodeObject, the key is the one of the object
+         * @param node the TreeNodeObject to insert, the tree takes ownership of it
+         */
+        void insert(TreeNodeObject* node);
+
+        /**
+         * @brief Remove a node from the tree, its slot is reused by the next insertions
+         * 
+         * @param node the node to remove, invalid after the call
+        */
+        void remove(CompactIndex node);
+};
+
+#include "../definitions/CompactRBTree.inl"
+
+#endif
@@ -0,0 +1,164 @@
+/**
+ * @file CompactTree.hpp
+ * @brief Implementation and management of a Binary Search Tree stored in a node pool
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef __COMPACTTREE_HPP__
+#define __COMPACTTREE_HPP__
+
+#include <functional>
+#include <memory>
+#include <vector>
+#include "CompactTreeNode.hpp"
+#include "TreeNodeObject.hpp"
+
+/**
+ * @brief This template class implements the common part of the compact trees
+ * 
+ * @note Nodes live in a single vector and are linked by 32-bit indices: the tree holds up to
+ * 2^32 - 1 nodes, handles stay valid when the pool grows, and the pool is relocatable (and, for
+ * trivially copyable keys and values, serializable as raw memory). Index 0 is the nil node,
+ * removed nodes are recycled through a free list.
+ * 
+ * @tparam Key the type of the keys, default constructible (the nil node holds a default key)
+ * @tparam Value the type of the values stored with the keys, default constructible
+ * @tparam Compare the comparator type, a strict weak ordering on Key
+ * @tparam Alloc the allocator used for the node pool
+ */
+template <typename Key, typename Value, typename Compare = std::less<Key>, typename Alloc = std::allocator<CompactTreeNode<Key, Value>>>
+class CompactTree {
+    typedef unsigned int uint;
+
+    protected:
+        typedef CompactTreeNode<Key, Value> Node;
+        typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Node> NodeAllocator;
+
+        Compare comp;
+        std::vector<Node, NodeAllocator> pool;
+        CompactIndex root{0};
+        CompactIndex freeList{0};
+        uint numOfNodes{0};
+
+        void insert(CompactIndex node);
+        CompactIndex search(CompactIndex root, const Key& key) const;
+        CompactIndex minimum(CompactIndex root) const;
+        CompactIndex maximum(CompactIndex root) const;
+        void transplant(CompactIndex curr_node, CompactIndex new_node);
+        void unlink(CompactIndex node);
+        void rotateLeft(CompactIndex node);
+        void rotateRight(CompactIndex node);
+        template <typename... Args> CompactIndex createNode(const Key& key, Args&&... args);
+        void destroyNode(CompactIndex node);
+
+    public:
+        /**
+         * @brief Construct a new empty Compact Tree
+         * 
+         * @param comp the comparator of the keys
+         * @param alloc the allocator for the node pool
+         */
+        explicit CompactTree(const Compare& comp = Compare(), const Alloc& alloc = Alloc());
+
+        /**
+         * @brief Check if the tree has no nodes
+         * 
+         * @return true if there are no nodes
+         */
+        inline bool isEmpty() const;
+
+        /**
+         * @brief Get the number of nodes
+         * 
+         * @return uint the number of nodes
+         */
+        inline uint getNumOfNodes() const;
+
+        /**
+         * @brief Get the root of the tree
+         * 
+         * @return CompactIndex the root of the tree, nil if the tree is empty
+         */
+        inline CompactIndex getRoot() const;
+
+        /**
+         * @brief Get the nil node of the tree, returned when a node does not exist
+         * 
+         * @return CompactIndex the nil node (always 0)
+         */
+        inline CompactIndex getNil() const;
+
+        /**
+         * @brief Get the key of a node
+         * 
+         * @param node the node
+         * @return const Key& the key of the node
+         */
+        inline const Key& getKey(CompactIndex node) const;
+
+        /**
+         * @brief Get the value stored in a node
+         * 
+         * @param node the node
+         * @return Value& the value stored in the node
+         */
+        inline Value& getValue(CompactIndex node);
+
+        /**
+         * @brief Get the value stored in a node
+         * 
+         * @param node the node
+         * @return const Value& the value stored in the node
+         */
+        inline const Value& getValue(CompactIndex node) const;
+
+        /**
+         * @brief Reserve room in the pool for a number of nodes
+         * 
+         * @param numOfNodes the number of nodes
+         */
+        void reserve(uint numOfNodes);
+
+        /**
+         * @brief Remove every node of the tree
+         * 
+         */
+        void clear();
+
+        /**
+         * @brief Search for a node in the tree
+         * 
+         * @param key the key to search
+         * @return CompactIndex the node, nil if the key is not in the tree
+        */
+        inline CompactIndex search(const Key& key) const;
+
+        /**
+         * @brief Find the successor of a node
+         * 
+         * @param node the node to find the successor
+         * @return CompactIndex the successor of the node, nil if it is the maximum
+        */
+        CompactIndex successor(CompactIndex node) const;
+
+        /**
+         * @brief Find minumum node in the tree
+         * 
+         * @return CompactIndex the minimum node
+        */
+        inline CompactIndex minimum() const;
+
+        /**
+         * @brief Find maximum node in the tree
+         * 
+         * @return CompactIndex the maximum node
+        */
+        inline CompactIndex maximum() const;
+};
+
+#include "../definitions/CompactTree.inl"
+
+#endif // __COMPACTTREE_HPP__
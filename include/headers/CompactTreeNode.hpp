@@ -0,0 +1,49 @@
+/**
+ * @file CompactTreeNode.hpp
+ * @brief Implementation of a TreeNode linked by 32-bit indices
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+*/
+
+#ifndef __CompactTreeNode_HPP__
+#define __CompactTreeNode_HPP__
+
+#include <cstdint>
+#include <utility>
+
+/**
+ * @brief Index of a node in the pool of a compact tree, 0 is the nil node
+ */
+typedef std::uint32_t CompactIndex;
+
+/**
+ * @brief This class implements a node of a compact tree
+ * 
+ * @note the links are indices in the node pool of the tree, so with int keys and values a node
+ * takes 24 bytes (32 with pointer links) and the whole pool can be moved or copied as a block
+ * 
+ * @tparam Key the type of the key
+ * @tparam Value the type of the value stored with the key
+ */
+template <typename Key, typename Value>
+struct CompactTreeNode {
+    CompactIndex left{0};
+    CompactIndex right{0}; // next free node when the node is in the free list
+    CompactIndex parent{0};
+    std::uint8_t tag{0}; // AVL balance + 1 or RB color, depending on the tree
+    Key key;
+    Value value;
+
+    /**
+     * @brief Construct a new Compact Tree Node, building its value in place
+     * 
+     * @param key the key of the node
+     * @param args the arguments forwarded to the constructor of the value
+     */
+    template <typename... Args>
+    CompactTreeNode(const Key& key, Args&&... args) : key(key), value(std::forward<Args>(args)...) {}
+};
+
+#endif // __CompactTreeNode_HPP__
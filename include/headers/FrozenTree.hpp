@@ -0,0 +1,102 @@
+/**
+ * @file FrozenTree.hpp
+ * @brief Implementation of a read-only snapshot of a tree in Eytzinger layout
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef __FROZENTREE_HPP__
+#define __FROZENTREE_HPP__
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+/**
+ * @brief This template class implements a read-only copy of a search tree for lookup-heavy workloads
+ * 
+ * @note the keys are stored in a flat array in BFS (Eytzinger) order: the children of position k
+ * are 2k and 2k + 1, so the descent is index arithmetic without branches and the keys of the next
+ * levels are prefetched while the current one is compared. The values live in a parallel array, so
+ * the keys stay densely packed. Position 0 is unused and means "not found".
+ * 
+ * @tparam Key the type of the keys, copy constructible
+ * @tparam Value the type of the values, copy constructible
+ * @tparam Compare the comparator type, a strict weak ordering on Key
+ */
+template <typename Key, typename Value, typename Compare = std::less<Key>>
+class FrozenTree {
+    typedef unsigned int uint;
+
+    protected:
+        Compare comp;
+        std::vector<Key> keys;
+        std::vector<Value> values;
+        uint numOfNodes{0};
+
+        template <typename T_NODE>
+        void fill(std::vector<T_NODE>& nodes, uint& next, uint position);
+
+    public:
+        /**
+         * @brief Build the snapshot of a tree
+         * 
+         * @note works with BinarySearchTree, AVLTree and RBTree, the tree is left untouched
+         * @param tree the tree to copy, walked in order through minimum() and successor()
+         * @param comp the comparator of the keys, it must order the keys as the one of the tree
+         */
+        template <typename T>
+        explicit FrozenTree(const T& tree, const Compare& comp = Compare());
+
+        /**
+         * @brief Get the number of nodes
+         * 
+         * @return uint the number of nodes
+         */
+        inline uint getNumOfNodes() const;
+
+        /**
+         * @brief Get the position returned when a key is not found
+         * 
+         * @return uint the nil position (always 0)
+         */
+        inline uint getNil() const;
+
+        /**
+         * @brief Get the key at a position
+         * 
+         * @param position a position returned by search or lower_bound
+         * @return const Key& the key at the position
+         */
+        inline const Key& getKey(uint position) const;
+
+        /**
+         * @brief Get the value at a position
+         * 
+         * @param position a position returned by search or lower_bound
+         * @return const Value& the value at the position
+         */
+        inline const Value& getValue(uint position) const;
+
+        /**
+         * @brief Find the first key not less than key
+         * 
+         * @param key the key to search
+         * @return uint the position of the key, nil if every key is less than key
+         */
+        inline uint lower_bound(const Key& key) const;
+
+        /**
+         * @brief Search for a key
+         * 
+         * @param key the key to search
+         * @return uint the position of the key, nil if the key is not in the tree
+         */
+        inline uint search(const Key& key) const;
+};
+
+#include "../definitions/FrozenTree.inl"
+
+#endif // __FROZENTREE_HPP__
@@ -0,0 +1,156 @@
+/**
+ * @file IntervalTree.hpp
+ * @brief Implementation and management of an Interval Tree built on a Red-Black Tree
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+ */
+#ifndef __INTERVAL_TREE_HPP__
+#define __INTERVAL_TREE_HPP__
+
+#include "RBTree.hpp"
+
+/**
+ * @brief The value stored in the nodes of an Interval Tree: the high endpoint of the interval (the low one is
+ * the key) and the value of the user
+ * 
+ * @tparam Point the type of the endpoints
+ * @tparam Value the type of the values stored with the intervals
+ */
+template <typename Point, typename Value>
+struct IntervalData {
+    Point high{};
+    Value value{};
+
+    IntervalData() = default;
+    IntervalData(const Point& high, const Value& value) : high(high), value(value) {}
+    IntervalData(const Point& high, Value&& value) : high(high), value(std::move(value)) {}
+};
+
+/**
+ * @brief Monoid of the greatest high endpoint of the intervals of a subtree, the lowest value of Point when
+ * there are none
+ * 
+ * @tparam Point the type of the endpoints, with std::numeric_limits
+ * @tparam Value the type of the values stored with the intervals
+ */
+template <typename Point, typename Value>
+struct MaxEndpoint {
+    typedef Point Type;
+
+    static inline Point identity() { return std::numeric_limits<Point>::lowest(); }
+    static inline Point combine(const Point& a, const Point& b) { return (a < b) ? b : a; }
+    static inline Point lift(const Point&, const IntervalData<Point, Value>& data) { return data.high; }
+};
+
+/**
+ * @brief This template class implements an Interval Tree: a Red-Black Tree of closed intervals [low, high]
+ * ordered by low endpoint, where every node keeps the greatest high endpoint of its subtree
+ * 
+ * @note the greatest endpoint is a MonoidAugmentation, so the tree recomputes it along the insertion and removal
+ * paths and in the rotations of the fixups; a query skips every subtree whose greatest endpoint is before the
+ * range and stops at the first low endpoint after it, reporting k intervals in O(k log n) (O(log n) per interval,
+ * O(log n) when there are none) without allocating
+ * 
+ * @tparam Point the type of the endpoints, ordered by operator< and with std::numeric_limits
+ * @tparam Value the type of the values stored with the intervals, default constructible
+ * @tparam Alloc the allocator used for the nodes
+ */
+template <typename Point, typename Value, typename Alloc = std::allocator<RBTreeNode<Point, IntervalData<Point, Value>>>>
+class IntervalTree : public RBTree<Point, IntervalData<Point, Value>, std::less<Point>, Alloc, MonoidAugmentation<MaxEndpoint<Point, Value>>> {
+    typedef MonoidAugmentation<MaxEndpoint<Point, Value>> Augment;
+    typedef RBTree<Point, IntervalData<Point, Value>, std::less<Point>, Alloc, Augment> Tree;
+
+    private:
+        template <typename F>
+        void overlapSubtree(ptr_RBTreeNode<Point, IntervalData<Point, Value>, Augment> node, const Point& lo, const Point& hi, F& report) const;
+        ptr_RBTreeNode<Point, IntervalData<Point, Value>, Augment> findSubtree(ptr_RBTreeNode<Point, IntervalData<Point, Value>, Augment> node, const Point& low, const Point& high) const;
+
+    public:
+        /**
+         * @brief Construct a new empty IntervalTree object
+         * 
+         * @param alloc the allocator for the nodes
+         */
+        explicit IntervalTree(const Alloc& alloc = Alloc());
+
+        /**
+         * @brief Move the nodes of another IntervalTree into a new one
+         * 
+         * @param other the tree to move from, left empty
+         */
+        IntervalTree(IntervalTree&& other) = default;
+
+        using Tree::remove;
+
+        /**
+         * @brief Insert the interval [low, high] and a copy of its value
+         * 
+         * @param low the low endpoint of the interval
+         * @param high the high endpoint of the interval, not less than low
+         * @param value the value stored with the interval
+         * @return ptr_RBTreeNode<Point, IntervalData<Point, Value>, Augment> the new node
+         */
+        ptr_RBTreeNode<Point, IntervalData<Point, Value>, Augment> insert(const Point& low, const Point& high, const Value& value);
+
+        /**
+         * @brief Insert the interval [low, high] moving its value into the node
+         * 
+         * @param low the low endpoint of the interval
+         * @param high the high endpoint of the interval, not less than low
+         * @param value the value stored with the interval
+         * @return ptr_RBTreeNode<Point, IntervalData<Point, Value>, Augment> the new node
+         */
+        ptr_RBTreeNode<Point, IntervalData<Point, Value>, Augment> insert(const Point& low, const Point& high, Value&& value);
+
+        /**
+         * @brief Remove an interval [low, high] (one of its copies, if inserted more than once)
+         * 
+         * @param low the low endpoint of the interval
+         * @param high the high endpoint of the interval
+         * @return true if the interval was in the tree
+         */
+        bool remove(const Point& low, const Point& high);
+
+        /**
+         * @brief Find an interval [low, high]
+         * 
+         * @param low the low endpoint of the interval
+         * @param high the high endpoint of the interval
+         * @return ptr_RBTreeNode<Point, IntervalData<Point, Value>, Augment> its node, nil if it is not in the tree
+         */
+        ptr_RBTreeNode<Point, IntervalData<Point, Value>, Augment> find(const Point& low, const Point& high) const;
+
+        /**
+         * @brief Report the intervals containing a point, by increasing low endpoint
+         * 
+         * @param point the point to stab
+         * @param report called as report(low, high, value) for every interval with low <= point <= high
+         */
+        template <typename F>
+        void stab(const Point& point, F report) const;
+
+        /**
+         * @brief Report the intervals overlapping the closed range [lo, hi], by increasing low endpoint
+         * 
+         * @param lo the low endpoint of the range
+         * @param hi the high endpoint of the range
+         * @param report called as report(low, high, value) for every interval with low <= hi and lo <= high
+         */
+        template <typename F>
+        void overlap(const Point& lo, const Point& hi, F report) const;
+
+        /**
+         * @brief Check if some interval overlaps the closed range [lo, hi], in O(log n)
+         * 
+         * @param lo the low endpoint of the range
+         * @param hi the high endpoint of the range
+         * @return true if an interval has low <= hi and lo <= high
+         */
+        bool overlaps(const Point& lo, const Point& hi) const;
+};
+
+#include "../definitions/IntervalTree.inl"
+
+#endif // __INTERVAL_TREE_HPP__
@@ -0,0 +1,101 @@
+/**
+ * @file PathRBTree.hpp
+ * @brief Implementation and management of a Red-Black Tree without parent links
+ * @version 1.0
+ * @date 2023-01-17
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef PATH_RB_TREE_HPP
+#define PATH_RB_TREE_HPP
+
+#include "PathTree.hpp"
+#include "RBTreeNode.hpp"
+
+/**
+ * @brief This template class implements the Red-Black algorithm on a PathTree
+ *
+ * @note the color of a node is kept in its tag (1 for black, a new node is red), a missing child is black;
+ * the fix up after an update climbs the Path recorded by the descent
+ *
+ * @tparam Key the type of the keys
+ * @tparam Value the type of the values stored with the keys
+ * @tparam Compare the comparator type, a strict weak ordering on Key
+ * @tparam Alloc the allocator used for the nodes
+ */
+template <typename Key, typename Value, typename Compare = std::less<Key>, typename Alloc = std::allocator<PathTreeNode<Key, Value>>>
+class PathRBTree : public PathTree<Key, Value, Compare, Alloc> {
+    protected:
+        typedef typename PathTree<Key, Value, Compare, Alloc>::Node Node;
+        typedef typename PathTree<Key, Value, Compare, Alloc>::Path Path;
+
+        void insert(Node* node);
+        void removeAt(Path& path);
+        inline RBColor getColor(const Node* node) const;
+        inline void setColor(Node* node, RBColor color);
+        void delFixUp(Path& path, int level, bool fromLeft);
+
+    public:
+        /**
+         * @brief Construct a new empty Path Red-Black Tree
+         *
+         * @param comp the comparator of the keys
+         * @param alloc the allocator for the nodes
+         */
+        explicit PathRBTree(const Compare& comp = Compare(), const Alloc& alloc = Alloc());
+
+        /**
+         * @brief Insert a key and a copy of its value in the tree
+         *
+         * @param key the key to insert
+         * @param value the value stored with the key
+         */
+        void insert(const Key& key, const Value& value);
+
+        /**
+         * @brief Insert a key and its value in the tree, moving the value into the node
+         *
+         * @param key the key to insert
+         * @param value the value stored with the key
+         */
+        void insert(const Key& key, Value&& value);
+
+        /**
+         * @brief Insert a key building its value directly inside the new node
+         *
+         * @param key the key to insert
+         * @param args the arguments forwarded to the constructor of the value
+         * @return Node* the new node
+         */
+        template <typename... Args>
+        Node* emplace(const Key& key, Args&&... args);
+
+        /**
+         * @brief Insert a TreeNodeObject in the tree (pointer version)
+         *
+         * @note only for trees whose values are sptr_TreeNodeObject, the key is the one of the object
+         * @param node the TreeNodeObject to insert, the tree takes ownership of it
+         */
+        void insert(TreeNodeObject* node);
+
+        /**
+         * @brief Remove a node from the tree and free it
+         *
+         * @note the path to the node is found again from the root by its key
+         * @param node the node to remove, invalid after the call
+        */
+        void remove(Node* node);
+
+        /**
+         * @brief Remove a key (one of its copies, if inserted more than once) from the tree
+         *
+         * @param key the key to remove
+         * @return true if the key was in the tree
+         */
+        bool remove(const Key& key);
+};
+
+#include "../definitions/PathRBTree.inl"
+
+#endif
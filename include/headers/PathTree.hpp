@@ -0,0 +1,229 @@
+/**
+ * @file PathTree.hpp
+ * @brief Implementation and management of a Binary Search Tree without parent links
+ * @version 1.0
+ * @date 2023-01-17
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef __PATHTREE_HPP__
+#define __PATHTREE_HPP__
+
+#include <functional>
+#include <iterator>
+#include <memory>
+#include "PathTreeNode.hpp"
+#include "TreeNodeObject.hpp"
+
+/**
+ * @brief This template class implements the common part of the path trees
+ *
+ * @note the nodes have no parent link: every update records the nodes from the root down in a Path, a
+ * fixed-size stack, and the rebalancing walks the stack back up. A rotation rewrites the two links that
+ * actually change (plus the one of the parent), not the parent links of the nodes moved around, and the
+ * nodes are 8 bytes smaller. Iterators carry their own Path, a successor costs O(1) amortized.
+ *
+ * @tparam Key the type of the keys
+ * @tparam Value the type of the values stored with the keys
+ * @tparam Compare the comparator type, a strict weak ordering on Key
+ * @tparam Alloc the allocator used for the nodes
+ */
+template <typename Key, typename Value, typename Compare = std::less<Key>, typename Alloc = std::allocator<PathTreeNode<Key, Value>>>
+class PathTree {
+    typedef unsigned int uint;
+
+    protected:
+        typedef PathTreeNode<Key, Value> Node;
+        typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Node> NodeAllocator;
+
+    public:
+        // a balanced tree with less than 2^32 nodes is at most 64 levels deep (2 log2(n + 1) for a Red-Black Tree)
+        static const uint MAX_DEPTH = 64;
+
+        /**
+         * @brief The nodes from the root to the last one, nodes[0] is the root
+         */
+        struct Path {
+            Node* nodes[MAX_DEPTH];
+            uint depth{0};
+
+            inline void push(Node* node) { nodes[depth++] = node; }
+            inline Node* top() const { return nodes[depth - 1]; }
+            void advance();
+        };
+
+        /**
+         * @brief Forward iterator over the nodes in key order, keeping the path to the current node
+         *
+         * @note any insertion or removal invalidates the iterators of the tree
+         */
+        class iterator {
+            Path path;
+
+            friend class PathTree;
+
+            public:
+                typedef std::forward_iterator_tag iterator_category;
+                typedef Node value_type;
+                typedef std::ptrdiff_t difference_type;
+                typedef Node* pointer;
+                typedef Node& reference;
+
+                iterator() {}
+
+                inline Node& operator*() const { return *path.top(); }
+                inline Node* operator->() const { return path.top(); }
+                inline Node* getNode() const { return (path.depth == 0) ? nullptr : path.top(); }
+
+                iterator& operator++();
+                inline iterator operator++(int) { iterator copy = *this; ++(*this); return copy; }
+                inline bool operator==(const iterator& other) const { return getNode() == other.getNode(); }
+                inline bool operator!=(const iterator& other) const { return getNode() != other.getNode(); }
+        };
+        typedef iterator const_iterator;
+
+    protected:
+        Compare comp;
+        NodeAllocator allocator;
+        Node* root{nullptr};
+        uint numOfNodes{0};
+
+        void descend(const Key& key, Path& path) const;
+        void link(Path& path, Node* node);
+        void lowerBound(const Key& key, Path& path) const;
+        bool findPath(Node* node, Path& path) const;
+        void replaceChild(const Path& path, uint level, Node* child);
+        Node* rotateLeft(Node* node);
+        Node* rotateRight(Node* node);
+        template <typename... Args> Node* createNode(const Key& key, Args&&... args);
+        void destroyNode(Node* node);
+        void clear(Node* node);
+
+    public:
+        /**
+         * @brief Construct a new empty Path Tree
+         *
+         * @param comp the comparator of the keys
+         * @param alloc the allocator for the nodes
+         */
+        explicit PathTree(const Compare& comp = Compare(), const Alloc& alloc = Alloc());
+
+        /**
+         * @brief The tree owns its nodes, so it cannot be copied
+         *
+         */
+        PathTree(const PathTree&) = delete;
+        PathTree& operator=(const PathTree&) = delete;
+
+        /**
+         * @brief Move the nodes of another Path Tree into a new one
+         *
+         * @param other the tree to move from, left empty
+         */
+        PathTree(PathTree&& other);
+
+        /**
+         * @brief Destroy the Path Tree and free its nodes
+         *
+         */
+        ~PathTree();
+
+        /**
+         * @brief Free every node of the tree, leaving it empty
+         *
+         */
+        void clear();
+
+        /**
+         * @brief Check if the tree has no nodes
+         *
+         * @return true if there are no nodes
+         */
+        inline bool isEmpty() const;
+
+        /**
+         * @brief Get the number of nodes
+         *
+         * @return uint the number of nodes
+         */
+        inline uint getNumOfNodes() const;
+
+        /**
+         * @brief Get the root of the tree
+         *
+         * @return Node* the root of the tree, nullptr if the tree is empty
+         */
+        inline Node* getRoot() const;
+
+        /**
+         * @brief Get the nil node of the tree, returned when a node does not exist
+         *
+         * @return Node* the nil node (always nullptr)
+         */
+        inline Node* getNil() const;
+
+        /**
+         * @brief Search for a node in the tree
+         *
+         * @param key the key to search
+         * @return Node* the node, nullptr if the key is not in the tree
+        */
+        Node* search(const Key& key) const;
+
+        /**
+         * @brief Find the successor of a node
+         *
+         * @note the node is found again from the root, O(log n): walk the tree with an iterator instead
+         * @param node the node to find the successor
+         * @return Node* the successor of the node, nullptr if it is the maximum
+        */
+        Node* successor(Node* node) const;
+
+        /**
+         * @brief Find minumum node in the tree
+         *
+         * @return Node* the minimum node, nullptr if the tree is empty
+        */
+        Node* minimum() const;
+
+        /**
+         * @brief Find maximum node in the tree
+         *
+         * @return Node* the maximum node, nullptr if the tree is empty
+        */
+        Node* maximum() const;
+
+        /**
+         * @brief Get an iterator to the minimum node
+         *
+         * @return iterator the first node in key order, end() if the tree is empty
+         */
+        iterator begin() const;
+
+        /**
+         * @brief Get the iterator past the maximum node
+         *
+         * @return iterator the end of the tree
+         */
+        inline iterator end() const { return iterator(); }
+
+        /**
+         * @brief Get an iterator to the first node whose key is not less than a key
+         *
+         * @param key the key to search
+         * @return iterator the first node with key >= key, end() if there is none
+         */
+        iterator lower_bound(const Key& key) const;
+
+        /**
+         * @brief Get the number of levels, 0 for an empty tree
+         *
+         * @return uint the number of levels
+         */
+        uint getHeight() const;
+};
+
+#include "../definitions/PathTree.inl"
+
+#endif // __PATHTREE_HPP__
@@ -0,0 +1,68 @@
+/**
+ * @file PathTreeNode.hpp
+ * @brief Implementation of a TreeNode without the parent link
+ * @version 1.0
+ * @date 2023-01-17
+ *
+ * @copyright Copyright (c) 2023
+*/
+
+#ifndef __PathTreeNode_HPP__
+#define __PathTreeNode_HPP__
+
+#include <cstdint>
+#include <utility>
+
+/**
+ * @brief This class implements a node of a path tree, linked only to its children
+ *
+ * @note the trees walk the nodes with an explicit stack of the path from the root, so a node keeps no
+ * parent link: the two low bits of the right link hold the tag (AVL balance + 1 or RB color) and with
+ * int keys and values a node takes 24 bytes (32 for a TreeNode)
+ *
+ * @tparam Key the type of the key
+ * @tparam Value the type of the value stored with the key
+ */
+template <typename Key, typename Value>
+class PathTreeNode {
+    protected:
+        static const std::uintptr_t TAG_MASK = 3;
+
+        PathTreeNode* left{nullptr};
+        std::uintptr_t right{0}; // right child pointer | tag
+        Key key;
+        Value value;
+
+    public:
+        /**
+         * @brief Construct a new Path Tree Node, building its value in place
+         *
+         * @param key the key of the node
+         * @param args the arguments forwarded to the constructor of the value
+         */
+        template <typename... Args>
+        PathTreeNode(const Key& key, Args&&... args) : key(key), value(std::forward<Args>(args)...) {}
+
+        inline const Key& getKey() const { return key; }
+        inline const Value& getValue() const { return value; }
+        inline Value& getValue() { return value; }
+        inline PathTreeNode* getLeft() const { return left; }
+        inline PathTreeNode* getRight() const { return reinterpret_cast<PathTreeNode*>(right & ~TAG_MASK); }
+        inline unsigned getTag() const { return right & TAG_MASK; }
+
+        inline void setLeft(PathTreeNode* left) { this->left = left; }
+
+        /**
+         * @brief Set the right child of the node, the tag of the node is kept
+         *
+         * @param right the new right child of the node
+         */
+        inline void setRight(PathTreeNode* right) { this->right = reinterpret_cast<std::uintptr_t>(right) | getTag(); }
+
+        inline void setTag(unsigned tag) { right = (right & ~TAG_MASK) | tag; }
+};
+
+template <typename Key, typename Value>
+using ptr_PathTreeNode = PathTreeNode<Key, Value>*;
+
+#endif // __PathTreeNode_HPP__
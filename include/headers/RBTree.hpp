@@ -12,102 +12,345 @@
 #include "RBTreeNode.hpp"
 #include "BinarySearchTree.hpp"
 #include "SelfBalancingTree.hpp"
+#include "SetOperations.hpp"
 
 /**
  * @brief This template class implements a Self-Balancing Binary Search Tree using the Red-Black algorithm
  * 
- * @tparam CMP the compare function to use
+ * @tparam Key the type of the keys, default constructible (the nil node holds a default key)
+ * @tparam Value the type of the values stored with the keys, default constructible
+ * @tparam Compare the comparator type, a strict weak ordering on Key
+ * @tparam Alloc the allocator used for the nodes
+ * @tparam Augment the information kept in the nodes about their subtrees, SubtreeSize for the order statistics
  */
-template <bool CMP(const int& key1, const int& key2)>
-class RBTree : public SelfBalancingTree<CMP> {
+template <typename Key, typename Value, typename Compare = std::less<Key>, typename Alloc = std::allocator<RBTreeNode<Key, Value>>, typename Augment = NoAugmentation>
+class RBTree : public SelfBalancingTree<Key, Value, Compare, Alloc, RBTreeNode<Key, Value, Augment>> {
     private:
-        sptr_RBTreeNode nil;
-        void prettyPrint(const std::string& prefix, const sptr_RBTreeNode node, bool isLeft) const;
-        bool insFixUpRedUncle(sptr_RBTreeNode& node);
-        bool insFixUpBlackUncleLeft(sptr_RBTreeNode& node);
-        bool insFixUpBlackUncleRight(sptr_RBTreeNode& node);
-        void delFixUpRight(sptr_RBTreeNode& node);
-        void delFixUpLeft(sptr_RBTreeNode& node);
-        void removeWithTwoChildren(sptr_RBTreeNode& node, sptr_RBTreeNode& tmp, sptr_RBTreeNode& tmp2, RBTreeNode::Color& tmpOriginalColor);
+        ptr_RBTreeNode<Key, Value, Augment> nil;
+        void prettyPrint(const std::string& prefix, ptr_RBTreeNode<Key, Value, Augment> node, bool isLeft) const;
+        bool insFixUpRedUncle(ptr_RBTreeNode<Key, Value, Augment>& node);
+        bool insFixUpBlackUncleLeft(ptr_RBTreeNode<Key, Value, Augment>& node);
+        bool insFixUpBlackUncleRight(ptr_RBTreeNode<Key, Value, Augment>& node);
+        void delFixUpRight(ptr_RBTreeNode<Key, Value, Augment>& node, ptr_RBTreeNode<Key, Value, Augment>& parent);
+        void delFixUpLeft(ptr_RBTreeNode<Key, Value, Augment>& node, ptr_RBTreeNode<Key, Value, Augment>& parent);
+        void removeWithTwoChildren(ptr_RBTreeNode<Key, Value, Augment>& node, ptr_RBTreeNode<Key, Value, Augment>& tmp, ptr_RBTreeNode<Key, Value, Augment>& tmp2, ptr_RBTreeNode<Key, Value, Augment>& tmp2Parent, RBColor& tmpOriginalColor);
+        static ptr_RBTreeNode<Key, Value, Augment> sharedNil();
     
     protected:
-        void insert(sptr_RBTreeNode&& node); 
-        void insert(sptr_TreeNodeObject&& obj);
-        sptr_RBTreeNode minimum(sptr_RBTreeNode root) const;
-        sptr_RBTreeNode maximum(sptr_RBTreeNode root) const;
-        void transplant(sptr_RBTreeNode curr_node, sptr_RBTreeNode new_node);
-        void insFixUp(sptr_RBTreeNode node);
-        void delFixUp(sptr_RBTreeNode node);
-        void rotateLeft(sptr_RBTreeNode node);
-        void rotateRight(sptr_RBTreeNode node);
+        void insert(ptr_RBTreeNode<Key, Value, Augment> node); 
+        void fixAfterInsert(ptr_RBTreeNode<Key, Value, Augment> node);
+        static void annotateBalanced(RBTreeNode<Key, Value, Augment>* node, unsigned int depth, int balance, unsigned int lastLevel, int height);
+        ptr_RBTreeNode<Key, Value, Augment> minimum(ptr_RBTreeNode<Key, Value, Augment> root) const;
+        ptr_RBTreeNode<Key, Value, Augment> maximum(ptr_RBTreeNode<Key, Value, Augment> root) const;
+        void transplant(ptr_RBTreeNode<Key, Value, Augment> curr_node, ptr_RBTreeNode<Key, Value, Augment> new_node);
+        bool insFixUp(ptr_RBTreeNode<Key, Value, Augment> node);
+        void delFixUp(ptr_RBTreeNode<Key, Value, Augment> node, ptr_RBTreeNode<Key, Value, Augment> parent);
+        void detach(ptr_RBTreeNode<Key, Value, Augment> node);
+        unsigned int blackHeight(ptr_RBTreeNode<Key, Value, Augment> node) const;
+        ptr_RBTreeNode<Key, Value, Augment> joinSubtrees(ptr_RBTreeNode<Key, Value, Augment> left, unsigned int leftHeight, ptr_RBTreeNode<Key, Value, Augment> pivot, ptr_RBTreeNode<Key, Value, Augment> right, unsigned int rightHeight, unsigned int& height);
+        void splitSubtree(ptr_RBTreeNode<Key, Value, Augment> node, unsigned int nodeHeight, const Key& key, ptr_RBTreeNode<Key, Value, Augment>& left, unsigned int& leftHeight, ptr_RBTreeNode<Key, Value, Augment>& right, unsigned int& rightHeight, ptr_RBTreeNode<Key, Value, Augment>* found = nullptr);
+        unsigned int subtreeRank(ptr_RBTreeNode<Key, Value, Augment> node) const;
+        void expose(ptr_RBTreeNode<Key, Value, Augment> node, unsigned int nodeHeight, ptr_RBTreeNode<Key, Value, Augment>& left, unsigned int& leftHeight, ptr_RBTreeNode<Key, Value, Augment>& right, unsigned int& rightHeight) const;
+        ptr_RBTreeNode<Key, Value, Augment> join2Subtrees(ptr_RBTreeNode<Key, Value, Augment> left, unsigned int leftHeight, ptr_RBTreeNode<Key, Value, Augment> right, unsigned int rightHeight, unsigned int& height);
+        RBTree workspace() const;
+        friend class SetOperations<RBTree, RBTreeNode<Key, Value, Augment>, unsigned int>;
+        void join(ptr_RBTreeNode<Key, Value, Augment> pivot, RBTree& right);
+        void rotateLeft(ptr_RBTreeNode<Key, Value, Augment> node);
+        void rotateRight(ptr_RBTreeNode<Key, Value, Augment> node);
 
     public:
         /**
          * @brief Construct a new empty RedBlackTree object
          * 
+         * @param comp the comparator of the keys
+         * @param alloc the allocator for the nodes
          */
-        RBTree();
+        explicit RBTree(const Compare& comp = Compare(), const Alloc& alloc = Alloc());
 
         /**
-         * @brief Construct a new RedBlackTree object from a TreeNodeObject
+         * @brief Construct a new RedBlackTree object with defined root
          * 
+         * @param root root of the new RedBlackTree, the tree takes ownership of it
+         * @param comp the comparator of the keys
+         * @param alloc the allocator for the nodes, it must be able to free root
          */
-        RBTree(sptr_RBTreeNode root);
+        RBTree(ptr_RBTreeNode<Key, Value, Augment> root, const Compare& comp = Compare(), const Alloc& alloc = Alloc());
 
         /**
-         * @brief Destroy the RedBlackTree.
+         * @brief Move the nodes of another RedBlackTree into a new one
+         * 
+         * @param other the tree to move from, left empty
+         */
+        RBTree(RBTree&& other);
+
+        /**
+         * @brief Build a perfectly balanced Red-Black Tree from sorted pairs in linear time
+         * 
+         * @note no comparisons nor fixups: the nodes are allocated in one block, linked by halving the
+         * range, and only the deepest level (the one that may be incomplete) is colored red
+         * @param first the first (key, value) pair, pairs must be sorted by key according to comp
+         * @param last one past the last pair
+         * @param comp the comparator of the keys
+         * @param alloc the allocator for the nodes
+         * @return RBTree the new tree
+         */
+        template <typename Iterator>
+        static RBTree buildFromSorted(Iterator first, Iterator last, const Compare& comp = Compare(), const Alloc& alloc = Alloc());
+
+        /**
+         * @brief Join two Red-Black Trees through a new pivot node in O(log n)
+         * 
+         * @note the pivot is hung, red, on the spine of the tree with the greater black height where the
+         * black heights match, then the tree is fixed as after an insertion; the trees must have equal allocators,
+         * otherwise std::invalid_argument is thrown and both trees are left untouched
+         * @param left the tree with the smaller keys, left empty
+         * @param key the key of the pivot, not less than the keys of left and not greater than the keys of right
+         * @param value the value stored with the pivot
+         * @param right the tree with the greater keys, left empty
+         * @return RBTree the joined tree, with the comparator and the allocator of left
+         */
+        static RBTree join(RBTree&& left, const Key& key, Value value, RBTree&& right);
+
+        /**
+         * @brief Join two Red-Black Trees in O(log n), the minimum of right becomes the pivot
+         * 
+         * @note the trees must have equal allocators, std::invalid_argument otherwise
+         * @param left the tree with the smaller keys, left empty
+         * @param right the tree with the greater keys, left empty
+         * @return RBTree the joined tree, with the comparator and the allocator of left
+         */
+        static RBTree join(RBTree&& left, RBTree&& right);
+
+        /**
+         * @brief Split the tree at a key in O(log n), moving its nodes into two new trees
+         * 
+         * @note the subtrees hanging from the search path are blackened and joined back bottom up; the
+         * node counts of the halves are computed on the first call to getNumOfNodes
+         * @param key the key where the tree is split
+         * @return std::pair<RBTree, RBTree> the tree of the keys less than key and the tree of the others,
+         * this tree is left empty
+         */
+        std::pair<RBTree, RBTree> split(const Key& key);
+
+        /**
+         * @brief The union of two trees, in O(m log(n/m + 1)) work for trees of m <= n keys
+         * 
+         * @note the keys are treated as sets: the nodes of both trees are relinked into the result and, for a
+         * key in both, the one of first is kept; the trees must have equal allocators, std::invalid_argument otherwise
+         * @param first the first tree, left empty
+         * @param second the second tree, left empty
+         * @return RBTree the union, with the comparator and the allocator of first
+         */
+        static RBTree setUnion(RBTree&& first, RBTree&& second);
+
+        /**
+         * @brief The union of two trees, combining disjoint subtrees in parallel on a thread pool
+         * 
+         * @param first the first tree, left empty
+         * @param second the second tree, left empty
+         * @param pool the pool running the recursion
+         * @return RBTree the union, with the comparator and the allocator of first
+         */
+        static RBTree setUnion(RBTree&& first, RBTree&& second, ThreadPool& pool);
+
+        /**
+         * @brief The intersection of two trees, with the values of first
+         * 
+         * @param first the first tree, left empty
+         * @param second the second tree, left empty
+         * @return RBTree the intersection, with the comparator and the allocator of first
+         */
+        static RBTree setIntersection(RBTree&& first, RBTree&& second);
+
+        /**
+         * @brief The intersection of two trees, combining disjoint subtrees in parallel on a thread pool
+         * 
+         * @param first the first tree, left empty
+         * @param second the second tree, left empty
+         * @param pool the pool running the recursion
+         * @return RBTree the intersection, with the comparator and the allocator of first
+         */
+        static RBTree setIntersection(RBTree&& first, RBTree&& second, ThreadPool& pool);
+
+        /**
+         * @brief The keys of first that are not in second
+         * 
+         * @param first the first tree, left empty
+         * @param second the second tree, left empty
+         * @return RBTree the difference, with the comparator and the allocator of first
+         */
+        static RBTree setDifference(RBTree&& first, RBTree&& second);
+
+        /**
+         * @brief The keys of first that are not in second, combining disjoint subtrees in parallel on a thread pool
+         * 
+         * @param first the first tree, left empty
+         * @param second the second tree, left empty
+         * @param pool the pool running the recursion
+         * @return RBTree the difference, with the comparator and the allocator of first
+         */
+        static RBTree setDifference(RBTree&& first, RBTree&& second, ThreadPool& pool);
+
+        /**
+         * @brief Destroy the RedBlackTree, freeing every node
         */
         ~RBTree();
 
         /**
          * @brief Get the root of the tree
          * 
-         * @return sptr_RBTreeNode the root of the tree
+         * @return ptr_RBTreeNode<Key, Value, Augment> the root of the tree
          */
-        sptr_RBTreeNode getRoot() const;
+        ptr_RBTreeNode<Key, Value, Augment> getRoot() const;
 
         /**
          * @brief Get the nil node of the tree
          * 
-         * @return sptr_RBTreeNode the nil node of the tree
+         * @return ptr_RBTreeNode<Key, Value, Augment> the nil node of the tree
          */
-        sptr_RBTreeNode getNil() const;
+        ptr_RBTreeNode<Key, Value, Augment> getNil() const;
+
+        /**
+         * @brief Insert a key and a copy of its value in the tree
+         * 
+         * @param key the key to insert
+         * @param value the value stored with the key
+         */
+        void insert(const Key& key, const Value& value);
+
+        /**
+         * @brief Insert a key and its value in the tree, moving the value into the node
+         * 
+         * @param key the key to insert
+         * @param value the value stored with the key
+         */
+        void insert(const Key& key, Value&& value);
+
+        /**
+         * @brief Insert a key building its value directly inside the new node
+         * 
+         * @note the node is the only allocation of the insertion
+         * @param key the key to insert
+         * @param args the arguments forwarded to the constructor of the value
+         * @return ptr_RBTreeNode<Key, Value, Augment> the new node
+         */
+        template <typename... Args>
+        ptr_RBTreeNode<Key, Value, Augment> emplace(const Key& key, Args&&... args);
 
         /**
          * @brief Insert a TreeNodeObject in the tree 
          * 
-         * @param obj pointer to the TreeNodeObject to insert
+         * @note only for trees whose values are sptr_TreeNodeObject, the key is the one of the object
+         * @param obj pointer to the TreeNodeObject to insert, the tree takes ownership of it
          */
         void insert(TreeNodeObject* obj);
 
         /**
-         * @brief Remove a node from the tree
+         * @brief Insert a key building its value inside the new node, searching its place from a node near it
+         * 
+         * @note the search climbs from hint only until the key falls inside the subtree, then descends: O(1) for
+         * a key next to hint, O(log d) for a key d positions away, then the tree is fixed as after any insertion
+         * @param hint a node of the tree, nil to search from the root
+         * @param key the key to insert
+         * @param args the arguments forwarded to the constructor of the value
+         * @return ptr_RBTreeNode<Key, Value, Augment> the new node
+         */
+        template <typename... Args>
+        ptr_RBTreeNode<Key, Value, Augment> emplaceHint(ptr_RBTreeNode<Key, Value, Augment> hint, const Key& key, Args&&... args);
+
+        /**
+         * @brief Insert a TreeNodeObject in the tree, searching its place from a node near it
+         * 
+         * @note only for trees whose values are sptr_TreeNodeObject, the key is the one of the object
+         * @param hint a node of the tree, nil to search from the root
+         * @param obj pointer to the TreeNodeObject to insert, the tree takes ownership of it
+         * @return ptr_RBTreeNode<Key, Value, Augment> the new node
+         */
+        ptr_RBTreeNode<Key, Value, Augment> insert(ptr_RBTreeNode<Key, Value, Augment> hint, TreeNodeObject* obj);
+
+        /**
+         * @brief Insert a batch of keys and values in one coordinated pass
+         * 
+         * @note the batch is sorted, then every key is inserted starting from the node of the previous one
+         * instead of the root; a batch large compared to the tree is merged with the nodes of the tree,
+         * which are relinked and recolored without fixups
+         * @param batch the (key, value) pairs to insert, in any order
+         */
+        void insertBatch(std::vector<std::pair<Key, Value>> batch);
+
+        /**
+         * @brief Insert a batch of TreeNodeObjects in one coordinated pass (pointer version)
+         * 
+         * @note only for trees whose values are sptr_TreeNodeObject, the tree takes ownership of the objects
+         * @param objects the objects to insert, in any order
+         */
+        void insertBatch(const std::vector<TreeNodeObject*>& objects);
+
+        /**
+         * @brief Remove a node from the tree and free it
          * 
-         * @param node pointer to the node to remove
+         * @param node pointer to the node to remove, invalid after the call
         */
-        void remove(sptr_RBTreeNode node);
+        void remove(ptr_RBTreeNode<Key, Value, Augment> node);
+
+        /**
+         * @brief Remove a key (one of its copies, if inserted more than once) and free its node
+         * 
+         * @param key the key to remove
+         * @return true if the key was in the tree
+         */
+        bool erase(const Key& key);
+
+        /**
+         * @brief Remove every node with lo <= key <= hi, in O(k + log n) for k removed nodes
+         * 
+         * @note the tree is split at lo and past hi, the middle subtree is freed whole and the two sides are
+         * joined back, so no node of the range is searched nor rebalanced on its own
+         * @param lo the lower bound of the range
+         * @param hi the upper bound of the range
+         * @return unsigned int the number of nodes removed
+         */
+        unsigned int eraseRange(const Key& lo, const Key& hi);
+
+        /**
+         * @brief Remove a batch of keys in one coordinated pass, one node for every occurrence of a key in the batch
+         * 
+         * @note a batch large compared to the tree is removed with a single in-order walk, relinking and
+         * recoloring the remaining nodes
+         * @param keys the keys to remove, in any order, keys not in the tree are ignored
+         */
+        void removeBatch(std::vector<Key> keys);
 
         /**
          * @brief Search a node in the tree
          * 
          * @param key key of the node to search
-         * @return sptr_RBTreeNode pointer to the node found
+         * @return ptr_RBTreeNode<Key, Value, Augment> pointer to the node found
+         */
+        ptr_RBTreeNode<Key, Value, Augment> search(const Key& key) const;
+
+        /**
+         * @brief Find the node with the k-th smallest key, in O(log n)
+         * 
+         * @note only for trees with Augment = SubtreeSize
+         * @param index the position of the node in the sorted keys, from 0
+         * @return ptr_RBTreeNode<Key, Value, Augment> the node, nil if index is not less than the number of nodes
          */
-        sptr_RBTreeNode search(int key);
+        ptr_RBTreeNode<Key, Value, Augment> select(unsigned int index) const;
 
         /**
          * @brief Get the minimum node of the tree
          * 
-         * @return sptr_RBTreeNode pointer to the minimum node
+         * @return ptr_RBTreeNode<Key, Value, Augment> pointer to the minimum node
          */
-        inline sptr_RBTreeNode minimum() const;
+        inline ptr_RBTreeNode<Key, Value, Augment> minimum() const;
 
         /**
          * @brief Get the maximum node of the tree
          * 
-         * @return sptr_RBTreeNode pointer to the maximum node
+         * @return ptr_RBTreeNode<Key, Value, Augment> pointer to the maximum node
          */
-        inline sptr_RBTreeNode maximum() const;
+        inline ptr_RBTreeNode<Key, Value, Augment> maximum() const;
 
         /**
          * @brief Print the tree
@@ -13,27 +13,37 @@
 #include "TreeNodeObject.hpp"
 #include "TreeNode.hpp"
 
+/**
+ * @brief This enum represents the color of a node
+ * 
+ * @note The color of a node is either RED or BLACK
+*/
+enum class RBColor {RED, BLACK};
+
 /**
  * @brief This class implements a TreeNode for a Red-Black Tree
+ * 
+ * @note the color is the low bit of the parent link, the node is as big as a TreeNode plus the Summary
+ * of Augment (nothing with the default NoAugmentation)
+ * 
+ * @tparam Key the type of the key
+ * @tparam Value the type of the value stored with the key
+ * @tparam Augment the information kept about the subtree of the node (see Augmentation.hpp)
 */
-class RBTreeNode : public TreeNode {
-    typedef std::shared_ptr<RBTreeNode> sptr_RBTreeNode;
-    
+template <typename Key, typename Value, typename Augment = NoAugmentation>
+class RBTreeNode : public TreeNode<Key, Value>, public Augment::Summary {
     public:
+        typedef RBColor Color;
+        typedef Augment Augmentation;
 
         /**
-         * @brief This enum represents the color of a node
-         * 
-         * @note The color of a node is either RED or BLACK
-        */
-        enum class Color {RED, BLACK};
-
-        /**
-         * @brief Construct a new RedBlackTreeNode
+         * @brief Construct a new RedBlackTreeNode, building its value in place
          * 
-         * @param obj object to store in the node
+         * @param key the key of the node
+         * @param args the arguments forwarded to the constructor of the value
         */
-        RBTreeNode(sptr_TreeNodeObject obj);
+        template <typename... Args>
+        RBTreeNode(const Key& key, Args&&... args);
 
         /**
          * @brief Destroy the RedBlackTreeNode 
@@ -41,52 +51,45 @@ class RBTreeNode : public TreeNode {
          */
         ~RBTreeNode() = default;
 
-        /**
-         * @brief Get the key of the node
-         * 
-         * @return int the key of the node
-        */
-        inline int getKey() const;
-
         /**
          * @brief Get the color of the node
          * 
-         * @return RBTreeNode::Color the color of the node
+         * @return RBColor the color of the node
         */
-        RBTreeNode::Color getColor() const;
+        RBColor getColor() const;
 
         /**
          * @brief Set the color of the node
          * 
          * @param color the new color of the node
         */
-        void setColor(RBTreeNode::Color color);
+        void setColor(RBColor color);
 
         /**
          * @brief Get the left child of the node
          * 
-         * @return sptr_RBTreeNode the left child of the node
+         * @return RBTreeNode* the left child of the node
          */
-        sptr_RBTreeNode getLeft() const;
+        RBTreeNode* getLeft() const;
 
         /**
          * @brief Get the right child of the node
          * 
-         * @return sptr_RBTreeNode the right child of the node
+         * @return RBTreeNode* the right child of the node
          */
-        sptr_RBTreeNode getRight() const;
+        RBTreeNode* getRight() const;
         
         /**
          * @brief Get the parent of the node
          * 
-         * @return sptr_RBTreeNode the parent of the node
+         * @return RBTreeNode* the parent of the node
          */
-        sptr_RBTreeNode getParent() const;
-        
-    private:
-        Color color{Color::RED};
+        RBTreeNode* getParent() const;
 };
 
-typedef std::shared_ptr<RBTreeNode> sptr_RBTreeNode;
+template <typename Key, typename Value, typename Augment = NoAugmentation>
+using ptr_RBTreeNode = RBTreeNode<Key, Value, Augment>*;
+
+#include "../definitions/RBTreeNode.inl"
 
-#endif // __RBTreeNode_HPP__
\ No newline at end of file
+#endif // __RBTreeNode_HPP__
@@ -0,0 +1,179 @@
+/**
+ * @file ScapegoatTree.hpp
+ * @brief Implementation and management of a Scapegoat Tree
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef SCAPEGOAT_TREE_HPP
+#define SCAPEGOAT_TREE_HPP
+
+#include "BinarySearchTree.hpp"
+
+/**
+ * @brief This template class implements a Self-Balancing Binary Search Tree using the Scapegoat algorithm
+ * (Galperin, Rivest) with alpha = 2/3
+ * 
+ * @note the nodes are plain TreeNodes, with no balance information: the tree only remembers its largest size
+ * since the last full rebuild. An insertion deeper than log_{3/2} of that size climbs to the first ancestor
+ * whose child holds more than 2/3 of its subtree (the scapegoat) and rebuilds that subtree perfectly balanced;
+ * a removal that leaves less than 2/3 of the largest size rebuilds the whole tree. The rebuilds flatten the
+ * subtree into a list threaded through the right links and relink it in place, in linear time and without
+ * allocating. The height stays below log_{3/2} n + 1, the updates take O(log n) amortized time
+ * 
+ * @tparam Key the type of the keys
+ * @tparam Value the type of the values stored with the keys
+ * @tparam Compare the comparator type, a strict weak ordering on Key
+ * @tparam Alloc the allocator used for the nodes
+ */
+template <typename Key, typename Value, typename Compare = std::less<Key>, typename Alloc = std::allocator<TreeNode<Key, Value>>>
+class ScapegoatTree : public BinarySearchTree<Key, Value, Compare, Alloc> {
+    typedef unsigned int uint;
+
+    protected:
+        uint maxNumOfNodes{0}; // the largest number of nodes since the last rebuild of the whole tree
+        uint depthLimit{0}; // floor(log_{3/2} maxNumOfNodes), the deepest depth allowed
+        double nextLimitSize{1.5}; // (3/2)^(depthLimit + 1), the size that allows one more level
+
+        void fixAfterInsert(ptr_TreeNode<Key, Value> node);
+        void fixAfterRemove();
+        void setMaxNumOfNodes(uint size);
+        unsigned int subtreeSize(ptr_TreeNode<Key, Value> node) const;
+        void rebuild(ptr_TreeNode<Key, Value> node, uint size);
+        ptr_TreeNode<Key, Value> flatten(ptr_TreeNode<Key, Value> node, ptr_TreeNode<Key, Value> next);
+        ptr_TreeNode<Key, Value> buildFromList(ptr_TreeNode<Key, Value>& head, uint size);
+
+    public:
+        /**
+         * @brief Construct a new empty Scapegoat Tree object
+         * 
+         * @param comp the comparator of the keys
+         * @param alloc the allocator for the nodes
+         */
+        explicit ScapegoatTree(const Compare& comp = Compare(), const Alloc& alloc = Alloc());
+
+        /**
+         * @brief Move the nodes of another Scapegoat Tree into a new one
+         * 
+         * @param other the tree to move from, left empty
+         */
+        ScapegoatTree(ScapegoatTree&& other) = default;
+
+        /**
+         * @brief Destroy the Scapegoat Tree
+         * 
+         */
+        ~ScapegoatTree();
+
+        /**
+         * @brief Insert a key and a copy of its value in the tree
+         * 
+         * @param key the key to insert
+         * @param value the value stored with the key
+         */
+        void insert(const Key& key, const Value& value);
+
+        /**
+         * @brief Insert a key and its value in the tree, moving the value into the node
+         * 
+         * @param key the key to insert
+         * @param value the value stored with the key
+         */
+        void insert(const Key& key, Value&& value);
+
+        /**
+         * @brief Insert a key building its value directly inside the new node
+         * 
+         * @param key the key to insert
+         * @param args the arguments forwarded to the constructor of the value
+         * @return ptr_TreeNode<Key, Value> the new node
+         */
+        template <typename... Args>
+        ptr_TreeNode<Key, Value> emplace(const Key& key, Args&&... args);
+
+        /**
+         * @brief Insert a TreeNodeObject in the tree (pointer version)
+         * 
+         * @note only for trees whose values are sptr_TreeNodeObject, the key is the one of the object
+         * @param node the TreeNodeObject to insert, the tree takes ownership of it
+         */
+        void insert(TreeNodeObject* node);
+
+        /**
+         * @brief Insert a key building its value inside the new node, searching its place from a node near it
+         * 
+         * @note the search climbs from hint only until the key falls inside the subtree, then descends
+         * @param hint a node of the tree, nullptr to search from the root
+         * @param key the key to insert
+         * @param args the arguments forwarded to the constructor of the value
+         * @return ptr_TreeNode<Key, Value> the new node
+         */
+        template <typename... Args>
+        ptr_TreeNode<Key, Value> emplaceHint(ptr_TreeNode<Key, Value> hint, const Key& key, Args&&... args);
+
+        /**
+         * @brief Insert a TreeNodeObject in the tree, searching its place from a node near it
+         * 
+         * @note only for trees whose values are sptr_TreeNodeObject, the key is the one of the object
+         * @param hint a node of the tree, nullptr to search from the root
+         * @param obj pointer to the TreeNodeObject to insert, the tree takes ownership of it
+         * @return ptr_TreeNode<Key, Value> the new node
+         */
+        ptr_TreeNode<Key, Value> insert(ptr_TreeNode<Key, Value> hint, TreeNodeObject* obj);
+
+        /**
+         * @brief Insert many (key, value) pairs at once
+         * 
+         * @note a batch large compared to the tree is merged relinking the whole tree balanced, a smaller one is
+         * inserted key by key, each from the previous one
+         * @param batch the pairs to insert, in any order
+         */
+        void insertBatch(std::vector<std::pair<Key, Value>> batch);
+
+        /**
+         * @brief Insert many TreeNodeObjects at once
+         * 
+         * @note only for trees whose values are sptr_TreeNodeObject, the tree takes ownership of the objects
+         * @param objects the objects to insert, in any order
+         */
+        void insertBatch(const std::vector<TreeNodeObject*>& objects);
+
+        /**
+         * @brief Remove a node from the tree and free it
+         * 
+         * @param node the node to remove, invalid after the call
+        */
+        void remove(ptr_TreeNode<Key, Value> node);
+
+        /**
+         * @brief Remove a key (one of its copies, if inserted more than once) and free its node
+         * 
+         * @param key the key to remove
+         * @return true if the key was in the tree
+         */
+        bool erase(const Key& key);
+
+        /**
+         * @brief Remove every key in the closed range [lo, hi] and free their nodes
+         * 
+         * @note the nodes are removed one at a time, in O(k log n) for k keys in the range
+         * @param lo the smallest key to remove
+         * @param hi the largest key to remove
+         * @return unsigned int the number of nodes removed
+         */
+        unsigned int eraseRange(const Key& lo, const Key& hi);
+
+        /**
+         * @brief Remove many keys at once, one copy each
+         * 
+         * @param keys the keys to remove, in any order
+         */
+        void removeBatch(std::vector<Key> keys);
+};
+
+
+#include "../definitions/ScapegoatTree.inl"
+
+#endif
@@ -16,26 +16,41 @@
 /**
  * @brief This template class implements a Self-Balancing Binary Search Tree
  * 
- * @tparam CMP the compare function to use
+ * @tparam Key the type of the keys
+ * @tparam Value the type of the values stored with the keys
+ * @tparam Compare the comparator type, a strict weak ordering on Key
+ * @tparam Alloc the allocator used for the nodes
+ * @tparam Node the type of the nodes, set by the subclasses
  */
-template <bool CMP(const int& key1, const int& key2)>
-class SelfBalancingTree : public BinarySearchTree<CMP> {
+template <typename Key, typename Value, typename Compare = std::less<Key>, typename Alloc = std::allocator<TreeNode<Key, Value>>, typename Node = TreeNode<Key, Value>>
+class SelfBalancingTree : public BinarySearchTree<Key, Value, Compare, Alloc, Node> {
     public:
         /**
          * @brief Construct a new empty Self Balancing Search Tree
          *
+         * @param comp the comparator of the keys
+         * @param alloc the allocator for the nodes
          */
-        SelfBalancingTree();
+        explicit SelfBalancingTree(const Compare& comp = Compare(), const Alloc& alloc = Alloc());
 
         /**
          * @brief Construct a new Binary Tree object with defined root
          *
          * @param root root of the new Binary Tree
+         * @param comp the comparator of the keys
+         * @param alloc the allocator for the nodes, it must be able to free root
          */
-        SelfBalancingTree(sptr_TreeNode root);
+        SelfBalancingTree(ptr_TreeNode<Key, Value> root, const Compare& comp = Compare(), const Alloc& alloc = Alloc());
 
         /**
-         * @brief Destroy the Self Balancing Search Tree object destroying every node first
+         * @brief Move the nodes of another tree into a new one
+         *
+         * @param other the tree to move from, left empty
+         */
+        SelfBalancingTree(SelfBalancingTree&& other) = default;
+
+        /**
+         * @brief Destroy the Self Balancing Search Tree object
          *
          */
         virtual ~SelfBalancingTree();
@@ -46,7 +61,7 @@ class SelfBalancingTree : public BinarySearchTree<CMP> {
          * @param curr_node node on which to perform the rotation
          *
          **/
-        void rotateLeft(sptr_TreeNode curr_node);
+        void rotateLeft(ptr_TreeNode<Key, Value> curr_node);
 
         /**
          * @brief Rotates the tree to the right
@@ -54,7 +69,7 @@ class SelfBalancingTree : public BinarySearchTree<CMP> {
          * @param curr_node node on which to perform the rotation
          *
          **/
-        void rotateRight(sptr_TreeNode curr_node);
+        void rotateRight(ptr_TreeNode<Key, Value> curr_node);
 };
 
 #include "../definitions/SelfBalancingTree.inl"
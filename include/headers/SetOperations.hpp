@@ -0,0 +1,78 @@
+/**
+ * @file SetOperations.hpp
+ * @brief Implementation of union, intersection and difference of balanced trees with join and split
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef SET_OPERATIONS_HPP
+#define SET_OPERATIONS_HPP
+
+#include <vector>
+#include "ThreadPool.hpp"
+
+/**
+ * @brief This template class implements the set operations of two balanced trees by divide and conquer:
+ * the second tree is exposed at its root, the first is split at the key of that root, the two halves
+ * are combined recursively (in parallel on a ThreadPool) and joined back through the root
+ * 
+ * @note the work is O(m log(n/m + 1)) for trees of m <= n keys, no node is allocated: the nodes of
+ * both trees are relinked into the result and the dropped ones are freed at the end, so the trees must have
+ * equal allocators (std::invalid_argument otherwise, before either tree is touched)
+ * 
+ * @tparam Tree the tree type, which provides subtreeRank, expose, splitSubtree, joinSubtrees, join2Subtrees and workspace
+ * @tparam Node the type of the nodes of Tree
+ * @tparam Rank the type of the balance rank of a subtree (the height for AVL, the black height for Red-Black)
+ */
+template <typename Tree, typename Node, typename Rank>
+class SetOperations {
+    public:
+        /**
+         * @brief The keys of either tree, the value of first is kept for the keys in both
+         * 
+         * @param first the first tree, left empty
+         * @param second the second tree, left empty
+         * @param pool the pool running the recursion in parallel, nullptr to run it in this thread
+         * @return Tree the union, with the comparator and the allocator of first
+         */
+        static Tree unite(Tree&& first, Tree&& second, ThreadPool* pool);
+
+        /**
+         * @brief The keys of both trees, with the values of first
+         * 
+         * @param first the first tree, left empty
+         * @param second the second tree, left empty
+         * @param pool the pool running the recursion in parallel, nullptr to run it in this thread
+         * @return Tree the intersection, with the comparator and the allocator of first
+         */
+        static Tree intersect(Tree&& first, Tree&& second, ThreadPool* pool);
+
+        /**
+         * @brief The keys of first that are not in second
+         * 
+         * @param first the first tree, left empty
+         * @param second the second tree, left empty
+         * @param pool the pool running the recursion in parallel, nullptr to run it in this thread
+         * @return Tree the difference, with the comparator and the allocator of first
+         */
+        static Tree subtract(Tree&& first, Tree&& second, ThreadPool* pool);
+
+    private:
+        enum class Operation {UNION, INTERSECTION, DIFFERENCE};
+
+        struct Context {
+            Operation operation;
+            ThreadPool* pool;
+            unsigned int parallelDepth; // the recursion forks until this depth
+        };
+
+        static Tree apply(Tree&& first, Tree&& second, ThreadPool* pool, Operation operation);
+        static Node* combine(Tree& workspace, Node* first, Rank firstRank, Node* second, Rank secondRank, Rank& rank, const Context& context, unsigned int depth, std::vector<Node*>& dropped);
+        static void collect(Node* node, Node* nil, std::vector<Node*>& dropped);
+};
+
+#include "../definitions/SetOperations.inl"
+
+#endif
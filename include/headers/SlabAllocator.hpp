@@ -0,0 +1,74 @@
+/**
+ * @file SlabAllocator.hpp
+ * @brief Implementation of an allocator backed by a SlabArena
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+*/
+
+#ifndef __SLABALLOCATOR_HPP__
+#define __SLABALLOCATOR_HPP__
+
+#include <cstddef>
+#include <memory>
+#include "SlabArena.hpp"
+
+/**
+ * @brief This template class implements a standard allocator drawing single objects from a SlabArena
+ * 
+ * @note Copies and rebound copies share the same arena, so every node of a tree (and the control
+ * blocks of its objects) is packed in the same slabs. Requests for more than one object go to the heap.
+ * 
+ * @tparam T the type of the allocated objects
+ */
+template <typename T>
+class SlabAllocator {
+    template <typename U> friend class SlabAllocator;
+
+    public:
+        typedef T value_type;
+
+        /**
+         * @brief Construct a new Slab Allocator with its own arena
+         * 
+         */
+        SlabAllocator();
+
+        /**
+         * @brief Construct a new Slab Allocator sharing the arena of another one
+         * 
+         * @param other the allocator to share the arena with
+         */
+        template <typename U>
+        SlabAllocator(const SlabAllocator<U>& other);
+
+        /**
+         * @brief Allocate memory for n objects
+         * 
+         * @param n the number of objects
+         * @return T* the uninitialized memory
+         */
+        T* allocate(std::size_t n);
+
+        /**
+         * @brief Free memory previously obtained with allocate
+         * 
+         * @param ptr the memory to free
+         * @param n the number of objects passed to allocate
+         */
+        void deallocate(T* ptr, std::size_t n);
+
+        template <typename U>
+        bool operator==(const SlabAllocator<U>& other) const;
+
+        template <typename U>
+        bool operator!=(const SlabAllocator<U>& other) const;
+
+    private:
+        std::shared_ptr<SlabArena> arena;
+};
+
+#include "../definitions/SlabAllocator.inl"
+
+#endif // __SLABALLOCATOR_HPP__
@@ -0,0 +1,75 @@
+/**
+ * @file SlabArena.hpp
+ * @brief Implementation of a slab arena handing out fixed-size blocks
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+*/
+
+#ifndef __SLABARENA_HPP__
+#define __SLABARENA_HPP__
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief This class implements a slab arena
+ * 
+ * @note Blocks are grouped in size classes; each class carves its blocks out of big slabs
+ * and recycles the freed ones through a free list, so once the tree has reached its size
+ * allocating and freeing a node never calls the global heap. Memory goes back to the
+ * system only when the arena is destroyed. The arena is not thread safe.
+ */
+class SlabArena {
+    public:
+        /**
+         * @brief Construct a new empty Slab Arena
+         * 
+         * @param blocksPerSlab number of blocks carved out of every slab
+        */
+        SlabArena(std::size_t blocksPerSlab = 1024);
+
+        SlabArena(const SlabArena&) = delete;
+        SlabArena& operator=(const SlabArena&) = delete;
+
+        /**
+         * @brief Destroy the Slab Arena, releasing every slab
+         * 
+         */
+        ~SlabArena();
+
+        /**
+         * @brief Get a block of the given size
+         * 
+         * @param size the size of the block in bytes
+         * @return void* the block, aligned as std::max_align_t
+        */
+        void* allocate(std::size_t size);
+
+        /**
+         * @brief Give back a block to the arena
+         * 
+         * @param block the block to give back
+         * @param size the size used to allocate the block
+        */
+        void deallocate(void* block, std::size_t size);
+
+    private:
+        struct FreeBlock {
+            FreeBlock* next;
+        };
+
+        static const std::size_t GRANULARITY = alignof(std::max_align_t);
+        static const std::size_t NUM_CLASSES = 16; // blocks up to 256 bytes, bigger ones go to the heap
+
+        std::size_t blocksPerSlab;
+        FreeBlock* freeList[NUM_CLASSES];
+        char* slabCursor[NUM_CLASSES];
+        char* slabEnd[NUM_CLASSES];
+        std::vector<void*> slabs;
+
+        static std::size_t sizeClass(std::size_t size);
+};
+
+#endif // __SLABARENA_HPP__
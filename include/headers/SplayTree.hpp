@@ -0,0 +1,187 @@
+/**
+ * @file SplayTree.hpp
+ * @brief Implementation and management of a Splay Tree
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef SPLAY_TREE_HPP
+#define SPLAY_TREE_HPP
+
+#include "SelfBalancingTree.hpp"
+
+/**
+ * @brief This template class implements a Self-Adjusting Binary Search Tree (Sleator, Tarjan): every access
+ * moves the node to the root
+ * 
+ * @note no balance is stored, the nodes are plain TreeNodes. The operations take O(log n) amortized time,
+ * and the recently or frequently accessed keys stay near the root: with a skewed access pattern a lookup
+ * costs O(1 + log(1 / p)) amortized for a key accessed with probability p. Search, insert and erase splay
+ * top-down, in the same pass that descends the tree; search is therefore not const. The hinted and batch
+ * insertions splay every new node, eraseRange splays the ends of the range; a batch large enough to relink
+ * the whole tree balanced (see BinarySearchTree::insertBatch and removeBatch) splays nothing
+ * 
+ * @tparam Key the type of the keys
+ * @tparam Value the type of the values stored with the keys
+ * @tparam Compare the comparator type, a strict weak ordering on Key
+ * @tparam Alloc the allocator used for the nodes
+ */
+template <typename Key, typename Value, typename Compare = std::less<Key>, typename Alloc = std::allocator<TreeNode<Key, Value>>>
+class SplayTree : public SelfBalancingTree<Key, Value, Compare, Alloc, TreeNode<Key, Value>> {
+    protected:
+        void splay(const Key& key);
+        void splayNode(ptr_TreeNode<Key, Value> node);
+        void removeRoot();
+
+    public:
+        /**
+         * @brief Construct a new empty Splay Tree object
+         * 
+         * @param comp the comparator of the keys
+         * @param alloc the allocator for the nodes
+         */
+        explicit SplayTree(const Compare& comp = Compare(), const Alloc& alloc = Alloc());
+
+        /**
+         * @brief Move the nodes of another Splay Tree into a new one
+         * 
+         * @param other the tree to move from, left empty
+         */
+        SplayTree(SplayTree&& other) = default;
+
+        /**
+         * @brief Destroy the Splay Tree
+         * 
+         */
+        ~SplayTree();
+
+        /**
+         * @brief Insert a key and a copy of its value in the tree
+         * 
+         * @param key the key to insert
+         * @param value the value stored with the key
+         */
+        void insert(const Key& key, const Value& value);
+
+        /**
+         * @brief Insert a key and its value in the tree, moving the value into the node
+         * 
+         * @param key the key to insert
+         * @param value the value stored with the key
+         */
+        void insert(const Key& key, Value&& value);
+
+        /**
+         * @brief Insert a key building its value directly inside the new node, which becomes the root
+         * 
+         * @param key the key to insert
+         * @param args the arguments forwarded to the constructor of the value
+         * @return ptr_TreeNode<Key, Value> the new node
+         */
+        template <typename... Args>
+        ptr_TreeNode<Key, Value> emplace(const Key& key, Args&&... args);
+
+        /**
+         * @brief Insert a TreeNodeObject in the tree (pointer version)
+         * 
+         * @note only for trees whose values are sptr_TreeNodeObject, the key is the one of the object
+         * @param node the TreeNodeObject to insert, the tree takes ownership of it
+         */
+        void insert(TreeNodeObject* node);
+
+        /**
+         * @brief Insert a key building its value inside the new node, searching its place from a node near it,
+         * then splay the node to the root
+         * 
+         * @note the search climbs from hint only until the key falls inside the subtree, then descends
+         * @param hint a node of the tree, nullptr to search from the root
+         * @param key the key to insert
+         * @param args the arguments forwarded to the constructor of the value
+         * @return ptr_TreeNode<Key, Value> the new node, the root of the tree
+         */
+        template <typename... Args>
+        ptr_TreeNode<Key, Value> emplaceHint(ptr_TreeNode<Key, Value> hint, const Key& key, Args&&... args);
+
+        /**
+         * @brief Insert a TreeNodeObject in the tree, searching its place from a node near it, then splay it
+         * to the root
+         * 
+         * @note only for trees whose values are sptr_TreeNodeObject, the key is the one of the object
+         * @param hint a node of the tree, nullptr to search from the root
+         * @param obj pointer to the TreeNodeObject to insert, the tree takes ownership of it
+         * @return ptr_TreeNode<Key, Value> the new node, the root of the tree
+         */
+        ptr_TreeNode<Key, Value> insert(ptr_TreeNode<Key, Value> hint, TreeNodeObject* obj);
+
+        /**
+         * @brief Insert many (key, value) pairs at once
+         * 
+         * @note the batch is sorted; a batch large compared to the tree (at least n / 8) is merged with the nodes
+         * of the tree, which are relinked into a perfectly balanced tree without splaying, a smaller one is
+         * inserted key by key from the previous one, splaying each new node (the last key ends at the root)
+         * @param batch the pairs to insert, in any order
+         */
+        void insertBatch(std::vector<std::pair<Key, Value>> batch);
+
+        /**
+         * @brief Insert many TreeNodeObjects at once
+         * 
+         * @note only for trees whose values are sptr_TreeNodeObject, the tree takes ownership of the objects
+         * @param objects the objects to insert, in any order
+         */
+        void insertBatch(const std::vector<TreeNodeObject*>& objects);
+
+        /**
+         * @brief Search for a node in the tree and splay it to the root
+         * 
+         * @note if the key is not in the tree the last node of the search becomes the root
+         * @param key the key to search for
+         * @return ptr_TreeNode<Key, Value> the node, nullptr if the key is not in the tree
+        */
+        ptr_TreeNode<Key, Value> search(const Key& key);
+
+        /**
+         * @brief Remove a node from the tree and free it
+         * 
+         * @note the node is splayed bottom up to the root, then its subtrees are joined by splaying the
+         * maximum of the left one
+         * @param node the node to remove, invalid after the call
+        */
+        void remove(ptr_TreeNode<Key, Value> node);
+
+        /**
+         * @brief Remove a key (one of its copies, if inserted more than once) and free its node
+         * 
+         * @param key the key to remove
+         * @return true if the key was in the tree
+         */
+        bool erase(const Key& key);
+
+        /**
+         * @brief Remove every key in the closed range [lo, hi] and free their nodes
+         * 
+         * @note the first key of the range is splayed to the root, then the first key past the range: the range
+         * is left as its left subtree and freed whole, in O(k + log n) amortized for k keys in the range
+         * @param lo the smallest key to remove
+         * @param hi the largest key to remove
+         * @return unsigned int the number of nodes removed
+         */
+        unsigned int eraseRange(const Key& lo, const Key& hi);
+
+        /**
+         * @brief Remove many keys at once, one copy each
+         * 
+         * @note k keys many compared to the tree (at least n / 8) are removed with a single in-order walk, relinking
+         * the remaining nodes into a perfectly balanced tree without splaying, fewer ones are erased one at a time,
+         * each splayed to the root first, in O(k log n) amortized
+         * @param keys the keys to remove, in any order
+         */
+        void removeBatch(std::vector<Key> keys);
+};
+
+
+#include "../definitions/SplayTree.inl"
+
+#endif
@@ -0,0 +1,83 @@
+/**
+ * @file ThreadPool.hpp
+ * @brief Implementation of a fixed pool of worker threads for fork-join parallelism
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+*/
+
+#ifndef __THREADPOOL_HPP__
+#define __THREADPOOL_HPP__
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief This class implements a pool of worker threads running submitted tasks in FIFO order
+ * 
+ * @note made for divide and conquer: a task may submit subtasks and wait for them, and waiting for a
+ * task that no worker has started yet runs it in the waiting thread, so nested waits never deadlock
+ * even when every worker is waiting
+ */
+class ThreadPool {
+    public:
+        struct Task;
+        typedef std::shared_ptr<Task> TaskHandle;
+
+        /**
+         * @brief Construct a new Thread Pool and start its workers
+         * 
+         * @param numOfThreads the number of workers, 0 for one per hardware thread
+        */
+        explicit ThreadPool(unsigned int numOfThreads = 0);
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /**
+         * @brief Destroy the Thread Pool, running the tasks still queued and joining the workers
+         * 
+         */
+        ~ThreadPool();
+
+        /**
+         * @brief Queue a task
+         * 
+         * @param job the function to run
+         * @return TaskHandle the handle to wait for the task
+        */
+        TaskHandle submit(std::function<void()> job);
+
+        /**
+         * @brief Wait for a task to finish, running it in this thread if no worker has started it
+         * 
+         * @note an exception thrown by the task is rethrown here
+         * @param task the handle returned by submit
+        */
+        void wait(const TaskHandle& task);
+
+        /**
+         * @brief Get the number of workers
+         * 
+         * @return unsigned int the number of workers
+         */
+        unsigned int getNumOfThreads() const;
+
+    private:
+        std::vector<std::thread> workers;
+        std::deque<TaskHandle> queue;
+        std::mutex queueMutex;
+        std::condition_variable queueChanged;
+        bool stopping{false};
+
+        void work();
+        static void run(Task& task);
+};
+
+#endif // __THREADPOOL_HPP__
@@ -0,0 +1,241 @@
+/**
+ * @file Treap.hpp
+ * @brief Implementation and management of a Treap
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef TREAP_HPP
+#define TREAP_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <random>
+#include "SelfBalancingTree.hpp"
+#include "TreapNode.hpp"
+
+/**
+ * @brief This template class implements a randomized Binary Search Tree, the Treap (Seidel, Aragon): the keys
+ * are in search tree order and the random priorities of the nodes in heap order
+ * 
+ * @note the shape is the one of a search tree built inserting the keys by decreasing priority, so O(log n)
+ * deep in expectation whatever the order of the keys. An insertion rotates the node up, a removal rotates
+ * it down to a leaf, 2 rotations in expectation; split and join walk one path with no rotation, and
+ * eraseRange cuts the range out with two splits and a join. Every tree draws its own priority sequence from a
+ * random seed, so no order of the keys chosen in advance can make it deep
+ * 
+ * @tparam Key the type of the keys
+ * @tparam Value the type of the values stored with the keys
+ * @tparam Compare the comparator type, a strict weak ordering on Key
+ * @tparam Alloc the allocator used for the nodes
+ * @tparam Augment the information kept in the nodes about their subtrees, SubtreeSize for the order statistics
+ */
+template <typename Key, typename Value, typename Compare = std::less<Key>, typename Alloc = std::allocator<TreapNode<Key, Value>>, typename Augment = NoAugmentation>
+class Treap : public SelfBalancingTree<Key, Value, Compare, Alloc, TreapNode<Key, Value, Augment>> {
+    protected:
+        std::uint32_t seed{randomSeed()}; // state of the xorshift generator of the priorities
+
+        static std::uint32_t randomSeed();
+        inline unsigned int nextPriority();
+        template <typename Iterator> ptr_TreapNode<Key, Value, Augment> linkSorted(Iterator first, Iterator last);
+        void insert(ptr_TreapNode<Key, Value, Augment> node);
+        void fixAfterInsert(ptr_TreapNode<Key, Value, Augment> node);
+        void detach(ptr_TreapNode<Key, Value, Augment> node);
+        void splitSubtree(ptr_TreapNode<Key, Value, Augment> node, const Key& key, bool orEqual, ptr_TreapNode<Key, Value, Augment>& left, ptr_TreapNode<Key, Value, Augment>& right);
+        ptr_TreapNode<Key, Value, Augment> joinSubtrees(ptr_TreapNode<Key, Value, Augment> left, ptr_TreapNode<Key, Value, Augment> right);
+        ptr_TreapNode<Key, Value, Augment> uniteSubtrees(ptr_TreapNode<Key, Value, Augment> node, ptr_TreapNode<Key, Value, Augment> added);
+
+    public:
+        /**
+         * @brief Construct a new empty Treap object
+         * 
+         * @param comp the comparator of the keys
+         * @param alloc the allocator for the nodes
+         */
+        explicit Treap(const Compare& comp = Compare(), const Alloc& alloc = Alloc());
+
+        /**
+         * @brief Move the nodes of another Treap into a new one
+         * 
+         * @param other the tree to move from, left empty
+         */
+        Treap(Treap&& other) = default;
+
+        /**
+         * @brief Destroy the Treap
+         * 
+         */
+        ~Treap();
+
+        /**
+         * @brief Build a Treap from (key, value) pairs sorted by key, in O(n)
+         * 
+         * @note the nodes get random priorities and are linked along the right spine, which works as a stack
+         * @param first the first pair
+         * @param last the end of the pairs
+         * @param comp the comparator of the keys
+         * @param alloc the allocator for the nodes
+         * @return Treap the new tree
+         */
+        template <typename Iterator>
+        static Treap buildFromSorted(Iterator first, Iterator last, const Compare& comp = Compare(), const Alloc& alloc = Alloc());
+
+        /**
+         * @brief Join two Treaps in O(log n), merging the right spine of left with the left spine of right
+         * 
+         * @note the trees must have equal allocators, otherwise std::invalid_argument is thrown and both trees are
+         * left untouched
+         * @param left the tree with the smaller keys, left empty
+         * @param right the tree with the greater keys, left empty
+         * @return Treap the joined tree, with the comparator and the allocator of left
+         */
+        static Treap join(Treap&& left, Treap&& right);
+
+        /**
+         * @brief Split the tree at a key in O(log n), moving its nodes into two new trees
+         * 
+         * @note the node counts of the halves are computed on the first call to getNumOfNodes
+         * @param key the key where the tree is split
+         * @return std::pair<Treap, Treap> the tree of the keys less than key and the tree of the others,
+         * this tree is left empty
+         */
+        std::pair<Treap, Treap> split(const Key& key);
+
+        /**
+         * @brief Get the root of the tree
+         * 
+         * @return ptr_TreapNode<Key, Value, Augment> the root of the tree
+         */
+        ptr_TreapNode<Key, Value, Augment> getRoot() const;
+
+        /**
+         * @brief Insert a key and a copy of its value in the tree
+         * 
+         * @param key the key to insert
+         * @param value the value stored with the key
+         */
+        void insert(const Key& key, const Value& value);
+
+        /**
+         * @brief Insert a key and its value in the tree, moving the value into the node
+         * 
+         * @param key the key to insert
+         * @param value the value stored with the key
+         */
+        void insert(const Key& key, Value&& value);
+
+        /**
+         * @brief Insert a key building its value directly inside the new node
+         * 
+         * @param key the key to insert
+         * @param args the arguments forwarded to the constructor of the value
+         * @return ptr_TreapNode<Key, Value, Augment> the new node
+         */
+        template <typename... Args>
+        ptr_TreapNode<Key, Value, Augment> emplace(const Key& key, Args&&... args);
+
+        /**
+         * @brief Insert a TreeNodeObject in the tree (pointer version)
+         * 
+         * @note only for trees whose values are sptr_TreeNodeObject, the key is the one of the object
+         * @param node the TreeNodeObject to insert, the tree takes ownership of it
+         */
+        void insert(TreeNodeObject* node);
+
+        /**
+         * @brief Insert a key building its value inside the new node, searching its place from a node near it
+         * 
+         * @note the search climbs from hint only until the key falls inside the subtree, then descends
+         * @param hint a node of the tree, nullptr to search from the root
+         * @param key the key to insert
+         * @param args the arguments forwarded to the constructor of the value
+         * @return ptr_TreapNode<Key, Value, Augment> the new node
+         */
+        template <typename... Args>
+        ptr_TreapNode<Key, Value, Augment> emplaceHint(ptr_TreapNode<Key, Value, Augment> hint, const Key& key, Args&&... args);
+
+        /**
+         * @brief Insert a TreeNodeObject in the tree, searching its place from a node near it
+         * 
+         * @note only for trees whose values are sptr_TreeNodeObject, the key is the one of the object
+         * @param hint a node of the tree, nullptr to search from the root
+         * @param obj pointer to the TreeNodeObject to insert, the tree takes ownership of it
+         * @return ptr_TreapNode<Key, Value, Augment> the new node
+         */
+        ptr_TreapNode<Key, Value, Augment> insert(ptr_TreapNode<Key, Value, Augment> hint, TreeNodeObject* obj);
+
+        /**
+         * @brief Insert many (key, value) pairs at once
+         * 
+         * @note the batch is sorted and linked into a treap in O(k), as buildFromSorted does, then united with
+         * the tree by splitting it at the roots of higher priority: O(k log(n / k + 1)) expected for k keys
+         * @param batch the pairs to insert, in any order
+         */
+        void insertBatch(std::vector<std::pair<Key, Value>> batch);
+
+        /**
+         * @brief Insert many TreeNodeObjects at once
+         * 
+         * @note only for trees whose values are sptr_TreeNodeObject, the tree takes ownership of the objects
+         * @param objects the objects to insert, in any order
+         */
+        void insertBatch(const std::vector<TreeNodeObject*>& objects);
+
+        /**
+         * @brief Search for a node in the tree
+         * 
+         * @param key the key to search for
+         * @return ptr_TreapNode<Key, Value, Augment> the node, nullptr if the key is not in the tree
+        */
+        ptr_TreapNode<Key, Value, Augment> search(const Key& key) const;
+
+        /**
+         * @brief Find the node with the k-th smallest key, in O(log n)
+         * 
+         * @note only for trees with Augment = SubtreeSize
+         * @param index the position of the node in the sorted keys, from 0
+         * @return ptr_TreapNode<Key, Value, Augment> the node, nullptr if index is not less than the number of nodes
+         */
+        ptr_TreapNode<Key, Value, Augment> select(unsigned int index) const;
+
+        /**
+         * @brief Remove a node from the tree and free it
+         * 
+         * @param node the node to remove, invalid after the call
+        */
+        void remove(ptr_TreapNode<Key, Value, Augment> node);
+
+        /**
+         * @brief Remove a key (one of its copies, if inserted more than once) and free its node
+         * 
+         * @param key the key to remove
+         * @return true if the key was in the tree
+         */
+        bool erase(const Key& key);
+
+        /**
+         * @brief Remove every key in the closed range [lo, hi] and free their nodes
+         * 
+         * @note the range is split out of the tree, freed, and the two sides are joined, O(k + log n) for k keys
+         * in the range
+         * @param lo the smallest key to remove
+         * @param hi the largest key to remove
+         * @return unsigned int the number of nodes removed
+         */
+        unsigned int eraseRange(const Key& lo, const Key& hi);
+
+        /**
+         * @brief Remove many keys at once, one copy each
+         * 
+         * @note the keys are erased one at a time, O(k log n) expected for k keys
+         * @param keys the keys to remove, in any order
+         */
+        void removeBatch(std::vector<Key> keys);
+};
+
+
+#include "../definitions/Treap.inl"
+
+#endif
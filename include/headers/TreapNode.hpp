@@ -0,0 +1,91 @@
+/**
+ * @file TreapNode.hpp
+ * @brief Implementation of a TreeNode for a Treap
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+*/
+
+#ifndef __TreapNode_HPP__
+#define __TreapNode_HPP__
+
+#include "TreeNodeObject.hpp"
+#include "TreeNode.hpp"
+
+/**
+ * @brief This class implements a TreeNode for a Treap
+ * 
+ * @note the node keeps a random priority, which does not fit in the tag bits of the parent link: the node is
+ * a TreeNode plus 4 bytes (and the Summary of Augment)
+ * 
+ * @tparam Key the type of the key
+ * @tparam Value the type of the value stored with the key
+ * @tparam Augment the information kept about the subtree of the node (see Augmentation.hpp)
+*/
+template <typename Key, typename Value, typename Augment = NoAugmentation>
+class TreapNode : public TreeNode<Key, Value>, public Augment::Summary {
+private:
+    unsigned int priority{0};
+
+public:
+    typedef Augment Augmentation;
+
+    /**
+     * @brief Construct a new Treap Node, building its value in place
+     * 
+     * @note the priority is set by the tree
+     * @param key the key of the node
+     * @param args the arguments forwarded to the constructor of the value
+    */
+    template <typename... Args>
+    TreapNode(const Key& key, Args&&... args);
+
+    /**
+     * @brief Destroy the Treap Node 
+     * 
+     */
+    ~TreapNode() = default;
+
+    /**
+     * @brief Get the left child of the node
+     * 
+     * @return TreapNode* the left child of the node
+     */
+    TreapNode* getLeft() const;
+
+    /**
+     * @brief Get the right child of the node
+     * 
+     * @return TreapNode* the right child of the node
+     */
+    TreapNode* getRight() const;
+
+    /**
+     * @brief Get the parent of the node
+     * 
+     * @return TreapNode* the parent of the node
+     */
+    TreapNode* getParent() const;
+
+    /**
+     * @brief Get the priority of the node, not less than the ones of its children
+     * 
+     * @return unsigned int the priority of the node
+     */
+    unsigned int getPriority() const;
+
+    /**
+     * @brief Set the priority of the node
+     * 
+     * @param priority the new priority
+     */
+    void setPriority(unsigned int priority);
+};
+
+template <typename Key, typename Value, typename Augment = NoAugmentation>
+using ptr_TreapNode = TreapNode<Key, Value, Augment>*;
+
+#include "../definitions/TreapNode.inl"
+
+#endif
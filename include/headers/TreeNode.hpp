@@ -10,109 +10,139 @@
 #ifndef __TreeNode_HPP__
 #define __TreeNode_HPP__
 
+#include <cstdint>
+#include <iostream>
 #include <memory>
+#include "Augmentation.hpp"
 #include "TreeNodeObject.hpp"
 
 /**
  * @brief This class implements a TreeNode
+ * 
+ * @note The two low bits of the parent link are always zero (nodes are pointer aligned), so they
+ * hold a small tag owned by the node (the RB color, the AVL balance) instead of a separate field:
+ * with int keys and values a node takes 32 bytes.
+ * 
+ * @tparam Key the type of the key
+ * @tparam Value the type of the value stored with the key
  */
+template <typename Key, typename Value>
 class TreeNode {
-    typedef std::shared_ptr<TreeNode> sptr_TreeNode;
     protected:
-        sptr_TreeNode left{nullptr};
-        sptr_TreeNode right{nullptr};
-        sptr_TreeNode parent{nullptr};
-        sptr_TreeNodeObject obj{nullptr};
+        static const std::uintptr_t TAG_MASK = 3;
+
+        TreeNode* left{nullptr};
+        TreeNode* right{nullptr};
+        std::uintptr_t parent{0}; // parent pointer | tag
+        Key key; // stored next to the links, so that descending the tree does not touch the value
+        Value value;
+
+        inline unsigned getTag() const { return parent & TAG_MASK; }
+        inline void setTag(unsigned tag) { parent = (parent & ~TAG_MASK) | tag; }
 
     public:
+        typedef NoAugmentation Augmentation;
+
         /**
-         * @brief Construct a new Tree Node
+         * @brief Construct a new Tree Node, building its value in place
          * 
-         * @param obj object to store in the node
+         * @param key the key of the node
+         * @param args the arguments forwarded to the constructor of the value
         */
-        TreeNode(sptr_TreeNodeObject obj);
-        
+        template <typename... Args>
+        TreeNode(const Key& key, Args&&... args);
+
         /**
-         * @brief Destroy the Tree Node 
+         * @brief Destroy the Tree Node, releasing the stored value
          * 
+         * @note Links are not owned by the node: the tree is responsible for freeing its nodes
          */
         ~TreeNode();
 
         /**
-         * @brief Get the key of the object stored in the node
+         * @brief Get the key of the node
+         * 
+         * @return const Key& the key of the node
+         */
+        inline const Key& getKey() const { return key; }
+
+        /**
+         * @brief Get the value stored in the node
          * 
-         * @return int the key of the object stored in the node
+         * @return const Value& the value stored in the node
          */
-        int getObjKey() const;
+        const Value& getValue() const;
 
         /**
-         * @brief Get the object stored in the node
+         * @brief Get the value stored in the node
          * 
-         * @return sptr_TreeNodeObject the object stored in the node
+         * @return Value& the value stored in the node
          */
-        sptr_TreeNodeObject getObj() const;
+        Value& getValue();
 
         /**
          * @brief Get the left child of the node
          * 
-         * @return sptr_TreeNode the left child of the node
+         * @return TreeNode* the left child of the node
          */
-        sptr_TreeNode getLeft() const;
+        TreeNode* getLeft() const;
 
         /**
          * @brief Get the right child of the node
          * 
-         * @return sptr_TreeNode the right child of the node
+         * @return TreeNode* the right child of the node
          */
-        sptr_TreeNode getRight() const;
+        TreeNode* getRight() const;
 
         /**
          * @brief Get the parent of the node
          * 
-         * @return sptr_TreeNode the parent of the node
+         * @return TreeNode* the parent of the node
          */
-        sptr_TreeNode getParent() const;
+        TreeNode* getParent() const;
 
         /**
-         * @brief Set the Object of the node
+         * @brief Set the value of the node
          * 
-         * @param obj the new object of the node
+         * @param value the new value of the node
         */
-        void setObj(sptr_TreeNodeObject obj);
+        void setValue(const Value& value);
 
         /**
          * @brief Set the left child of the node
          * 
          * @param left the new left child of the node
         */
-        void setLeft(sptr_TreeNode left);
+        void setLeft(TreeNode* left);
 
         /**
          * @brief Set the right child of the node
          * 
          * @param right the new right child of the node
         */
-        void setRight(sptr_TreeNode right);
+        void setRight(TreeNode* right);
 
         /**
-         * @brief Set the parent of the node
+         * @brief Set the parent of the node, the tag of the node is kept
          * 
          * @param parent the new parent of the node
         */
-        void setParent(sptr_TreeNode parent);
+        void setParent(TreeNode* parent);
+};
 
-        /**
-         * @brief Overload of the << operator, provide a print function to the class
-         * 
-         * @param s the stream
-         * @param node the node to print
-         * @return std::ostream& the key of the object stored in the node in the output stream
-        */
+template <typename Key, typename Value>
+using ptr_TreeNode = TreeNode<Key, Value>*;
 
-        friend std::ostream& operator<<(std::ostream &s, const TreeNode &node);
-        
-};
+/**
+ * @brief Overload of the << operator, provide a print function to the class
+ * 
+ * @param s the stream
+ * @param node the node to print
+ * @return std::ostream& the key stored in the node in the output stream
+*/
+template <typename Key, typename Value>
+std::ostream& operator<<(std::ostream &s, const TreeNode<Key, Value> &node);
 
-typedef std::shared_ptr<TreeNode> sptr_TreeNode;
+#include "../definitions/TreeNode.inl"
 
-#endif // __TreeNode_HPP__
\ No newline at end of file
+#endif // __TreeNode_HPP__
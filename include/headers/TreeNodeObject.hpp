@@ -27,8 +27,9 @@ class TreeNodeObject{
         /**
          * @brief Destroy the Tree Node Object 
          * 
+         * @note virtual because the tree releases objects through a TreeNodeObject pointer
         */
-        ~TreeNodeObject(){};
+        virtual ~TreeNodeObject(){};
 
         /**
          * @brief Get the key of the object 
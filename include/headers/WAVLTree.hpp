@@ -0,0 +1,206 @@
+/**
+ * @file WAVLTree.hpp
+ * @brief Implementation and management of a Weak AVL Tree
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef WAVL_TREE_HPP
+#define WAVL_TREE_HPP
+
+#include "SelfBalancingTree.hpp"
+#include "WAVLTreeNode.hpp"
+
+/**
+ * @brief This template class implements a Self-Balancing Binary Search Tree using the rank-balanced Weak AVL
+ * algorithm (Haeupler, Sen, Tarjan)
+ * 
+ * @note every node has a rank, the rank difference with its children is 1 or 2 and leaves have rank 0. With
+ * insertions only the tree is an AVL Tree (height below 1.44 log n), with removals the height stays below
+ * 2 log n; an update rotates at most twice (an AVL removal may rotate at every level) and the rank changes
+ * are O(1) amortized
+ * 
+ * @tparam Key the type of the keys
+ * @tparam Value the type of the values stored with the keys
+ * @tparam Compare the comparator type, a strict weak ordering on Key
+ * @tparam Alloc the allocator used for the nodes
+ * @tparam Augment the information kept in the nodes about their subtrees, SubtreeSize for the order statistics
+ */
+template <typename Key, typename Value, typename Compare = std::less<Key>, typename Alloc = std::allocator<WAVLTreeNode<Key, Value>>, typename Augment = NoAugmentation>
+class WAVLTree : public SelfBalancingTree<Key, Value, Compare, Alloc, WAVLTreeNode<Key, Value, Augment>> {
+    protected:
+        void insert(ptr_WAVLTreeNode<Key, Value, Augment> node);
+        void fixAfterInsert(ptr_WAVLTreeNode<Key, Value, Augment> node);
+        void detach(ptr_WAVLTreeNode<Key, Value, Augment> node);
+        void fixAfterRemove(ptr_WAVLTreeNode<Key, Value, Augment> parent, bool fromLeft);
+        bool demote(ptr_WAVLTreeNode<Key, Value, Augment> node);
+        static unsigned rankParity(ptr_WAVLTreeNode<Key, Value, Augment> node);
+        static bool isLeaf(ptr_WAVLTreeNode<Key, Value, Augment> node);
+        static void annotateBalanced(WAVLTreeNode<Key, Value, Augment>* node, unsigned int depth, int balance, unsigned int lastLevel, int height);
+        void rotateLeft(ptr_WAVLTreeNode<Key, Value, Augment> node);
+        void rotateRight(ptr_WAVLTreeNode<Key, Value, Augment> node);
+
+    public:
+        /**
+         * @brief Construct a new empty WAVL Tree object
+         * 
+         * @param comp the comparator of the keys
+         * @param alloc the allocator for the nodes
+         */
+        explicit WAVLTree(const Compare& comp = Compare(), const Alloc& alloc = Alloc());
+
+        /**
+         * @brief Move the nodes of another WAVL Tree into a new one
+         * 
+         * @param other the tree to move from, left empty
+         */
+        WAVLTree(WAVLTree&& other) = default;
+
+        /**
+         * @brief Destroy the WAVL Tree
+         * 
+         */
+        ~WAVLTree();
+
+        /**
+         * @brief Get the root of the tree
+         * 
+         * @return ptr_WAVLTreeNode<Key, Value, Augment> the root of the tree
+         */
+        ptr_WAVLTreeNode<Key, Value, Augment> getRoot() const;
+
+        /**
+         * @brief Insert a key and a copy of its value in the tree
+         * 
+         * @param key the key to insert
+         * @param value the value stored with the key
+         */
+        void insert(const Key& key, const Value& value);
+
+        /**
+         * @brief Insert a key and its value in the tree, moving the value into the node
+         * 
+         * @param key the key to insert
+         * @param value the value stored with the key
+         */
+        void insert(const Key& key, Value&& value);
+
+        /**
+         * @brief Insert a key building its value directly inside the new node
+         * 
+         * @param key the key to insert
+         * @param args the arguments forwarded to the constructor of the value
+         * @return ptr_WAVLTreeNode<Key, Value, Augment> the new node
+         */
+        template <typename... Args>
+        ptr_WAVLTreeNode<Key, Value, Augment> emplace(const Key& key, Args&&... args);
+
+        /**
+         * @brief Insert a TreeNodeObject in the tree (pointer version)
+         * 
+         * @note only for trees whose values are sptr_TreeNodeObject, the key is the one of the object
+         * @param node the TreeNodeObject to insert, the tree takes ownership of it
+         */
+        void insert(TreeNodeObject* node);
+
+        /**
+         * @brief Insert a key building its value inside the new node, searching its place from a node near it
+         * 
+         * @note the search climbs from hint only until the key falls inside the subtree, then descends: O(1) for
+         * a key next to hint, O(log d) for a key d positions away, then the tree is fixed as after any insertion
+         * @param hint a node of the tree, nullptr to search from the root
+         * @param key the key to insert
+         * @param args the arguments forwarded to the constructor of the value
+         * @return ptr_WAVLTreeNode<Key, Value, Augment> the new node
+         */
+        template <typename... Args>
+        ptr_WAVLTreeNode<Key, Value, Augment> emplaceHint(ptr_WAVLTreeNode<Key, Value, Augment> hint, const Key& key, Args&&... args);
+
+        /**
+         * @brief Insert a TreeNodeObject in the tree, searching its place from a node near it
+         * 
+         * @note only for trees whose values are sptr_TreeNodeObject, the key is the one of the object
+         * @param hint a node of the tree, nullptr to search from the root
+         * @param obj pointer to the TreeNodeObject to insert, the tree takes ownership of it
+         * @return ptr_WAVLTreeNode<Key, Value, Augment> the new node
+         */
+        ptr_WAVLTreeNode<Key, Value, Augment> insert(ptr_WAVLTreeNode<Key, Value, Augment> hint, TreeNodeObject* obj);
+
+        /**
+         * @brief Insert many (key, value) pairs at once
+         * 
+         * @note the batch is sorted; a batch of k keys large compared to the tree (at least n / 8) is merged with
+         * the nodes of the tree, which are relinked into a perfectly balanced tree in O(n + k log k), a smaller one
+         * is inserted key by key, each from the previous one, in O(k log n)
+         * @param batch the pairs to insert, in any order
+         */
+        void insertBatch(std::vector<std::pair<Key, Value>> batch);
+
+        /**
+         * @brief Insert many TreeNodeObjects at once
+         * 
+         * @note only for trees whose values are sptr_TreeNodeObject, the tree takes ownership of the objects
+         * @param objects the objects to insert, in any order
+         */
+        void insertBatch(const std::vector<TreeNodeObject*>& objects);
+
+        /**
+         * @brief Search for a node in the tree
+         * 
+         * @param key the key to search for
+         * @return ptr_WAVLTreeNode<Key, Value, Augment> the node, nullptr if the key is not in the tree
+        */
+        ptr_WAVLTreeNode<Key, Value, Augment> search(const Key& key) const;
+
+        /**
+         * @brief Find the node with the k-th smallest key, in O(log n)
+         * 
+         * @note only for trees with Augment = SubtreeSize
+         * @param index the position of the node in the sorted keys, from 0
+         * @return ptr_WAVLTreeNode<Key, Value, Augment> the node, nullptr if index is not less than the number of nodes
+         */
+        ptr_WAVLTreeNode<Key, Value, Augment> select(unsigned int index) const;
+
+        /**
+         * @brief Remove a node from the tree and free it
+         * 
+         * @note at most two rotations, the demotions climb only while they make a child too low
+         * @param node the node to remove, invalid after the call
+        */
+        void remove(ptr_WAVLTreeNode<Key, Value, Augment> node);
+
+        /**
+         * @brief Remove a key (one of its copies, if inserted more than once) and free its node
+         * 
+         * @param key the key to remove
+         * @return true if the key was in the tree
+         */
+        bool erase(const Key& key);
+
+        /**
+         * @brief Remove every key in the closed range [lo, hi] and free their nodes
+         * 
+         * @note the nodes are removed one at a time, in O(k log n) for k keys in the range
+         * @param lo the smallest key to remove
+         * @param hi the largest key to remove
+         * @return unsigned int the number of nodes removed
+         */
+        unsigned int eraseRange(const Key& lo, const Key& hi);
+
+        /**
+         * @brief Remove many keys at once, one copy each
+         * 
+         * @note k keys many compared to the tree (at least n / 8) are removed with a single in-order walk, relinking
+         * the remaining nodes into a perfectly balanced tree in O(n + k log k), fewer ones are erased one at a
+         * time in O(k log n)
+         * @param keys the keys to remove, in any order
+         */
+        void removeBatch(std::vector<Key> keys);
+};
+
+
+#include "../definitions/WAVLTree.inl"
+
+#endif
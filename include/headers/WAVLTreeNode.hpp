@@ -0,0 +1,87 @@
+/**
+ * @file WAVLTreeNode.hpp
+ * @brief Implementation of a TreeNode for a Weak AVL Tree
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+*/
+
+#ifndef __WAVLTreeNode_HPP__
+#define __WAVLTreeNode_HPP__
+
+#include "TreeNodeObject.hpp"
+#include "TreeNode.hpp"
+
+/**
+ * @brief This class implements a TreeNode for a Weak AVL Tree
+ * 
+ * @note only the parity of the rank is kept, in the low bit of the parent link: the rank difference of a
+ * child is 1 if the parities differ and 2 if they match (a missing child has rank -1), which is all the
+ * balance needs; the node is as big as a TreeNode plus the Summary of Augment
+ * 
+ * @tparam Key the type of the key
+ * @tparam Value the type of the value stored with the key
+ * @tparam Augment the information kept about the subtree of the node (see Augmentation.hpp)
+*/
+template <typename Key, typename Value, typename Augment = NoAugmentation>
+class WAVLTreeNode : public TreeNode<Key, Value>, public Augment::Summary {
+public:
+    typedef Augment Augmentation;
+
+    /**
+     * @brief Construct a new WAVL Tree Node, a leaf of rank 0, building its value in place
+     * 
+     * @param key the key of the node
+     * @param args the arguments forwarded to the constructor of the value
+    */
+    template <typename... Args>
+    WAVLTreeNode(const Key& key, Args&&... args);
+
+    /**
+     * @brief Destroy the WAVL Tree Node 
+     * 
+     */
+    ~WAVLTreeNode() = default;
+
+    /**
+     * @brief Get the left child of the node
+     * 
+     * @return WAVLTreeNode* the left child of the node
+     */
+    WAVLTreeNode* getLeft() const;
+
+    /**
+     * @brief Get the right child of the node
+     * 
+     * @return WAVLTreeNode* the right child of the node
+     */
+    WAVLTreeNode* getRight() const;
+
+    /**
+     * @brief Get the parent of the node
+     * 
+     * @return WAVLTreeNode* the parent of the node
+     */
+    WAVLTreeNode* getParent() const;
+
+    /**
+     * @brief Get the parity of the rank of the node
+     * 
+     * @return unsigned the rank modulo 2
+     */
+    unsigned getRankParity() const;
+
+    /**
+     * @brief Raise or lower the rank of the node by one
+     * 
+     */
+    void flipRank();
+};
+
+template <typename Key, typename Value, typename Augment = NoAugmentation>
+using ptr_WAVLTreeNode = WAVLTreeNode<Key, Value, Augment>*;
+
+#include "../definitions/WAVLTreeNode.inl"
+
+#endif
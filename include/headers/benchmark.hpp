@@ -16,6 +16,8 @@
 #include <chrono>
 #include <algorithm>
 #include <random>
+#include <cmath>
+#include "ThreadPool.hpp"
 
 typedef unsigned int uint;
 
@@ -33,6 +35,27 @@ void benchmarkInsert(T& tree, const uint iterations, std::vector<T_OBJECT*> obje
     std::cout << "INSERT: " << elapsedMicroseconds.count()/iterations << std::endl;
 }
 
+template <typename T>
+void benchmarkEmplace(T& tree, const uint iterations) {
+    std::chrono::duration<double, std::micro> elapsedMicroseconds = std::chrono::duration<double, std::micro>(0.0);
+    std::vector<int> keys = std::vector<int>(iterations);
+    for(uint i{0}; i<iterations; ++i) {
+        keys[i] = i;
+    }
+    std::random_device rd;
+    std::mt19937 rng(rd());
+    std::shuffle(std::begin(keys), std::end(keys), rng);
+
+    for(uint i{0}; i<iterations; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        tree.emplace( keys[i], keys[i] ); // the value is built inside the node from the key
+        auto end = std::chrono::steady_clock::now();
+
+        elapsedMicroseconds += (end-start);
+    }
+    std::cout << "EMPLACE: " << elapsedMicroseconds.count()/iterations << std::endl;
+}
+
 template <typename T, typename T_NODE, typename T_OBJECT>
 void benchmarkSearch(T& tree, const uint iterations, std::vector<T_OBJECT*> objects, std::vector<T_NODE>& nodes) {
     std::chrono::duration<double, std::micro> elapsedMicroseconds = std::chrono::duration<double, std::micro>(0.0);
@@ -61,6 +84,20 @@ void benchmarkRemove(T& tree, const uint iterations, std::vector<T_NODE>& nodes)
     std::cout << "REMOVE: " << elapsedMicroseconds.count()/iterations << std::endl;
 }
 
+template <typename T, typename T_OBJECT>
+void benchmarkRemoveByKey(T& tree, const uint iterations, std::vector<T_OBJECT*> objects) {
+    std::chrono::duration<double, std::micro> elapsedMicroseconds = std::chrono::duration<double, std::micro>(0.0);
+
+    for(uint i{0}; i<iterations; ++i) {
+        const int key = objects.at(i)->getKey(); // the tree may own (and free) the object
+        auto start = std::chrono::steady_clock::now();
+        tree.remove( key );
+        auto end = std::chrono::steady_clock::now();
+
+        elapsedMicroseconds += (end-start);
+    }
+    std::cout << "REMOVE: " << elapsedMicroseconds.count()/iterations << std::endl;
+}
 
 template <typename T, typename T_NODE, typename T_OBJECT>
 void benchmark(T& tree, const uint iterations) {
@@ -82,5 +119,425 @@ void benchmark(T& tree, const uint iterations) {
     benchmarkRemove<T, T_NODE, T_OBJECT>(tree, iterations, nodes);
 }
 
+// same as benchmark, for trees whose search results do not survive other removals (B+ Tree): remove by key
+template <typename T, typename T_NODE, typename T_OBJECT>
+void benchmarkByKey(T& tree, const uint iterations) {
+    std::vector<T_OBJECT*> objects = std::vector<T_OBJECT*>(iterations);
+    std::vector<T_NODE> nodes = std::vector<T_NODE>(iterations);
+
+    // MEMORY ALLOCATION
+    for(uint i{0}; i<iterations; ++i) {
+        objects[i] = new T_OBJECT(i);
+    }
+
+    // RANDOM SHUFFLE
+    std::random_device rd;
+    std::mt19937 rng(rd());
+    std::shuffle(std::begin(objects), std::end(objects), rng);
+
+    benchmarkInsert<T, T_OBJECT>(tree, iterations, objects);
+    benchmarkSearch<T, T_NODE, T_OBJECT>(tree, iterations, objects, nodes);
+    benchmarkRemoveByKey<T, T_OBJECT>(tree, iterations, objects);
+}
+
+// insert and remove batchSize keys in a tree of treeSize keys, one key at a time and with insertBatch/removeBatch
+template <typename T>
+void benchmarkBatch(const uint treeSize, const uint batchSize) {
+    std::random_device rd;
+    std::mt19937 rng(rd());
+    std::vector<std::pair<int, int>> initial = std::vector<std::pair<int, int>>(treeSize);
+    for(uint i{0}; i<treeSize; ++i) {
+        initial[i] = std::make_pair(static_cast<int>(2*i), static_cast<int>(i)); // even keys in the tree, odd keys in the batch
+    }
+    std::vector<std::pair<int, int>> batch = std::vector<std::pair<int, int>>(batchSize);
+    std::vector<int> batchKeys = std::vector<int>(batchSize);
+    for(uint i{0}; i<batchSize; ++i) {
+        batchKeys[i] = static_cast<int>(2*(rng() % treeSize) + 1);
+        batch[i] = std::make_pair(batchKeys[i], batchKeys[i]);
+    }
+
+    T loopTree = T();
+    T batchTree = T();
+    loopTree.insertBatch(initial);
+    batchTree.insertBatch(initial);
+
+    auto start = std::chrono::steady_clock::now();
+    for(uint i{0}; i<batchSize; ++i) {
+        loopTree.insert(batch[i].first, batch[i].second);
+    }
+    std::chrono::duration<double, std::micro> elapsedMicroseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "INSERT (one at a time): " << elapsedMicroseconds.count()/batchSize << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    batchTree.insertBatch(batch);
+    elapsedMicroseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "INSERT (batch): " << elapsedMicroseconds.count()/batchSize << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    for(uint i{0}; i<batchSize; ++i) {
+        loopTree.remove(loopTree.search(batchKeys[i]));
+    }
+    elapsedMicroseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "REMOVE (one at a time): " << elapsedMicroseconds.count()/batchSize << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    batchTree.removeBatch(batchKeys);
+    elapsedMicroseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "REMOVE (batch): " << elapsedMicroseconds.count()/batchSize << std::endl;
+
+    if (loopTree.getNumOfNodes() != treeSize || batchTree.getNumOfNodes() != treeSize) {
+        std::cout << "ERROR: wrong number of nodes" << std::endl;
+    }
+}
+
+// rank, select and countInRange on a tree of the keys 0..numKeys-1 augmented with subtree sizes, in µs per
+// query, against ranking a key by walking the tree in order
+template <typename T, typename T_NODE>
+void benchmarkOrderStatistics(const uint numKeys, const T_NODE nil) {
+    std::vector<std::pair<int, int>> pairs = std::vector<std::pair<int, int>>(numKeys);
+    for(uint i{0}; i<numKeys; ++i) {
+        pairs[i] = std::make_pair(static_cast<int>(i), static_cast<int>(i));
+    }
+    T tree = T::buildFromSorted(pairs.begin(), pairs.end());
+    const uint numQueries = 100000;
+    std::mt19937 rng(42);
+    std::vector<int> keys = std::vector<int>(numQueries);
+    for(uint i{0}; i<numQueries; ++i) {
+        keys[i] = static_cast<int>(rng() % numKeys);
+    }
+
+    const uint numWalks = 10;
+    uint errors{0};
+    auto start = std::chrono::steady_clock::now();
+    for(uint i{0}; i<numWalks; ++i) {
+        uint count{0};
+        for(T_NODE node = tree.minimum(); node != nil && node->getKey() < keys[i]; node = tree.successor(node)) {
+            ++count;
+        }
+        errors += count != static_cast<uint>(keys[i]);
+    }
+    std::chrono::duration<double, std::micro> elapsedMicroseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "RANK (in-order walk): " << elapsedMicroseconds.count()/numWalks << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    for(uint i{0}; i<numQueries; ++i) {
+        errors += tree.rank(keys[i]) != static_cast<uint>(keys[i]);
+    }
+    elapsedMicroseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "RANK: " << elapsedMicroseconds.count()/numQueries << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    for(uint i{0}; i<numQueries; ++i) {
+        errors += tree.select(keys[i])->getKey() != keys[i];
+    }
+    elapsedMicroseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "SELECT: " << elapsedMicroseconds.count()/numQueries << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    for(uint i{0}; i<numQueries; ++i) {
+        int lo = std::min(keys[i], keys[numQueries - 1 - i]);
+        int hi = std::max(keys[i], keys[numQueries - 1 - i]);
+        errors += tree.countInRange(lo, hi) != static_cast<uint>(hi - lo + 1);
+    }
+    elapsedMicroseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "COUNT IN RANGE: " << elapsedMicroseconds.count()/numQueries << std::endl;
+
+    if (errors != 0) {
+        std::cout << "ERROR: wrong order statistics" << std::endl;
+    }
+}
+
+// sum of the values with lo <= key <= hi on a tree of the keys 0..numKeys-1 augmented with a sum monoid, in µs per
+// query, against summing the range by walking the tree in order from lo; then the cost of changing a value
+template <typename T, typename T_NODE>
+void benchmarkRangeAggregate(const uint numKeys, const T_NODE nil) {
+    std::vector<std::pair<int, int>> pairs = std::vector<std::pair<int, int>>(numKeys);
+    for(uint i{0}; i<numKeys; ++i) {
+        pairs[i] = std::make_pair(static_cast<int>(i), static_cast<int>(i));
+    }
+    T tree = T::buildFromSorted(pairs.begin(), pairs.end());
+    const uint numQueries = 100000;
+    std::mt19937 rng(42);
+    std::vector<int> keys = std::vector<int>(numQueries);
+    for(uint i{0}; i<numQueries; ++i) {
+        keys[i] = static_cast<int>(rng() % numKeys);
+    }
+    auto rangeSum = [](long long lo, long long hi) { return (lo + hi) * (hi - lo + 1) / 2; };
+
+    const uint numWalks = 100;
+    uint errors{0};
+    auto start = std::chrono::steady_clock::now();
+    for(uint i{0}; i<numWalks; ++i) {
+        int lo = std::min(keys[i], keys[numQueries - 1 - i]);
+        int hi = std::max(keys[i], keys[numQueries - 1 - i]);
+        long long sum{0};
+        for(T_NODE node = tree.search(lo); node != nil && node->getKey() <= hi; node = tree.successor(node)) {
+            sum += node->getValue();
+        }
+        errors += sum != rangeSum(lo, hi);
+    }
+    std::chrono::duration<double, std::micro> elapsedMicroseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "RANGE SUM (in-order walk): " << elapsedMicroseconds.count()/numWalks << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    for(uint i{0}; i<numQueries; ++i) {
+        int lo = std::min(keys[i], keys[numQueries - 1 - i]);
+        int hi = std::max(keys[i], keys[numQueries - 1 - i]);
+        errors += tree.aggregate(lo, hi) != rangeSum(lo, hi);
+    }
+    elapsedMicroseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "RANGE SUM: " << elapsedMicroseconds.count()/numQueries << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    for(uint i{0}; i<numQueries; ++i) {
+        T_NODE node = tree.search(keys[i]);
+        tree.updateValue(node, node->getValue() + 1);
+    }
+    elapsedMicroseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "UPDATE VALUE: " << elapsedMicroseconds.count()/numQueries << std::endl;
+
+    if (errors != 0 || tree.aggregate(0, static_cast<int>(numKeys) - 1) != rangeSum(0, numKeys - 1) + numQueries) {
+        std::cout << "ERROR: wrong range aggregates" << std::endl;
+    }
+}
+
+// scans of rangeSize consecutive keys on a tree of the keys 0..numKeys-1, in µs per scan: with forEachInRange,
+// and with the iterators between two lower_bound
+template <typename T>
+void benchmarkRangeScan(const uint numKeys, const uint rangeSize) {
+    std::vector<std::pair<int, int>> pairs = std::vector<std::pair<int, int>>(numKeys);
+    for(uint i{0}; i<numKeys; ++i) {
+        pairs[i] = std::make_pair(static_cast<int>(i), static_cast<int>(i));
+    }
+    T tree = T::buildFromSorted(pairs.begin(), pairs.end());
+    const uint numScans = 100000;
+    std::mt19937 rng(42);
+    std::vector<int> starts = std::vector<int>(numScans);
+    for(uint i{0}; i<numScans; ++i) {
+        starts[i] = static_cast<int>(rng() % (numKeys - rangeSize));
+    }
+    long long expected{0};
+    for(uint i{0}; i<numScans; ++i) {
+        expected += static_cast<long long>(rangeSize) * starts[i] + static_cast<long long>(rangeSize) * (rangeSize - 1) / 2;
+    }
+
+    long long sum{0};
+    auto start = std::chrono::steady_clock::now();
+    for(uint i{0}; i<numScans; ++i) {
+        tree.forEachInRange(starts[i], starts[i] + static_cast<int>(rangeSize) - 1, [&sum](const int&, const int& value) { sum += value; });
+    }
+    std::chrono::duration<double, std::micro> elapsedMicroseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "FOR EACH IN RANGE: " << elapsedMicroseconds.count()/numScans << std::endl;
+    uint errors = sum != expected;
+
+    sum = 0;
+    start = std::chrono::steady_clock::now();
+    for(uint i{0}; i<numScans; ++i) {
+        typename T::iterator last = tree.lower_bound(starts[i] + static_cast<int>(rangeSize));
+        for(typename T::iterator it = tree.lower_bound(starts[i]); it != last; ++it) {
+            sum += it->getValue();
+        }
+    }
+    elapsedMicroseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "ITERATORS: " << elapsedMicroseconds.count()/numScans << std::endl;
+    errors += sum != expected;
+
+    if (errors != 0) {
+        std::cout << "ERROR: wrong range scans" << std::endl;
+    }
+}
+
+// expiry sweeps: numKeys keys are removed from the front of a tree of the keys 0..numKeys-1, rangeSize consecutive
+// keys at a time, with one erase per key and with eraseRange, in ms for the whole sweep
+template <typename T>
+void benchmarkEraseRange(const uint numKeys, const uint rangeSize) {
+    std::vector<std::pair<int, int>> pairs = std::vector<std::pair<int, int>>(numKeys);
+    for(uint i{0}; i<numKeys; ++i) {
+        pairs[i] = std::make_pair(static_cast<int>(i), static_cast<int>(i));
+    }
+    T loopTree = T::buildFromSorted(pairs.begin(), pairs.end());
+    T rangeTree = T::buildFromSorted(pairs.begin(), pairs.end());
+
+    uint errors{0};
+    auto start = std::chrono::steady_clock::now();
+    for(uint lo{0}; lo<numKeys; lo += rangeSize) {
+        for(uint key{lo}; key<lo+rangeSize && key<numKeys; ++key) {
+            errors += !loopTree.erase(static_cast<int>(key));
+        }
+    }
+    std::chrono::duration<double, std::milli> elapsedMilliseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "ERASE (one key at a time): " << elapsedMilliseconds.count() << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    uint erased{0};
+    for(uint lo{0}; lo<numKeys; lo += rangeSize) {
+        erased += rangeTree.eraseRange(static_cast<int>(lo), static_cast<int>(lo + rangeSize - 1));
+    }
+    elapsedMilliseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "ERASE RANGE: " << elapsedMilliseconds.count() << std::endl;
+
+    if (errors != 0 || erased != numKeys || !loopTree.isEmpty() || !rangeTree.isEmpty()) {
+        std::cout << "ERROR: wrong number of nodes" << std::endl;
+    }
+}
+
+// stabbing and overlap queries on numIntervals random intervals, in µs per query, against scanning a vector of
+// the intervals; every query is checked against the scan by the number of intervals reported
+template <typename T>
+void benchmarkIntervals(const uint numIntervals) {
+    const int span = 1000000000;
+    const int maxLength = 100000;
+    std::mt19937 rng(42);
+    std::vector<std::pair<int, int>> intervals = std::vector<std::pair<int, int>>(numIntervals);
+    T tree = T();
+    auto start = std::chrono::steady_clock::now();
+    for(uint i{0}; i<numIntervals; ++i) {
+        int low = static_cast<int>(rng() % span);
+        intervals[i] = std::make_pair(low, low + static_cast<int>(rng() % maxLength));
+        tree.insert(intervals[i].first, intervals[i].second, static_cast<int>(i));
+    }
+    std::chrono::duration<double, std::micro> elapsedMicroseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "INSERT: " << elapsedMicroseconds.count()/numIntervals << std::endl;
+
+    const uint numQueries = 100000;
+    const uint numScans = 100;
+    std::vector<std::pair<int, int>> queries = std::vector<std::pair<int, int>>(numQueries);
+    for(uint i{0}; i<numQueries; ++i) {
+        int lo = static_cast<int>(rng() % span);
+        queries[i] = std::make_pair(lo, lo + static_cast<int>(rng() % maxLength));
+    }
+    std::vector<uint> scanCounts = std::vector<uint>(numScans);
+    start = std::chrono::steady_clock::now();
+    for(uint i{0}; i<numScans; ++i) {
+        for(const std::pair<int, int>& interval : intervals) {
+            scanCounts[i] += interval.first <= queries[i].second && queries[i].first <= interval.second;
+        }
+    }
+    elapsedMicroseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "OVERLAP (linear scan): " << elapsedMicroseconds.count()/numScans << std::endl;
+
+    uint errors{0};
+    uint reported{0};
+    start = std::chrono::steady_clock::now();
+    for(uint i{0}; i<numQueries; ++i) {
+        uint count{0};
+        tree.overlap(queries[i].first, queries[i].second, [&count](const int&, const int&, const int&) { ++count; });
+        errors += i < numScans && count != scanCounts[i];
+        reported += count;
+    }
+    elapsedMicroseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "OVERLAP: " << elapsedMicroseconds.count()/numQueries << " (" << static_cast<double>(reported)/numQueries << " intervals per query)" << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    for(uint i{0}; i<numQueries; ++i) {
+        uint count{0};
+        tree.stab(queries[i].first, [&count](const int&, const int&, const int&) { ++count; });
+        reported += count;
+    }
+    elapsedMicroseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "STAB: " << elapsedMicroseconds.count()/numQueries << std::endl;
+
+    if (errors != 0 || tree.getNumOfNodes() != numIntervals) {
+        std::cout << "ERROR: wrong intervals reported" << std::endl;
+    }
+}
+
+// union, intersection and difference of the trees of the multiples of 2 and of 3 below 3*size, in ms: the union
+// is compared with inserting the keys of the second tree one at a time, the set operations run sequentially and on a pool
+template <typename T, typename T_NODE>
+void benchmarkSetOperations(const uint size, const T_NODE nil, ThreadPool& pool) {
+    std::vector<std::pair<int, int>> first = std::vector<std::pair<int, int>>(3*size/2);
+    std::vector<std::pair<int, int>> second = std::vector<std::pair<int, int>>(size);
+    for(uint i{0}; i<first.size(); ++i) {
+        first[i] = std::make_pair(static_cast<int>(2*i), static_cast<int>(i));
+    }
+    for(uint i{0}; i<second.size(); ++i) {
+        second[i] = std::make_pair(static_cast<int>(3*i), static_cast<int>(i));
+    }
+    const uint unionSize = first.size() + second.size() - size/2;
+
+    T loopTree = T::buildFromSorted(first.begin(), first.end());
+    auto start = std::chrono::steady_clock::now();
+    for(uint i{0}; i<second.size(); ++i) {
+        if (loopTree.search(second[i].first) == nil) {
+            loopTree.insert(second[i].first, second[i].second);
+        }
+    }
+    std::chrono::duration<double, std::milli> elapsedMilliseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "UNION (one insert at a time): " << elapsedMilliseconds.count() << std::endl;
+
+    const char* names[] = {"UNION", "INTERSECTION", "DIFFERENCE"};
+    const uint expected[] = {unionSize, (size + 1)/2, static_cast<uint>(first.size()) - (size + 1)/2};
+    for(uint operation{0}; operation<3; ++operation) {
+        for(uint parallel{0}; parallel<2; ++parallel) {
+            T a = T::buildFromSorted(first.begin(), first.end());
+            T b = T::buildFromSorted(second.begin(), second.end());
+            start = std::chrono::steady_clock::now();
+            T result = (operation == 0) ? (parallel ? T::setUnion(std::move(a), std::move(b), pool) : T::setUnion(std::move(a), std::move(b)))
+                     : (operation == 1) ? (parallel ? T::setIntersection(std::move(a), std::move(b), pool) : T::setIntersection(std::move(a), std::move(b)))
+                     : (parallel ? T::setDifference(std::move(a), std::move(b), pool) : T::setDifference(std::move(a), std::move(b)));
+            elapsedMilliseconds = std::chrono::steady_clock::now() - start;
+            std::cout << names[operation] << (parallel ? " (parallel): " : " (sequential): ") << elapsedMilliseconds.count() << std::endl;
+            if (result.getNumOfNodes() != expected[operation]) {
+                std::cout << "ERROR: wrong number of nodes" << std::endl;
+            }
+        }
+    }
+    if (loopTree.getNumOfNodes() != unionSize) {
+        std::cout << "ERROR: wrong number of nodes" << std::endl;
+    }
+}
+
+// numLookups keys among 0..numKeys-1 drawn with a Zipf distribution: the key of rank r (from 1) is drawn with
+// probability proportional to 1/r^skew, skew 0 is uniform. The ranks are assigned to the keys in random order,
+// so that the hot keys are spread over the whole tree
+inline std::vector<int> zipfKeys(const uint numKeys, const uint numLookups, const double skew, std::mt19937& rng) {
+    std::vector<double> weights = std::vector<double>(numKeys);
+    for(uint i{0}; i<numKeys; ++i) {
+        weights[i] = 1.0 / std::pow(i + 1.0, skew);
+    }
+    std::discrete_distribution<uint> rank = std::discrete_distribution<uint>(weights.begin(), weights.end());
+    std::vector<int> keyOfRank = std::vector<int>(numKeys);
+    for(uint i{0}; i<numKeys; ++i) {
+        keyOfRank[i] = static_cast<int>(i);
+    }
+    std::shuffle(std::begin(keyOfRank), std::end(keyOfRank), rng);
+
+    std::vector<int> lookups = std::vector<int>(numLookups);
+    for(uint i{0}; i<numLookups; ++i) {
+        lookups[i] = keyOfRank[rank(rng)];
+    }
+    return lookups;
+}
+
+// point lookups of Zipf-distributed keys on a tree filled with the keys 0..numKeys-1 in random order, in µs per
+// lookup; a self-adjusting tree keeps the frequent keys near the root, the more the higher the skew
+template <typename T, typename T_NODE>
+void benchmarkZipfSearch(const uint numKeys, const uint numLookups, const double skew, const T_NODE nil) {
+    std::mt19937 rng(42);
+    std::vector<int> keys = std::vector<int>(numKeys);
+    for(uint i{0}; i<numKeys; ++i) {
+        keys[i] = static_cast<int>(i);
+    }
+    std::shuffle(std::begin(keys), std::end(keys), rng);
+    T tree = T();
+    for(uint i{0}; i<numKeys; ++i) {
+        tree.emplace(keys[i], keys[i]);
+    }
+    std::vector<int> lookups = zipfKeys(numKeys, numLookups, skew, rng);
+
+    uint found{0};
+    auto start = std::chrono::steady_clock::now();
+    for(uint i{0}; i<numLookups; ++i) {
+        found += tree.search(lookups[i]) != nil;
+    }
+    std::chrono::duration<double, std::micro> elapsedMicroseconds = std::chrono::steady_clock::now() - start;
+    std::cout << "SEARCH: " << elapsedMicroseconds.count()/numLookups << std::endl;
+
+    if (found != numLookups) {
+        std::cout << "ERROR: missing keys" << std::endl;
+    }
+}
+
 #endif
 
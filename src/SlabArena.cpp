@@ -0,0 +1,65 @@
+/**
+ * @file SlabArena.cpp
+ * @brief This file contains the implementation of the SlabArena class
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include <new>
+#include "SlabArena.hpp"
+
+// constructor and destructor
+SlabArena::SlabArena(std::size_t blocksPerSlab) : blocksPerSlab{blocksPerSlab} {
+    for (std::size_t i{0}; i < NUM_CLASSES; ++i) {
+        freeList[i] = nullptr;
+        slabCursor[i] = nullptr;
+        slabEnd[i] = nullptr;
+    }
+}
+
+SlabArena::~SlabArena() {
+    for (void* slab : slabs) {
+        ::operator delete(slab);
+    }
+}
+
+// core functionalities
+std::size_t SlabArena::sizeClass(std::size_t size) {
+    return (size + GRANULARITY - 1) / GRANULARITY - 1;
+}
+
+void* SlabArena::allocate(std::size_t size) {
+    std::size_t cls = sizeClass(size);
+    if (size == 0 || cls >= NUM_CLASSES) {
+        return ::operator new(size);
+    }
+    if (freeList[cls] != nullptr) { // recycle a freed block first
+        FreeBlock* block = freeList[cls];
+        freeList[cls] = block->next;
+        return block;
+    }
+    std::size_t blockSize = (cls + 1) * GRANULARITY;
+    if (slabCursor[cls] == slabEnd[cls]) { // current slab exhausted, get a new one
+        slabs.push_back(nullptr); // grow the bookkeeping first so a failure cannot leak the slab
+        slabs.back() = ::operator new(blockSize * blocksPerSlab);
+        slabCursor[cls] = static_cast<char*>(slabs.back());
+        slabEnd[cls] = slabCursor[cls] + blockSize * blocksPerSlab;
+    }
+    void* block = slabCursor[cls];
+    slabCursor[cls] += blockSize;
+    return block;
+}
+
+void SlabArena::deallocate(void* block, std::size_t size) {
+    std::size_t cls = sizeClass(size);
+    if (size == 0 || cls >= NUM_CLASSES) {
+        ::operator delete(block);
+        return;
+    }
+    FreeBlock* freed = static_cast<FreeBlock*>(block);
+    freed->next = freeList[cls];
+    freeList[cls] = freed;
+}
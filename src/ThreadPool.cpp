@@ -0,0 +1,103 @@
+/**
+ * @file ThreadPool.cpp
+ * @brief This file contains the implementation of the ThreadPool class
+ * @version 1.0
+ * @date 2023-01-17
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include "ThreadPool.hpp"
+
+// a task is run once, by the first thread that claims it: a worker or the thread waiting for it
+struct ThreadPool::Task {
+    std::function<void()> job;
+    std::atomic<bool> claimed{false};
+    bool done{false};
+    std::exception_ptr error;
+    std::mutex doneMutex;
+    std::condition_variable finished;
+};
+
+// constructor and destructor
+ThreadPool::ThreadPool(unsigned int numOfThreads) {
+    if (numOfThreads == 0) {
+        numOfThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    workers.reserve(numOfThreads);
+    for (unsigned int i{0}; i < numOfThreads; ++i) {
+        workers.emplace_back(&ThreadPool::work, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        stopping = true;
+    }
+    queueChanged.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+// core functionalities
+ThreadPool::TaskHandle ThreadPool::submit(std::function<void()> job) {
+    TaskHandle task = std::make_shared<Task>();
+    task->job = std::move(job);
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        queue.push_back(task);
+    }
+    queueChanged.notify_one();
+    return task;
+}
+
+void ThreadPool::wait(const TaskHandle& task) {
+    if (!task->claimed.exchange(true)) {
+        run(*task); // still queued: the worker that pops it will skip it
+    } else {
+        std::unique_lock<std::mutex> lock(task->doneMutex);
+        task->finished.wait(lock, [&task] { return task->done; });
+    }
+    if (task->error) {
+        std::rethrow_exception(task->error);
+    }
+}
+
+unsigned int ThreadPool::getNumOfThreads() const {
+    return static_cast<unsigned int>(workers.size());
+}
+
+void ThreadPool::work() {
+    while (true) {
+        TaskHandle task;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            queueChanged.wait(lock, [this] { return stopping || !queue.empty(); });
+            if (queue.empty()) {
+                return; // stopping, and nothing left to run
+            }
+            task = std::move(queue.front());
+            queue.pop_front();
+        }
+        if (!task->claimed.exchange(true)) {
+            run(*task);
+        }
+    }
+}
+
+void ThreadPool::run(Task& task) {
+    try {
+        task.job();
+    } catch (...) {
+        task.error = std::current_exception();
+    }
+    std::lock_guard<std::mutex> lock(task.doneMutex);
+    task.done = true;
+    task.finished.notify_all();
+}